@@ -5,8 +5,10 @@ WHERE cl.exe
 IF %ERRORLEVEL% NEQ 0 CALL "C:\Program Files (x86)\Microsoft Visual Studio\2019\Community\VC\Auxiliary\Build\vcvarsall.bat" x64
 
 REM READ THE BUILD MODE COMMAND LINE ARGUMENT.
-REM Either "debug" or "release" (no quotes).
+REM Either "debug", "release", or "test" (no quotes).
 REM If not specified, will default to debug.
+REM Test builds are debug builds that also include the self-tests (run by passing "self-test"
+REM to the program), which are left out of other builds since they replace global operator new.
 SET build_mode=%1
 
 REM DEFINE COMPILER OPTIONS.
@@ -15,6 +17,7 @@ REM SET COMMON_COMPILER_OPTIONS=/EHsc /WX /W4 /TP /analyze:WX- /analyze:plugin E
 SET COMMON_COMPILER_OPTIONS=/EHsc /WX /W4 /TP
 SET DEBUG_COMPILER_OPTIONS=%COMMON_COMPILER_OPTIONS% /Z7 /Od /MTd
 SET RELEASE_COMPILER_OPTIONS=%COMMON_COMPILER_OPTIONS% /O2 /MT
+SET TEST_COMPILER_OPTIONS=%DEBUG_COMPILER_OPTIONS% /D SELF_TESTS_ENABLED /FeOpenGLSelfTests.exe
 
 REM DEFINE FILES TO COMPILE/LINK.
 SET COMPILATION_FILE="..\OpenGL.project"
@@ -39,6 +42,8 @@ PUSHD "build"
     REM BUILD THE PROGRAM BASED ON THE BUILD MODE.
     IF "%build_mode%"=="release" (
         cl.exe %RELEASE_COMPILER_OPTIONS% %PROJECT_FILES_DIRS_AND_LIBS%
+    ) ELSE IF "%build_mode%"=="test" (
+        cl.exe %TEST_COMPILER_OPTIONS% %PROJECT_FILES_DIRS_AND_LIBS%
     ) ELSE (
         cl.exe %DEBUG_COMPILER_OPTIONS% %PROJECT_FILES_DIRS_AND_LIBS%
     )
@@ -49,7 +49,10 @@ namespace GRAPHICS
         float orthographic_view_volume_height = top_y_world_boundary - bottom_y_world_boundary;
         scale_vector.Y = CANONICAL_VIEW_VOLUME_DIMENSION / orthographic_view_volume_height;
 
-        float orthographic_view_volume_depth = near_z_world_boundary - far_z_world_boundary;
+        // The canonical view volume has its near plane at -1 and its far plane at +1, while the view
+        // volume's far boundary has a smaller z coordinate than its near boundary, so z gets flipped.
+        // Otherwise, farther points would get smaller depths and win depth tests against nearer points.
+        float orthographic_view_volume_depth = far_z_world_boundary - near_z_world_boundary;
         scale_vector.Z = CANONICAL_VIEW_VOLUME_DIMENSION / orthographic_view_volume_depth;
 
         MATH::Matrix4x4f scale_view_volume_matrix = MATH::Matrix4x4f::Scale(scale_vector);
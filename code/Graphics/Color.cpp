@@ -17,4 +17,29 @@ namespace GRAPHICS
     Blue(blue),
     Alpha(alpha)
     {}
+
+    /// Equality operator.  Direct equality comparison is used for components,
+    /// so floating-point precision should be considered when using this operator.
+    /// @param[in]  rhs - The color to compare with.
+    /// @return True if this color and the provided color are equal; false otherwise.
+    bool Color::operator==(const Color& rhs) const
+    {
+        // Make sure all fields are equal.
+        if (Red != rhs.Red) return false;
+        if (Green != rhs.Green) return false;
+        if (Blue != rhs.Blue) return false;
+        if (Alpha != rhs.Alpha) return false;
+
+        // All fields were equal.
+        return true;
+    }
+
+    /// Inequality operator.
+    /// @param[in]  rhs - The color to compare with.
+    /// @return True if this color and the provided color aren't equal; false otherwise.
+    bool Color::operator!=(const Color& rhs) const
+    {
+        bool colors_equal = ((*this) == rhs);
+        return !colors_equal;
+    }
 }
@@ -15,6 +15,10 @@ namespace GRAPHICS
             const float blue = 0.0f,
             const float alpha = 1.0f);
 
+        // OPERATORS.
+        bool operator==(const Color& rhs) const;
+        bool operator!=(const Color& rhs) const;
+
         // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
         /// The red component of the color.
         float Red = 0.0f;
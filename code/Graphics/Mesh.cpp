@@ -0,0 +1,31 @@
+#include "Graphics/Mesh.h"
+
+namespace GRAPHICS
+{
+    /// Creates a new mesh, taking ownership of the provided vertices without copying them.
+    /// The mesh and its reference count are allocated together in a single allocation.
+    /// @param[in]  vertices - The vertices of the mesh.
+    /// @return The new mesh.
+    std::shared_ptr<const Mesh> Mesh::Create(std::vector<Vertex>&& vertices)
+    {
+        std::shared_ptr<const Mesh> mesh = std::make_shared<Mesh>(std::move(vertices));
+        return mesh;
+    }
+
+    /// Creates a new mesh with a copy of the provided vertices.
+    /// @param[in]  vertices - The vertices of the mesh.
+    /// @return The new mesh.
+    std::shared_ptr<const Mesh> Mesh::Create(const std::vector<Vertex>& vertices)
+    {
+        std::vector<Vertex> vertices_copy = vertices;
+        std::shared_ptr<const Mesh> mesh = Create(std::move(vertices_copy));
+        return mesh;
+    }
+
+    /// Constructor.  Prefer Create() so that the mesh can only be shared immutably.
+    /// @param[in]  vertices - The vertices of the mesh.
+    Mesh::Mesh(std::vector<Vertex>&& vertices) :
+        Vertices(std::move(vertices)),
+        Version(0)
+    {}
+}
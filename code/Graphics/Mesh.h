@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "Graphics/Vertex.h"
+
+namespace GRAPHICS
+{
+    /// Geometry that may be shared by many objects.  Meshes are only ever shared
+    /// as std::shared_ptr<const Mesh>, so any number of objects can reference the same
+    /// vertices without copying them.  An object that needs to change a mesh another
+    /// object also references gets its own copy first (copy-on-write).  An object that
+    /// is the only one referencing a mesh changes it in place, updating its version.
+    class Mesh
+    {
+    public:
+        // CREATION.
+        static std::shared_ptr<const Mesh> Create(std::vector<Vertex>&& vertices);
+        static std::shared_ptr<const Mesh> Create(const std::vector<Vertex>& vertices);
+
+        // CONSTRUCTION.
+        explicit Mesh(std::vector<Vertex>&& vertices);
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The vertices of the mesh, in the local coordinate space of objects using the mesh.
+        std::vector<Vertex> Vertices;
+        /// The version (from the VertexChangeTracker of the object that made the change) of the
+        /// last change to the vertices.  0 if the vertices haven't changed since the mesh was created.
+        uint64_t Version;
+    };
+}
@@ -1,7 +1,90 @@
+#include <stdexcept>
 #include "Graphics/Object3D.h"
 
 namespace GRAPHICS
 {
+    /// Constructor to create an object that shares an existing mesh.
+    /// @param[in]  mesh - The mesh of the object.  May be null for an object without vertices.
+    Object3D::Object3D(std::shared_ptr<const Mesh> mesh) :
+        SharedMesh(std::move(mesh))
+    {}
+
+    /// Gets the mesh of the object, which may be shared with other objects.
+    /// @return The object's mesh.  Null if the object has no vertices.
+    const std::shared_ptr<const Mesh>& Object3D::GetMesh() const
+    {
+        return SharedMesh;
+    }
+
+    /// Sets the mesh of the object, sharing it with any other objects using it.
+    /// @param[in]  mesh - The new mesh of the object.  May be null to remove all vertices.
+    void Object3D::SetMesh(std::shared_ptr<const Mesh> mesh)
+    {
+        SharedMesh = std::move(mesh);
+        VertexChanges.MarkAllChanged();
+    }
+
+    /// Gets the vertices of the object.
+    /// @return The object's vertices, in the local coordinate space of the object.
+    const std::vector<Vertex>& Object3D::GetVertices() const
+    {
+        bool mesh_exists = (nullptr != SharedMesh);
+        if (!mesh_exists)
+        {
+            static const std::vector<Vertex> NO_VERTICES;
+            return NO_VERTICES;
+        }
+
+        return SharedMesh->Vertices;
+    }
+
+    /// Replaces all vertices of the object, recording the change.  The vertices are
+    /// moved rather than copied, and the object's existing mesh is reused if no other
+    /// objects are sharing it.
+    /// @param[in]  vertices - The new vertices, in the local coordinate space of the object.
+    void Object3D::SetVertices(std::vector<Vertex>&& vertices)
+    {
+        bool mesh_shared = (nullptr == SharedMesh) || (SharedMesh.use_count() > 1);
+        if (mesh_shared)
+        {
+            SharedMesh = Mesh::Create(std::move(vertices));
+        }
+        else
+        {
+            UniqueMesh().Vertices = std::move(vertices);
+        }
+
+        // RECORD THE CHANGE.
+        // The object is now the only one referencing its mesh, so stamping the version can't copy the mesh.
+        VertexChanges.MarkAllChanged();
+        UniqueMesh().Version = VertexChanges.Version;
+    }
+
+    /// Sets a single vertex of the object, recording the change.  If the object's mesh
+    /// is shared with other objects, the object gets its own copy of the mesh first.
+    /// @param[in]  index - The index of the vertex to set.
+    /// @param[in]  vertex - The new vertex.
+    /// @throws std::out_of_range - Thrown if the index is invalid.
+    void Object3D::SetVertex(const std::size_t index, const Vertex& vertex)
+    {
+        // MAKE SURE THE INDEX IS VALID.
+        // This is checked before copying any shared mesh to avoid a needless copy.
+        bool index_valid = (index < GetVertices().size());
+        if (!index_valid)
+        {
+            throw std::out_of_range("Vertex index out of range for object.");
+        }
+
+        // SET THE VERTEX.
+        Mesh& unique_mesh = UniqueMesh();
+        unique_mesh.Vertices[index] = vertex;
+
+        // RECORD THE CHANGE.
+        const std::size_t ONE_VERTEX = 1;
+        VertexChanges.MarkChanged(index, ONE_VERTEX);
+        unique_mesh.Version = VertexChanges.Version;
+    }
+
     /// Gets the world transformation matrix of the object.
     /// @return The object's world transform.
     MATH::Matrix4x4f Object3D::WorldTransform() const
@@ -12,4 +95,23 @@ namespace GRAPHICS
         MATH::Matrix4x4f world_transform = translation_matrix * rotation_matrix;
         return world_transform;
     }
-}
+
+    /// Gets a mesh that only this object references so that it can be changed,
+    /// copying the current mesh first if other objects are sharing it.
+    /// @return The object's own mesh.
+    Mesh& Object3D::UniqueMesh()
+    {
+        // COPY THE MESH IF OTHER OBJECTS ARE SHARING IT.
+        bool mesh_shared = (nullptr == SharedMesh) || (SharedMesh.use_count() > 1);
+        if (mesh_shared)
+        {
+            SharedMesh = Mesh::Create(GetVertices());
+        }
+
+        // Meshes are always created as non-const objects by Mesh::Create() and only shared
+        // as const to keep other objects from changing them.  Since no other objects
+        // reference this mesh, changing it is safe.
+        Mesh& unique_mesh = const_cast<Mesh&>(*SharedMesh);
+        return unique_mesh;
+    }
+}
\ No newline at end of file
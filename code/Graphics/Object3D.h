@@ -1,7 +1,10 @@
 #pragma once
 
+#include <memory>
 #include <vector>
+#include "Graphics/Mesh.h"
 #include "Graphics/Vertex.h"
+#include "Graphics/VertexChangeTracker.h"
 #include "Math/Angle.h"
 #include "Math/Matrix4x4.h"
 #include "Math/Vector3.h"
@@ -9,18 +12,45 @@
 namespace GRAPHICS
 {
     /// A generic object that exists in a 3D space.
+    ///
+    /// The geometry of an object is held in a mesh that may be shared with other objects,
+    /// so copying an object doesn't copy its vertices.  Changing the vertices of an object
+    /// only copies the mesh if other objects are still sharing it.
     class Object3D
     {
     public:
+        // CONSTRUCTION.
+        /// Default constructor to create an object without any vertices.
+        explicit Object3D() = default;
+        explicit Object3D(std::shared_ptr<const Mesh> mesh);
+
+        // MESH ACCESS/MODIFICATION.
+        const std::shared_ptr<const Mesh>& GetMesh() const;
+        void SetMesh(std::shared_ptr<const Mesh> mesh);
+        const std::vector<Vertex>& GetVertices() const;
+        void SetVertices(std::vector<Vertex>&& vertices);
+        void SetVertex(const std::size_t index, const Vertex& vertex);
+
         // METHODS.
         MATH::Matrix4x4f WorldTransform() const;
 
         // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
-        /// The vertices of the object, in the local coordinate space of the object.
-        std::vector<Vertex> Vertices = {};
+        /// Tracks changes to the object's vertices so that only changed vertices need
+        /// to be updated on graphics devices.  All methods that change the object's
+        /// vertices record their changes here.
+        VertexChangeTracker VertexChanges = VertexChangeTracker();
         /// The world position of the object.
         MATH::Vector3f WorldPosition = MATH::Vector3f();
         /// The rotation of the object along the 3 primary axes, expressed in radians per axis.
         MATH::Vector3< MATH::Angle<float>::Radians > RotationInRadians = MATH::Vector3< MATH::Angle<float>::Radians >();
+
+    private:
+        // HELPER METHODS.
+        Mesh& UniqueMesh();
+
+        // MEMBER VARIABLES.
+        /// The mesh holding the vertices of the object, in the local coordinate space of the object.
+        /// Null if the object has no vertices.
+        std::shared_ptr<const Mesh> SharedMesh = nullptr;
     };
 }
@@ -0,0 +1,180 @@
+#include <algorithm>
+#include <stdexcept>
+#include "Graphics/OpenGL/BuddyAllocator.h"
+
+namespace GRAPHICS
+{
+namespace OPEN_GL
+{
+    /// Constructor.
+    /// @param[in]  total_size - The total size to manage.  Must be a power of two.
+    /// @param[in]  min_block_size - The size of the smallest blocks that can be allocated.
+    ///     Must be a power of two no larger than the total size.
+    /// @throws std::invalid_argument - Thrown if the sizes are invalid.
+    BuddyAllocator::BuddyAllocator(const uint64_t total_size, const uint64_t min_block_size) :
+        TotalSize(total_size),
+        MinBlockSize(min_block_size),
+        FreeBlockOffsetsByLevel(),
+        AllocatedBlockLevelsByOffset(),
+        AllocatedBlockSize(0)
+    {
+        // MAKE SURE THE SIZES ARE VALID.
+        auto is_power_of_two = [](const uint64_t size) { return (size > 0) && (0 == (size & (size - 1))); };
+        bool sizes_valid = (
+            is_power_of_two(TotalSize) &&
+            is_power_of_two(MinBlockSize) &&
+            (MinBlockSize <= TotalSize));
+        if (!sizes_valid)
+        {
+            throw std::invalid_argument("Buddy allocator sizes must be powers of two with the minimum block size no larger than the total size.");
+        }
+
+        // CREATE THE LEVELS, WITH THE ENTIRE SIZE INITIALLY FREE.
+        unsigned int level_count = BlockLevel(MinBlockSize) + 1;
+        FreeBlockOffsetsByLevel.resize(level_count);
+        const uint64_t START_OFFSET = 0;
+        FreeBlockOffsetsByLevel.front().insert(START_OFFSET);
+    }
+
+    /// Allocates a block large enough to hold the requested size.
+    /// @param[in]  size - The size to allocate.
+    /// @param[out] offset - The offset of the allocated block, if successful.
+    /// @return True if allocation succeeded; false if no large enough block is free.
+    bool BuddyAllocator::Allocate(const uint64_t size, uint64_t& offset)
+    {
+        // MAKE SURE THE SIZE CAN EVER BE ALLOCATED.
+        bool size_allocatable = (size > 0) && (size <= TotalSize);
+        if (!size_allocatable)
+        {
+            return false;
+        }
+
+        // FIND THE SMALLEST FREE BLOCK THAT'S LARGE ENOUGH.
+        // Levels are searched from the requested size upward toward larger blocks.
+        unsigned int requested_level = BlockLevel(size);
+        int free_block_level = static_cast<int>(requested_level);
+        while ((free_block_level >= 0) && FreeBlockOffsetsByLevel[free_block_level].empty())
+        {
+            --free_block_level;
+        }
+        bool free_block_found = (free_block_level >= 0);
+        if (!free_block_found)
+        {
+            return false;
+        }
+
+        // TAKE THE FREE BLOCK WITH THE LOWEST OFFSET.
+        std::set<uint64_t>& free_block_offsets = FreeBlockOffsetsByLevel[free_block_level];
+        uint64_t block_offset = *free_block_offsets.begin();
+        free_block_offsets.erase(free_block_offsets.begin());
+
+        // SPLIT THE BLOCK UNTIL IT'S THE REQUESTED SIZE.
+        // The lower half is kept each time, and the upper half (its buddy) becomes free.
+        for (unsigned int level = static_cast<unsigned int>(free_block_level) + 1; level <= requested_level; ++level)
+        {
+            uint64_t buddy_offset = block_offset + LevelBlockSize(level);
+            FreeBlockOffsetsByLevel[level].insert(buddy_offset);
+        }
+
+        // TRACK THE ALLOCATED BLOCK.
+        AllocatedBlockLevelsByOffset[block_offset] = requested_level;
+        AllocatedBlockSize += LevelBlockSize(requested_level);
+        offset = block_offset;
+        return true;
+    }
+
+    /// Frees a previously allocated block, merging it with its buddy if possible.
+    /// @param[in]  offset - The offset of the block to free.  Nothing happens if not allocated.
+    void BuddyAllocator::Free(const uint64_t offset)
+    {
+        // MAKE SURE THE BLOCK IS ALLOCATED.
+        auto allocated_block = AllocatedBlockLevelsByOffset.find(offset);
+        bool block_allocated = (AllocatedBlockLevelsByOffset.end() != allocated_block);
+        if (!block_allocated)
+        {
+            return;
+        }
+
+        // STOP TRACKING THE ALLOCATED BLOCK.
+        unsigned int level = allocated_block->second;
+        AllocatedBlockLevelsByOffset.erase(allocated_block);
+        AllocatedBlockSize -= LevelBlockSize(level);
+
+        // MERGE THE BLOCK WITH ITS BUDDY FOR AS LONG AS THE BUDDY IS FREE.
+        uint64_t block_offset = offset;
+        while (level > 0)
+        {
+            // Buddies only differ in the bit corresponding to their block size.
+            uint64_t buddy_offset = block_offset ^ LevelBlockSize(level);
+            std::set<uint64_t>& free_block_offsets = FreeBlockOffsetsByLevel[level];
+            auto free_buddy = free_block_offsets.find(buddy_offset);
+            bool buddy_free = (free_block_offsets.end() != free_buddy);
+            if (!buddy_free)
+            {
+                break;
+            }
+
+            free_block_offsets.erase(free_buddy);
+            block_offset = std::min(block_offset, buddy_offset);
+            --level;
+        }
+
+        // MARK THE (POSSIBLY MERGED) BLOCK AS FREE.
+        FreeBlockOffsetsByLevel[level].insert(block_offset);
+    }
+
+    /// Gets the size of an allocated block.
+    /// @param[in]  offset - The offset of the block.
+    /// @return The size of the block; 0 if no block is allocated at the offset.
+    uint64_t BuddyAllocator::BlockSize(const uint64_t offset) const
+    {
+        auto allocated_block = AllocatedBlockLevelsByOffset.find(offset);
+        bool block_allocated = (AllocatedBlockLevelsByOffset.cend() != allocated_block);
+        if (!block_allocated)
+        {
+            return 0;
+        }
+
+        uint64_t block_size = LevelBlockSize(allocated_block->second);
+        return block_size;
+    }
+
+    /// Determines if no blocks are allocated.
+    /// @return True if no blocks are allocated; false otherwise.
+    bool BuddyAllocator::Empty() const
+    {
+        return AllocatedBlockLevelsByOffset.empty();
+    }
+
+    /// Gets the total size of all allocated blocks, including space lost to rounding.
+    /// @return The total allocated size.
+    uint64_t BuddyAllocator::AllocatedSize() const
+    {
+        return AllocatedBlockSize;
+    }
+
+    /// Gets the level of the smallest block that can hold the provided size.
+    /// @param[in]  size - The size that must fit in the block.  Must be no larger than the total size.
+    /// @return The level of the block.
+    unsigned int BuddyAllocator::BlockLevel(const uint64_t size) const
+    {
+        unsigned int level = 0;
+        uint64_t block_size = TotalSize;
+        while ((block_size / 2 >= size) && (block_size / 2 >= MinBlockSize))
+        {
+            block_size /= 2;
+            ++level;
+        }
+        return level;
+    }
+
+    /// Gets the size of blocks at a level.
+    /// @param[in]  level - The level of the blocks.
+    /// @return The size of blocks at the level.
+    uint64_t BuddyAllocator::LevelBlockSize(const unsigned int level) const
+    {
+        uint64_t block_size = TotalSize >> level;
+        return block_size;
+    }
+}
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+namespace GRAPHICS
+{
+namespace OPEN_GL
+{
+    /// Sub-allocates ranges from a larger block of memory using a buddy allocation scheme.
+    /// The allocator only tracks offsets and sizes (in arbitrary units), so it can manage
+    /// memory that isn't directly accessible, like buffers on a graphics device.
+    ///
+    /// The total size is split into power-of-two blocks.  Allocations are rounded up to
+    /// the nearest block size, and larger blocks are split in half ("buddies") as needed.
+    /// When both buddies are free, they are merged back into the larger block, which keeps
+    /// fragmentation bounded and makes allocating and freeing cheap.
+    class BuddyAllocator
+    {
+    public:
+        // CONSTRUCTION.
+        explicit BuddyAllocator(const uint64_t total_size, const uint64_t min_block_size);
+
+        // ALLOCATION.
+        bool Allocate(const uint64_t size, uint64_t& offset);
+        void Free(const uint64_t offset);
+        uint64_t BlockSize(const uint64_t offset) const;
+
+        // STATISTICS.
+        bool Empty() const;
+        uint64_t AllocatedSize() const;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The total size managed by the allocator.  Always a power of two.
+        uint64_t TotalSize;
+        /// The size of the smallest blocks that can be allocated.  Always a power of two.
+        uint64_t MinBlockSize;
+
+    private:
+        // HELPER METHODS.
+        unsigned int BlockLevel(const uint64_t size) const;
+        uint64_t LevelBlockSize(const unsigned int level) const;
+
+        // MEMBER VARIABLES.
+        /// The offsets of free blocks at each level.  Level 0 holds blocks of the total size,
+        /// and each subsequent level holds blocks half the size of the previous level.
+        /// Sets are used so that the lowest free offsets are preferred, which keeps
+        /// allocations packed toward the start of the memory.
+        std::vector< std::set<uint64_t> > FreeBlockOffsetsByLevel;
+        /// The levels of all allocated blocks, keyed by offset.
+        std::unordered_map<uint64_t, unsigned int> AllocatedBlockLevelsByOffset;
+        /// The total size of all allocated blocks.
+        uint64_t AllocatedBlockSize;
+    };
+}
+}
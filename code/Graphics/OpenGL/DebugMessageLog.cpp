@@ -0,0 +1,172 @@
+#include "Graphics/OpenGL/DebugMessageLog.h"
+
+namespace GRAPHICS
+{
+namespace OPEN_GL
+{
+    /// Constructor.
+    DebugMessageLog::DebugMessageLog() :
+        LoggedMessageCount(0),
+        SuppressedMessageCount(0),
+        Mutex(),
+        MessageIdRates()
+    {}
+
+    /// Logs a debug message, unless too many messages with the same ID have been logged recently.
+    /// @param[in]  source - The source of the message (for example, GL_DEBUG_SOURCE_API).
+    /// @param[in]  type - The type of the message (for example, GL_DEBUG_TYPE_ERROR).
+    /// @param[in]  id - The driver-specific ID of the message.
+    /// @param[in]  severity - The severity of the message (for example, GL_DEBUG_SEVERITY_HIGH).
+    /// @param[in]  message - The text of the message.
+    void DebugMessageLog::Log(
+        const GLenum source,
+        const GLenum type,
+        const GLuint id,
+        const GLenum severity,
+        const std::string& message)
+    {
+        std::lock_guard<std::mutex> lock(Mutex);
+
+        // START A NEW RATE LIMIT PERIOD FOR THE MESSAGE ID IF THE PREVIOUS ONE IS OVER.
+        const std::chrono::seconds RATE_LIMIT_PERIOD(1);
+        MessageIdRate& message_id_rate = MessageIdRates[id];
+        auto current_time = std::chrono::steady_clock::now();
+        bool rate_limit_period_over = ((current_time - message_id_rate.PeriodStartTime) >= RATE_LIMIT_PERIOD);
+        if (rate_limit_period_over)
+        {
+            message_id_rate.PeriodStartTime = current_time;
+            message_id_rate.PeriodMessageCount = 0;
+        }
+
+        // SUPPRESS THE MESSAGE IF TOO MANY WITH THE SAME ID HAVE BEEN LOGGED IN THIS PERIOD.
+        ++message_id_rate.PeriodMessageCount;
+        bool message_rate_limited = (message_id_rate.PeriodMessageCount > MAX_LOGGED_MESSAGES_PER_ID_PER_PERIOD);
+        if (message_rate_limited)
+        {
+            ++message_id_rate.SuppressedMessageCount;
+            ++SuppressedMessageCount;
+            return;
+        }
+
+        // FORMAT THE MESSAGE.
+        std::string log_message = "OpenGL ";
+        log_message += SeverityName(severity);
+        log_message += " ";
+        log_message += TypeName(type);
+        log_message += " from ";
+        log_message += SourceName(source);
+        log_message += " (ID " + std::to_string(id) + "): ";
+        log_message += message;
+        bool messages_suppressed = (message_id_rate.SuppressedMessageCount > 0);
+        if (messages_suppressed)
+        {
+            log_message += " [" + std::to_string(message_id_rate.SuppressedMessageCount) + " previous messages with this ID suppressed]";
+            message_id_rate.SuppressedMessageCount = 0;
+        }
+        log_message += "\n";
+
+        // LOG THE MESSAGE.
+        /// @todo   Log via a better mechanism.
+        OutputDebugString(log_message.c_str());
+        ++LoggedMessageCount;
+    }
+
+    /// Handles a debug message reported by the OpenGL driver.  Registered with glDebugMessageCallback().
+    /// @param[in]  source - The source of the message.
+    /// @param[in]  type - The type of the message.
+    /// @param[in]  id - The driver-specific ID of the message.
+    /// @param[in]  severity - The severity of the message.
+    /// @param[in]  length - The length of the message, not including the null terminator.
+    /// @param[in]  message - The null-terminated text of the message.
+    /// @param[in]  debug_message_log - The DebugMessageLog in which to log the message.
+    void APIENTRY DebugMessageLog::HandleDebugMessage(
+        GLenum source,
+        GLenum type,
+        GLuint id,
+        GLenum severity,
+        GLsizei length,
+        const GLchar* message,
+        const void* debug_message_log)
+    {
+        // MAKE SURE A LOG WAS PROVIDED.
+        bool debug_message_log_exists = (nullptr != debug_message_log);
+        if (!debug_message_log_exists)
+        {
+            return;
+        }
+
+        // LOG THE MESSAGE.
+        // The user parameter is always registered as a non-const log, so casting away const is safe.
+        DebugMessageLog* log = const_cast<DebugMessageLog*>(static_cast<const DebugMessageLog*>(debug_message_log));
+        std::string message_text(message, static_cast<std::size_t>(length));
+        log->Log(source, type, id, severity, message_text);
+    }
+
+    /// Gets a readable name for the source of a debug message.
+    /// @param[in]  source - The source of the message.
+    /// @return The name of the source.
+    const char* DebugMessageLog::SourceName(const GLenum source)
+    {
+        switch (source)
+        {
+            case GL_DEBUG_SOURCE_API:
+                return "API";
+            case GL_DEBUG_SOURCE_WINDOW_SYSTEM:
+                return "window system";
+            case GL_DEBUG_SOURCE_SHADER_COMPILER:
+                return "shader compiler";
+            case GL_DEBUG_SOURCE_THIRD_PARTY:
+                return "third party";
+            case GL_DEBUG_SOURCE_APPLICATION:
+                return "application";
+            case GL_DEBUG_SOURCE_OTHER:
+            default:
+                return "other";
+        }
+    }
+
+    /// Gets a readable name for the type of a debug message.
+    /// @param[in]  type - The type of the message.
+    /// @return The name of the type.
+    const char* DebugMessageLog::TypeName(const GLenum type)
+    {
+        switch (type)
+        {
+            case GL_DEBUG_TYPE_ERROR:
+                return "error";
+            case GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR:
+                return "deprecated behavior";
+            case GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR:
+                return "undefined behavior";
+            case GL_DEBUG_TYPE_PORTABILITY:
+                return "portability";
+            case GL_DEBUG_TYPE_PERFORMANCE:
+                return "performance";
+            case GL_DEBUG_TYPE_MARKER:
+                return "marker";
+            case GL_DEBUG_TYPE_OTHER:
+            default:
+                return "other";
+        }
+    }
+
+    /// Gets a readable name for the severity of a debug message.
+    /// @param[in]  severity - The severity of the message.
+    /// @return The name of the severity.
+    const char* DebugMessageLog::SeverityName(const GLenum severity)
+    {
+        switch (severity)
+        {
+            case GL_DEBUG_SEVERITY_HIGH:
+                return "high severity";
+            case GL_DEBUG_SEVERITY_MEDIUM:
+                return "medium severity";
+            case GL_DEBUG_SEVERITY_LOW:
+                return "low severity";
+            case GL_DEBUG_SEVERITY_NOTIFICATION:
+            default:
+                return "notification";
+        }
+    }
+}
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include "Graphics/OpenGL/OpenGL.h"
+
+namespace GRAPHICS
+{
+namespace OPEN_GL
+{
+    /// Logs debug messages reported by the OpenGL driver (via KHR_debug or OpenGL 4.3).
+    /// Messages are reported asynchronously as they occur, which avoids having to poll
+    /// glGetError() (which can force the CPU to wait for the GPU on some drivers).
+    ///
+    /// Since the same message may be reported every time an operation happens (potentially
+    /// many times per frame), messages are rate limited per message ID.  Only a limited
+    /// number of messages with each ID are logged per period, and the number suppressed
+    /// is logged along with the first message of the next period.
+    class DebugMessageLog
+    {
+    public:
+        // CONSTANTS.
+        /// The maximum number of messages with the same ID logged per rate limit period.
+        static const unsigned int MAX_LOGGED_MESSAGES_PER_ID_PER_PERIOD = 5;
+
+        // CONSTRUCTION.
+        explicit DebugMessageLog();
+
+        // LOGGING.
+        void Log(
+            const GLenum source,
+            const GLenum type,
+            const GLuint id,
+            const GLenum severity,
+            const std::string& message);
+        static void APIENTRY HandleDebugMessage(
+            GLenum source,
+            GLenum type,
+            GLuint id,
+            GLenum severity,
+            GLsizei length,
+            const GLchar* message,
+            const void* debug_message_log);
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The total number of messages logged.
+        uint64_t LoggedMessageCount;
+        /// The total number of messages suppressed due to rate limiting.
+        uint64_t SuppressedMessageCount;
+
+    private:
+        // PRIVATE TYPES.
+        /// Tracks how often messages with a single ID have been reported.
+        struct MessageIdRate
+        {
+            /// When the current rate limit period for the ID started.
+            std::chrono::steady_clock::time_point PeriodStartTime = {};
+            /// The number of messages with the ID reported in the current period.
+            unsigned int PeriodMessageCount = 0;
+            /// The number of messages with the ID suppressed since a message was last logged.
+            unsigned int SuppressedMessageCount = 0;
+        };
+
+        // HELPER METHODS.
+        static const char* SourceName(const GLenum source);
+        static const char* TypeName(const GLenum type);
+        static const char* SeverityName(const GLenum severity);
+
+        // MEMBER VARIABLES.
+        /// Guards access to the log since drivers may report messages from other threads.
+        std::mutex Mutex;
+        /// How often messages with each ID have been reported, keyed by message ID.
+        std::unordered_map<GLuint, MessageIdRate> MessageIdRates;
+    };
+}
+}
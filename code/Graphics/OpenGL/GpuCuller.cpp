@@ -0,0 +1,412 @@
+#include <Windows.h>
+#include "Graphics/OpenGL/GpuCuller.h"
+
+namespace GRAPHICS
+{
+namespace OPEN_GL
+{
+    /// The code for the compute shader that culls objects.  One invocation tests each object.
+    const char* const CULLING_COMPUTE_SHADER_CODE = R"(
+        // GLSL 4.30.
+        #version 430
+
+        layout(local_size_x = 64) in;
+
+        // The per-instance data of an object, in the layout read by the instanced position-color shader program.
+        struct ObjectInstance
+        {
+            vec4 world_transform_rows[4];
+            vec4 color;
+        };
+
+        // The data for culling an object (see GpuCuller::CullingObject).
+        struct CullingObject
+        {
+            vec4 object_space_bounding_sphere;
+            uint first_vertex;
+            uint vertex_count;
+            uint unused[2];
+        };
+
+        // A draw command in the layout defined by OpenGL.
+        struct DrawArraysIndirectCommand
+        {
+            uint vertex_count;
+            uint instance_count;
+            uint first_vertex;
+            uint base_instance;
+        };
+
+        layout(std430, binding = 0) readonly buffer ObjectInstances
+        {
+            ObjectInstance object_instances[];
+        };
+        layout(std430, binding = 1) readonly buffer CullingObjects
+        {
+            CullingObject culling_objects[];
+        };
+        layout(std430, binding = 2) writeonly buffer DrawCommands
+        {
+            DrawArraysIndirectCommand draw_commands[];
+        };
+        layout(std430, binding = 3) buffer DrawCount
+        {
+            uint draw_count;
+        };
+
+        uniform mat4 view_projection_transform;
+
+        void main()
+        {
+            // MAKE SURE THIS INVOCATION HAS AN OBJECT.
+            // The last work group may extend past the end of the objects.
+            uint object_index = gl_GlobalInvocationID.x;
+            uint object_count = uint(culling_objects.length());
+            if (object_index >= object_count)
+            {
+                return;
+            }
+
+            // TRANSFORM THE OBJECT'S BOUNDING SPHERE INTO WORLD SPACE.
+            // The radius is scaled by the largest scale along any axis so that the sphere stays conservative.
+            ObjectInstance object_instance = object_instances[object_index];
+            mat4 world_transform = transpose(mat4(
+                object_instance.world_transform_rows[0],
+                object_instance.world_transform_rows[1],
+                object_instance.world_transform_rows[2],
+                object_instance.world_transform_rows[3]));
+            CullingObject culling_object = culling_objects[object_index];
+            vec4 object_space_bounding_sphere = culling_object.object_space_bounding_sphere;
+            vec3 world_center = (world_transform * vec4(object_space_bounding_sphere.xyz, 1.0)).xyz;
+            float max_scale = max(
+                length(world_transform[0].xyz),
+                max(length(world_transform[1].xyz), length(world_transform[2].xyz)));
+            float world_radius = object_space_bounding_sphere.w * max_scale;
+
+            // TEST THE BOUNDING SPHERE AGAINST EACH FRUSTUM PLANE.
+            // The planes are extracted from the rows of the view-projection transform, with normals
+            // pointing into the frustum.  Transposing gives access to the rows as columns.
+            mat4 view_projection_rows = transpose(view_projection_transform);
+            vec4 frustum_planes[6] = vec4[6](
+                view_projection_rows[3] + view_projection_rows[0],
+                view_projection_rows[3] - view_projection_rows[0],
+                view_projection_rows[3] + view_projection_rows[1],
+                view_projection_rows[3] - view_projection_rows[1],
+                view_projection_rows[3] + view_projection_rows[2],
+                view_projection_rows[3] - view_projection_rows[2]);
+            for (int plane_index = 0; plane_index < 6; ++plane_index)
+            {
+                vec4 frustum_plane = frustum_planes[plane_index];
+                float signed_distance = dot(frustum_plane.xyz, world_center) + frustum_plane.w;
+                bool sphere_outside_plane = (signed_distance < -world_radius * length(frustum_plane.xyz));
+                if (sphere_outside_plane)
+                {
+                    return;
+                }
+            }
+
+            // APPEND A DRAW COMMAND FOR THE VISIBLE OBJECT.
+            // The base instance selects the object's per-instance data.
+            uint draw_index = atomicAdd(draw_count, 1u);
+            draw_commands[draw_index] = DrawArraysIndirectCommand(
+                culling_object.vertex_count,
+                1u,
+                culling_object.first_vertex,
+                object_index);
+        }
+    )";
+
+    /// Attempts to create a GPU culler, compiling its compute shader.
+    /// @return The GPU culler, if compute shaders and multi-draw indirect rendering are supported; null otherwise.
+    std::unique_ptr<GpuCuller> GpuCuller::Create()
+    {
+        // MAKE SURE THE REQUIRED FUNCTIONS ARE SUPPORTED.
+        bool required_functions_loaded = (
+            (nullptr != glDispatchCompute) &&
+            (nullptr != glMemoryBarrier) &&
+            (nullptr != glBindBufferBase) &&
+            (nullptr != glClearBufferData) &&
+            (nullptr != glMultiDrawArraysIndirect));
+        if (!required_functions_loaded)
+        {
+            return nullptr;
+        }
+
+        // COMPILE THE COMPUTE SHADER.
+        GLuint compute_shader_id = glCreateShader(GL_COMPUTE_SHADER);
+        const GLsizei ONE_SOURCE_STRING = 1;
+        const GLint* const SOURCE_STRINGS_NULL_TERMINATED = nullptr;
+        glShaderSource(compute_shader_id, ONE_SOURCE_STRING, &CULLING_COMPUTE_SHADER_CODE, SOURCE_STRINGS_NULL_TERMINATED);
+        glCompileShader(compute_shader_id);
+
+        GLint compute_shader_compile_status = GL_FALSE;
+        glGetShaderiv(compute_shader_id, GL_COMPILE_STATUS, &compute_shader_compile_status);
+        bool compute_shader_compiled = (GL_TRUE == compute_shader_compile_status);
+        if (!compute_shader_compiled)
+        {
+            char compile_log_buffer[512];
+            GLsizei* const LENGTH_OF_LOG_NOT_NEEDED = nullptr;
+            glGetShaderInfoLog(
+                compute_shader_id,
+                sizeof(compile_log_buffer) / sizeof(compile_log_buffer[0]),
+                LENGTH_OF_LOG_NOT_NEEDED,
+                compile_log_buffer);
+            /// @todo   Log via a better mechanism.
+            OutputDebugString("Culling compute shader compile error: ");
+            OutputDebugString(compile_log_buffer);
+            glDeleteShader(compute_shader_id);
+            return nullptr;
+        }
+
+        // LINK THE COMPUTE SHADER PROGRAM.
+        // The shader is flagged for deletion right away so that it's deleted along with the program.
+        GLuint compute_program_id = glCreateProgram();
+        glAttachShader(compute_program_id, compute_shader_id);
+        glLinkProgram(compute_program_id);
+        glDeleteShader(compute_shader_id);
+
+        GLint compute_program_link_status = GL_FALSE;
+        glGetProgramiv(compute_program_id, GL_LINK_STATUS, &compute_program_link_status);
+        bool compute_program_linked = (GL_TRUE == compute_program_link_status);
+        if (!compute_program_linked)
+        {
+            char link_log_buffer[512];
+            GLsizei* const LENGTH_OF_LOG_NOT_NEEDED = nullptr;
+            glGetProgramInfoLog(
+                compute_program_id,
+                sizeof(link_log_buffer) / sizeof(link_log_buffer[0]),
+                LENGTH_OF_LOG_NOT_NEEDED,
+                link_log_buffer);
+            /// @todo   Log via a better mechanism.
+            OutputDebugString("Culling compute shader program link error: ");
+            OutputDebugString(link_log_buffer);
+            glDeleteProgram(compute_program_id);
+            return nullptr;
+        }
+
+        // CREATE THE BUFFERS.
+        // If direct state access is supported, the buffers must be created immediately
+        // (rather than on first bind) so that they can be filled without binding them.
+        const GLsizei BUFFER_COUNT = 4;
+        GLuint buffer_ids[BUFFER_COUNT] = {};
+        if (DirectStateAccessSupported())
+        {
+            glCreateBuffers(BUFFER_COUNT, buffer_ids);
+        }
+        else
+        {
+            glGenBuffers(BUFFER_COUNT, buffer_ids);
+        }
+        std::unique_ptr<GpuCuller> gpu_culler = std::make_unique<GpuCuller>(
+            compute_program_id,
+            buffer_ids[0],
+            buffer_ids[1],
+            buffer_ids[2],
+            buffer_ids[3]);
+
+        // ALLOCATE THE DRAW COUNT.
+        // It is written by the GPU every frame.
+        const void* const NO_INITIAL_DATA = nullptr;
+        FillBuffer(gpu_culler->DrawCountBufferId, sizeof(GLuint), NO_INITIAL_DATA, GL_DYNAMIC_COPY);
+        return gpu_culler;
+    }
+
+    /// Constructor.
+    /// @param[in]  compute_program_id - The ID of the linked culling compute shader program.
+    /// @param[in]  object_instance_buffer_id - The ID of the buffer to hold per-instance data for objects.
+    /// @param[in]  culling_object_buffer_id - The ID of the buffer to hold culling data for objects.
+    /// @param[in]  draw_command_buffer_id - The ID of the buffer to hold draw commands written by the compute shader.
+    /// @param[in]  draw_count_buffer_id - The ID of the buffer to hold the number of draw commands.
+    GpuCuller::GpuCuller(
+        const GLuint compute_program_id,
+        const GLuint object_instance_buffer_id,
+        const GLuint culling_object_buffer_id,
+        const GLuint draw_command_buffer_id,
+        const GLuint draw_count_buffer_id) :
+    ObjectCount(0),
+    ComputeProgramId(compute_program_id),
+    ViewProjectionTransformLocation(glGetUniformLocation(compute_program_id, "view_projection_transform")),
+    ObjectInstanceBuffer(object_instance_buffer_id),
+    CullingObjectBufferId(culling_object_buffer_id),
+    DrawCommandBuffer(draw_command_buffer_id),
+    DrawCountBufferId(draw_count_buffer_id)
+    {}
+
+    /// Destructor to delete the compute shader program and buffers.
+    GpuCuller::~GpuCuller()
+    {
+        const GLsizei BUFFER_COUNT = 4;
+        const GLuint buffer_ids[BUFFER_COUNT] =
+        {
+            ObjectInstanceBuffer.BufferId,
+            CullingObjectBufferId,
+            DrawCommandBuffer.BufferId,
+            DrawCountBufferId
+        };
+        glDeleteBuffers(BUFFER_COUNT, buffer_ids);
+        glDeleteProgram(ComputeProgramId);
+    }
+
+    /// Sets the objects to be culled, replacing any previous objects.  This uploads the data
+    /// for all objects, so it should only be done when the set of objects changes.
+    /// @param[in]  object_instances - The per-instance data of each object.
+    /// @param[in]  culling_objects - The culling data of each object, in the same order as the instances.
+    void GpuCuller::SetObjects(
+        const std::vector<SHADERS::PositionColorInstance>& object_instances,
+        const std::vector<CullingObject>& culling_objects)
+    {
+        // MAKE SURE EVERY OBJECT HAS BOTH KINDS OF DATA.
+        bool object_data_matches = (object_instances.size() == culling_objects.size());
+        if (!object_data_matches)
+        {
+            ObjectCount = 0;
+            return;
+        }
+
+        ObjectCount = static_cast<GLuint>(culling_objects.size());
+        bool objects_exist = (ObjectCount > 0);
+        if (!objects_exist)
+        {
+            return;
+        }
+
+        // UPLOAD THE OBJECT DATA.
+        // Static usage is specified since objects are expected to change rarely.
+        FillBuffer(
+            ObjectInstanceBuffer.BufferId,
+            static_cast<GLsizeiptr>(sizeof(SHADERS::PositionColorInstance) * object_instances.size()),
+            object_instances.data(),
+            GL_STATIC_DRAW);
+        FillBuffer(
+            CullingObjectBufferId,
+            static_cast<GLsizeiptr>(sizeof(CullingObject) * culling_objects.size()),
+            culling_objects.data(),
+            GL_STATIC_DRAW);
+
+        // MAKE ROOM FOR A DRAW COMMAND FOR EVERY OBJECT.
+        // The commands are only ever written by the GPU.
+        const void* const NO_INITIAL_DATA = nullptr;
+        FillBuffer(
+            DrawCommandBuffer.BufferId,
+            static_cast<GLsizeiptr>(sizeof(DrawArraysIndirectCommand) * ObjectCount),
+            NO_INITIAL_DATA,
+            GL_DYNAMIC_COPY);
+    }
+
+    /// Dispatches the compute shader to cull all objects against the view frustum,
+    /// writing draw commands for objects that survive.  The CPU does the same amount
+    /// of work regardless of the number of objects.
+    /// @param[in]  graphics_device - The graphics device to dispatch the compute shader on.
+    /// @param[in]  view_projection_transform - The camera's projection transform multiplied by its view transform.
+    void GpuCuller::Cull(OPEN_GL::GraphicsDevice& graphics_device, const MATH::Matrix4x4f& view_projection_transform)
+    {
+        // MAKE SURE THERE ARE OBJECTS TO CULL.
+        bool objects_exist = (ObjectCount > 0);
+        if (!objects_exist)
+        {
+            return;
+        }
+
+        // SET THE COMPUTE SHADER PROGRAM AND CAMERA.
+        graphics_device.UseComputeProgram(ComputeProgramId);
+        const GLsizei ONE_MATRIX = 1;
+        const GLboolean ROW_MAJOR_ORDER = GL_TRUE;
+        glUniformMatrix4fv(ViewProjectionTransformLocation, ONE_MATRIX, ROW_MAJOR_ORDER, view_projection_transform.ElementsInRowMajorOrder());
+
+        // RESET THE DRAW COMMANDS FROM THE PREVIOUS FRAME.
+        // Without a GPU-side draw count, every command is drawn, so commands left over from
+        // objects that were visible in the previous frame must be cleared to draw nothing.
+        ClearBufferToZero(DrawCountBufferId);
+        bool draw_count_read_by_gpu = (nullptr != glMultiDrawArraysIndirectCountARB);
+        if (!draw_count_read_by_gpu)
+        {
+            ClearBufferToZero(DrawCommandBuffer.BufferId);
+        }
+
+        // CULL THE OBJECTS.
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, OBJECT_INSTANCE_BUFFER_BINDING_INDEX, ObjectInstanceBuffer.BufferId);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, CULLING_OBJECT_BUFFER_BINDING_INDEX, CullingObjectBufferId);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, DRAW_COMMAND_BUFFER_BINDING_INDEX, DrawCommandBuffer.BufferId);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, DRAW_COUNT_BUFFER_BINDING_INDEX, DrawCountBufferId);
+        GLuint work_group_count = (ObjectCount + WORK_GROUP_SIZE - 1) / WORK_GROUP_SIZE;
+        const GLuint ONE_WORK_GROUP = 1;
+        glDispatchCompute(work_group_count, ONE_WORK_GROUP, ONE_WORK_GROUP);
+
+        // MAKE THE WRITTEN COMMANDS VISIBLE TO LATER DRAWS AND CLEARS.
+        glMemoryBarrier(GL_COMMAND_BARRIER_BIT | GL_BUFFER_UPDATE_BARRIER_BIT);
+    }
+
+    /// Draws all objects that survived culling with a single call.  The pipeline state
+    /// for the instanced position-color shader program must be applied, with the vertex
+    /// buffer holding the objects' meshes bound and the camera transforms set.
+    /// @param[in]  graphics_device - The graphics device to draw with.
+    void GpuCuller::Draw(OPEN_GL::GraphicsDevice& graphics_device)
+    {
+        // MAKE SURE THERE ARE OBJECTS TO DRAW.
+        bool objects_exist = (ObjectCount > 0);
+        if (!objects_exist)
+        {
+            return;
+        }
+
+        // READ INSTANCE INPUTS RELATIVE TO THE FIRST OBJECT.
+        // The base instance of each draw command selects its object.
+        graphics_device.Bind(ObjectInstanceBuffer);
+        graphics_device.Bind(DrawCommandBuffer);
+
+        // DRAW THE COMMANDS WRITTEN BY THE COMPUTE SHADER.
+        const void* const DRAW_COMMANDS_AT_START_OF_BUFFER = nullptr;
+        const GLsizei DRAW_COMMANDS_TIGHTLY_PACKED = 0;
+        GLsizei max_draw_count = static_cast<GLsizei>(ObjectCount);
+        bool draw_count_read_by_gpu = (nullptr != glMultiDrawArraysIndirectCountARB);
+        if (draw_count_read_by_gpu)
+        {
+            const GLintptr DRAW_COUNT_AT_START_OF_BUFFER = 0;
+            glBindBuffer(GL_PARAMETER_BUFFER_ARB, DrawCountBufferId);
+            glMultiDrawArraysIndirectCountARB(
+                GL_TRIANGLES,
+                reinterpret_cast<GLintptr>(DRAW_COMMANDS_AT_START_OF_BUFFER),
+                DRAW_COUNT_AT_START_OF_BUFFER,
+                max_draw_count,
+                DRAW_COMMANDS_TIGHTLY_PACKED);
+        }
+        else
+        {
+            // Commands for culled objects have been cleared to draw nothing.
+            glMultiDrawArraysIndirect(
+                GL_TRIANGLES,
+                DRAW_COMMANDS_AT_START_OF_BUFFER,
+                max_draw_count,
+                DRAW_COMMANDS_TIGHTLY_PACKED);
+        }
+    }
+
+    /// Replaces the contents of a buffer.
+    /// @param[in]  buffer_id - The ID of the buffer to fill.
+    /// @param[in]  size_in_bytes - The new size of the buffer, in bytes.
+    /// @param[in]  data - The data to copy into the buffer.  Null to leave the contents undefined.
+    /// @param[in]  usage - The expected usage of the buffer.
+    void GpuCuller::FillBuffer(const GLuint buffer_id, const GLsizeiptr size_in_bytes, const void* const data, const GLenum usage)
+    {
+        if (DirectStateAccessSupported())
+        {
+            glNamedBufferData(buffer_id, size_in_bytes, data, usage);
+        }
+        else
+        {
+            glBindBuffer(GL_SHADER_STORAGE_BUFFER, buffer_id);
+            glBufferData(GL_SHADER_STORAGE_BUFFER, size_in_bytes, data, usage);
+        }
+    }
+
+    /// Clears a buffer of 32-bit values to zero on the GPU.
+    /// @param[in]  buffer_id - The ID of the buffer to clear.
+    void GpuCuller::ClearBufferToZero(const GLuint buffer_id)
+    {
+        // Clearing without any data fills the buffer with zeros.
+        const void* const ZERO_DATA = nullptr;
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, buffer_id);
+        glClearBufferData(GL_SHADER_STORAGE_BUFFER, GL_R32UI, GL_RED_INTEGER, GL_UNSIGNED_INT, ZERO_DATA);
+    }
+}
+}
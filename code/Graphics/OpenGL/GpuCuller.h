@@ -0,0 +1,106 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include "Graphics/OpenGL/GraphicsDevice.h"
+#include "Graphics/OpenGL/IndirectDrawBuffer.h"
+#include "Graphics/OpenGL/InstanceBuffer.h"
+#include "Graphics/OpenGL/OpenGL.h"
+#include "Graphics/OpenGL/Shaders/PredefinedShaders.h"
+#include "Math/Matrix4x4.h"
+
+namespace GRAPHICS
+{
+namespace OPEN_GL
+{
+    /// Culls and draws large numbers of objects entirely on the GPU, so that the CPU
+    /// only does a constant amount of work per frame regardless of the number of objects.
+    ///
+    /// The world transforms, colors, and bounds of all objects are uploaded once into
+    /// shader storage buffers.  Each frame, a compute shader tests each object's bounding
+    /// sphere against the camera's view frustum and appends a draw command for each
+    /// surviving object to an indirect draw buffer, which is then drawn with a single
+    /// multi-draw indirect call.  Each draw command selects its object's per-instance data
+    /// via its base instance, so objects are drawn with the instanced position-color
+    /// shader program without their data ever being copied.
+    ///
+    /// If OpenGL 4.6 or ARB_indirect_parameters is supported, the number of surviving
+    /// draws is also read by the GPU.  Otherwise, the draw command buffer is cleared before
+    /// culling so that commands for culled objects draw nothing.
+    ///
+    /// Requires OpenGL 4.3 (or ARB_compute_shader, ARB_shader_storage_buffer_object,
+    /// ARB_clear_buffer_object, and ARB_multi_draw_indirect).
+    class GpuCuller
+    {
+    public:
+        // CONSTANTS.
+        /// The number of objects tested by each work group of the culling compute shader.
+        static const GLuint WORK_GROUP_SIZE = 64;
+
+        // PUBLIC TYPES.
+        /// The data for culling and drawing an object, in the layout read by the compute shader.
+        struct CullingObject
+        {
+            /// The center (first 3 elements) and radius (last element) of a sphere
+            /// bounding the object's mesh in object space.
+            float ObjectSpaceBoundingSphere[4];
+            /// The index of the first vertex of the object's mesh in the vertex buffer being drawn.
+            GLuint FirstVertex;
+            /// The number of vertices in the object's mesh.
+            GLuint VertexCount;
+            /// Padding since structures holding vectors of 4 elements must have sizes
+            /// that are multiples of 16 bytes in shader storage buffers.
+            GLuint Unused[2];
+        };
+        static_assert(32 == sizeof(CullingObject), "Culling objects must match the std430 layout of the compute shader.");
+
+        // CONSTRUCTION.
+        static std::unique_ptr<GpuCuller> Create();
+        explicit GpuCuller(
+            const GLuint compute_program_id,
+            const GLuint object_instance_buffer_id,
+            const GLuint culling_object_buffer_id,
+            const GLuint draw_command_buffer_id,
+            const GLuint draw_count_buffer_id);
+        ~GpuCuller();
+
+        // CULLING.
+        void SetObjects(
+            const std::vector<SHADERS::PositionColorInstance>& object_instances,
+            const std::vector<CullingObject>& culling_objects);
+        void Cull(OPEN_GL::GraphicsDevice& graphics_device, const MATH::Matrix4x4f& view_projection_transform);
+        void Draw(OPEN_GL::GraphicsDevice& graphics_device);
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The number of objects being culled.
+        GLuint ObjectCount;
+
+    private:
+        // CONSTANTS.
+        /// The shader storage buffer binding point of each buffer read or written by the compute shader.
+        static const GLuint OBJECT_INSTANCE_BUFFER_BINDING_INDEX = 0;
+        static const GLuint CULLING_OBJECT_BUFFER_BINDING_INDEX = 1;
+        static const GLuint DRAW_COMMAND_BUFFER_BINDING_INDEX = 2;
+        static const GLuint DRAW_COUNT_BUFFER_BINDING_INDEX = 3;
+
+        // HELPER METHODS.
+        static void FillBuffer(const GLuint buffer_id, const GLsizeiptr size_in_bytes, const void* const data, const GLenum usage);
+        static void ClearBufferToZero(const GLuint buffer_id);
+
+        // MEMBER VARIABLES.
+        /// The ID of the linked compute shader program that culls objects.
+        GLuint ComputeProgramId;
+        /// The location of the view-projection transform uniform in the compute shader program.
+        GLint ViewProjectionTransformLocation;
+        /// The per-instance data of all objects, read by the compute shader and as per-instance
+        /// inputs when drawing.
+        InstanceBuffer ObjectInstanceBuffer;
+        /// The ID of the buffer holding a CullingObject for each object.
+        GLuint CullingObjectBufferId;
+        /// The buffer of draw commands written by the compute shader, with room for every object.
+        IndirectDrawBuffer DrawCommandBuffer;
+        /// The ID of the buffer holding the number of draw commands written by the compute shader.
+        GLuint DrawCountBufferId;
+    };
+}
+}
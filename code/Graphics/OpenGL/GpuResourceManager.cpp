@@ -0,0 +1,824 @@
+#include <algorithm>
+#include "ErrorHandling/NullChecking.h"
+#include "Graphics/OpenGL/GpuResourceManager.h"
+
+namespace GRAPHICS
+{
+namespace OPEN_GL
+{
+    /// Constructor.
+    /// @param[in]  graphics_device - The graphics device on which to allocate resources.
+    /// @throws std::exception - Thrown if the graphics device is null.
+    GpuResourceManager::GpuResourceManager(const std::shared_ptr<OPEN_GL::GraphicsDevice>& graphics_device) :
+        MemoryBudgetInBytes(DEFAULT_MEMORY_BUDGET_IN_BYTES),
+        EvictionCount(0),
+        ReuploadCount(0),
+        UpdatedVertexCount(0),
+        ResidentVertexBufferCount(0),
+        UniqueVertexUploadCount(0),
+        DeduplicatedByteCount(0),
+        GraphicsDevice(graphics_device),
+        Arena(graphics_device),
+        Slots(),
+        FreeSlotIndices(),
+        VertexUploads(),
+        FreeVertexUploadIndices(),
+        VertexUploadIndicesByHash(),
+        LeastRecentlyUsedSlotIndices(),
+        ResidentByteCounts(),
+        CurrentFrame(0)
+    {
+        ERROR_HANDLING::ThrowInvalidArgumentExceptionIfNull(
+            GraphicsDevice,
+            "Graphics device cannot be null for resource manager.");
+    }
+
+    /// Destructor that frees the memory of all resident resources on the graphics device.
+    GpuResourceManager::~GpuResourceManager()
+    {
+        for (uint32_t slot_index = 0; slot_index < Slots.size(); ++slot_index)
+        {
+            FreeDeviceMemory(slot_index);
+        }
+    }
+
+    /// Creates a vertex buffer holding the provided vertices.  Memory on the graphics
+    /// device is not allocated until the vertex buffer is first used.
+    /// @param[in]  vertices - The vertices to place in the buffer.
+    /// @param[in]  vertices_version - The version of the vertices from a VertexChangeTracker,
+    ///     if known.  Allows later updates via UpdateVertices() to be skipped if unchanged.
+    /// @return A handle to the new vertex buffer.
+    GpuResourceHandle GpuResourceManager::CreateVertexBuffer(const std::vector<GRAPHICS::Vertex>& vertices, const uint64_t vertices_version)
+    {
+        GpuResourceHandle handle = AllocateSlot(GpuResourceType::VERTEX_BUFFER);
+        ResourceSlot& slot = Slots[handle.Index];
+        slot.Vertices = std::make_shared<std::vector<GRAPHICS::Vertex>>(vertices);
+        slot.VerticesVersion = vertices_version;
+        return handle;
+    }
+
+    /// Creates a streaming vertex buffer.  Memory on the graphics device is not
+    /// allocated until the streaming vertex buffer is first used.
+    /// @param[in]  max_vertex_count_per_region - The maximum number of vertices that
+    ///     can be written to a single region of the buffer.
+    /// @return A handle to the new streaming vertex buffer.
+    GpuResourceHandle GpuResourceManager::CreateStreamingVertexBuffer(const unsigned int max_vertex_count_per_region)
+    {
+        GpuResourceHandle handle = AllocateSlot(GpuResourceType::STREAMING_VERTEX_BUFFER);
+        ResourceSlot& slot = Slots[handle.Index];
+        slot.MaxVertexCountPerRegion = max_vertex_count_per_region;
+        slot.SizeInBytes = static_cast<uint64_t>(StreamingVertexBuffer::REGION_COUNT) *
+            max_vertex_count_per_region *
+            StreamingVertexBuffer::FLOAT_COUNT_PER_VERTEX *
+            sizeof(float);
+        return handle;
+    }
+
+    /// Destroys a resource, freeing any of its memory on the graphics device.
+    /// The handle (and any copies of it) will no longer be valid.
+    /// @param[in]  handle - The handle of the resource to destroy.  Nothing happens if invalid.
+    void GpuResourceManager::Destroy(const GpuResourceHandle& handle)
+    {
+        // MAKE SURE THE HANDLE REFERS TO AN EXISTING RESOURCE.
+        ResourceSlot* slot = GetSlot(handle);
+        bool slot_valid = (nullptr != slot);
+        if (!slot_valid)
+        {
+            return;
+        }
+
+        // FREE THE RESOURCE.
+        FreeDeviceMemory(handle.Index);
+
+        // FREE THE SLOT FOR REUSE.
+        // Incrementing the generation invalidates all existing handles to the slot.
+        uint32_t next_generation = slot->Generation + 1;
+        *slot = ResourceSlot();
+        slot->Generation = next_generation;
+        FreeSlotIndices.push_back(handle.Index);
+    }
+
+    /// Determines if a handle refers to an existing resource.
+    /// @param[in]  handle - The handle to check.
+    /// @return True if the handle refers to an existing resource; false otherwise.
+    bool GpuResourceManager::IsValid(const GpuResourceHandle& handle) const
+    {
+        const ResourceSlot* slot = GetSlot(handle);
+        bool handle_valid = (nullptr != slot);
+        return handle_valid;
+    }
+
+    /// Sets the vertices held by a vertex buffer.  All vertices are compared against
+    /// the buffer's current vertices, and only changed ranges are updated.  If the
+    /// number of vertices changes, the entire buffer is replaced on its next use.
+    /// @param[in]  handle - The handle of the vertex buffer.  Nothing happens if invalid.
+    /// @param[in]  vertices - The new vertices for the buffer.
+    void GpuResourceManager::SetVertices(const GpuResourceHandle& handle, const std::vector<GRAPHICS::Vertex>& vertices)
+    {
+        // MAKE SURE THE HANDLE REFERS TO AN EXISTING VERTEX BUFFER.
+        ResourceSlot* slot = GetSlot(handle);
+        bool vertex_buffer_valid = (nullptr != slot) && (GpuResourceType::VERTEX_BUFFER == slot->Type);
+        if (!vertex_buffer_valid)
+        {
+            return;
+        }
+
+        // UPDATE ANY CHANGED VERTICES.
+        // The version is no longer known since the vertices may differ from any tracked version.
+        std::vector<GRAPHICS::VertexRange> changed_ranges = FindChangedRanges(*slot->Vertices, vertices);
+        UpdateVertexRanges(handle.Index, vertices, changed_ranges);
+        slot->VerticesVersion = 0;
+    }
+
+    /// Updates the vertices held by a vertex buffer based on tracked changes.  Nothing is
+    /// done if the buffer already holds the current version of the vertices.  Otherwise,
+    /// only the ranges recorded as changed since the buffer's version are updated.
+    /// If those ranges are unknown, all vertices are compared to find what changed.
+    /// @param[in]  handle - The handle of the vertex buffer.  Nothing happens if invalid.
+    /// @param[in]  vertices - The current vertices.
+    /// @param[in]  vertex_changes - The tracked changes to the vertices.
+    void GpuResourceManager::UpdateVertices(
+        const GpuResourceHandle& handle,
+        const std::vector<GRAPHICS::Vertex>& vertices,
+        const GRAPHICS::VertexChangeTracker& vertex_changes)
+    {
+        // MAKE SURE THE HANDLE REFERS TO AN EXISTING VERTEX BUFFER.
+        ResourceSlot* slot = GetSlot(handle);
+        bool vertex_buffer_valid = (nullptr != slot) && (GpuResourceType::VERTEX_BUFFER == slot->Type);
+        if (!vertex_buffer_valid)
+        {
+            return;
+        }
+
+        // CHECK IF THE VERTICES HAVE CHANGED.
+        bool vertices_changed = (slot->VerticesVersion != vertex_changes.Version);
+        if (!vertices_changed)
+        {
+            return;
+        }
+
+        // GET THE RANGES OF VERTICES THAT CHANGED.
+        std::vector<GRAPHICS::VertexRange> changed_ranges;
+        bool changed_ranges_known = (
+            (slot->Vertices->size() == vertices.size()) &&
+            vertex_changes.ChangedRangesSince(slot->VerticesVersion, changed_ranges));
+        if (!changed_ranges_known)
+        {
+            changed_ranges = FindChangedRanges(*slot->Vertices, vertices);
+        }
+
+        // UPDATE THE CHANGED VERTICES.
+        UpdateVertexRanges(handle.Index, vertices, changed_ranges);
+        slot->VerticesVersion = vertex_changes.Version;
+    }
+
+    /// Gets a vertex buffer for use in rendering, uploading its vertices to the
+    /// graphics device if it isn't already resident.  Other least recently used
+    /// resources may be evicted if the memory budget is exceeded.
+    /// @param[in]  handle - The handle of the vertex buffer.
+    /// @return The range of vertices for the vertex buffer, if the handle is valid and the
+    ///     vertices could be uploaded to the graphics device; a range with a null buffer otherwise.
+    ///     The range should only be used until the next call to this resource manager.
+    VertexBufferRange GpuResourceManager::UseVertexBuffer(const GpuResourceHandle& handle)
+    {
+        // MAKE SURE THE HANDLE REFERS TO AN EXISTING VERTEX BUFFER.
+        VertexBufferRange range;
+        ResourceSlot* slot = GetSlot(handle);
+        bool vertex_buffer_valid = (nullptr != slot) && (GpuResourceType::VERTEX_BUFFER == slot->Type);
+        if (!vertex_buffer_valid)
+        {
+            return range;
+        }
+
+        // UPLOAD THE VERTEX BUFFER IF IT ISN'T RESIDENT.
+        // An existing upload of identical vertices is shared if possible.
+        if (!slot->Resident)
+        {
+            bool vertex_upload_acquired = AcquireVertexUpload(handle.Index);
+            if (!vertex_upload_acquired)
+            {
+                return range;
+            }
+
+            MarkResident(handle.Index);
+        }
+
+        // TRACK THE USAGE OF THE VERTEX BUFFER.
+        MarkUsed(handle.Index);
+        EvictUntilWithinBudget();
+
+        // GET THE RANGE OF THE VERTICES.
+        range = VertexUploadRange(slot->VertexUploadIndex);
+        return range;
+    }
+
+    /// Gets a streaming vertex buffer for use in rendering, allocating it on the
+    /// graphics device if it isn't already resident.  Other least recently used
+    /// resources may be evicted if the memory budget is exceeded.
+    /// @param[in]  handle - The handle of the streaming vertex buffer.
+    /// @return The streaming vertex buffer, if the handle is valid and the buffer could
+    ///     be allocated on the graphics device; null otherwise (including if streaming
+    ///     vertex buffers are not supported).  The pointer should only be used until
+    ///     the next call to this resource manager.
+    StreamingVertexBuffer* GpuResourceManager::UseStreamingVertexBuffer(const GpuResourceHandle& handle)
+    {
+        // MAKE SURE THE HANDLE REFERS TO AN EXISTING STREAMING VERTEX BUFFER.
+        ResourceSlot* slot = GetSlot(handle);
+        bool vertex_buffer_valid = (nullptr != slot) && (GpuResourceType::STREAMING_VERTEX_BUFFER == slot->Type);
+        if (!vertex_buffer_valid)
+        {
+            return nullptr;
+        }
+
+        // ALLOCATE THE STREAMING VERTEX BUFFER IF IT ISN'T RESIDENT.
+        // Its contents are rewritten on every use, so nothing needs to be uploaded.
+        if (!slot->Resident)
+        {
+            std::shared_ptr<OPEN_GL::StreamingVertexBuffer> vertex_buffer = GraphicsDevice->CreateStreamingVertexBuffer(
+                slot->MaxVertexCountPerRegion);
+            bool vertex_buffer_created = (nullptr != vertex_buffer);
+            if (!vertex_buffer_created)
+            {
+                return nullptr;
+            }
+
+            slot->ResidentStreamingVertexBuffer = vertex_buffer;
+            ResidentByteCounts[static_cast<std::size_t>(slot->Type)] += slot->SizeInBytes;
+            MarkResident(handle.Index);
+        }
+
+        // TRACK THE USAGE OF THE STREAMING VERTEX BUFFER.
+        MarkUsed(handle.Index);
+        EvictUntilWithinBudget();
+        return slot->ResidentStreamingVertexBuffer.get();
+    }
+
+    /// Advances to the next frame.  Resources used in the previous frame become
+    /// eligible for eviction, and resources are evicted if the budget is exceeded
+    /// (for example, if the budget was lowered).  The arena is also incrementally defragmented.
+    void GpuResourceManager::AdvanceFrame()
+    {
+        ++CurrentFrame;
+        EvictUntilWithinBudget();
+        Arena.Defragment(MAX_DEFRAGMENTED_ALLOCATION_COUNT_PER_FRAME);
+    }
+
+    /// Gets the number of frames since a resource was last used.
+    /// @param[in]  handle - The handle of the resource.
+    /// @return The number of frames since the resource was last used (0 if used in the
+    ///     current frame); or the maximum possible value if the handle is invalid.
+    uint64_t GpuResourceManager::FramesSinceLastUse(const GpuResourceHandle& handle) const
+    {
+        const ResourceSlot* slot = GetSlot(handle);
+        bool slot_valid = (nullptr != slot);
+        if (!slot_valid)
+        {
+            return UINT64_MAX;
+        }
+
+        uint64_t frames_since_last_use = CurrentFrame - slot->LastUsedFrame;
+        return frames_since_last_use;
+    }
+
+    /// Gets the number of bytes used on the graphics device by resident resources of a specific type.
+    /// @param[in]  resource_type - The type of resources.
+    /// @return The number of bytes used by resident resources of the type.
+    /// @throws std::out_of_range - Thrown if the resource type is invalid.
+    uint64_t GpuResourceManager::ResidentByteCount(const GpuResourceType resource_type) const
+    {
+        uint64_t resident_byte_count = ResidentByteCounts.at(static_cast<std::size_t>(resource_type));
+        return resident_byte_count;
+    }
+
+    /// Gets the number of bytes used on the graphics device by all resident resources.
+    /// @return The number of bytes used by all resident resources.
+    uint64_t GpuResourceManager::TotalResidentByteCount() const
+    {
+        uint64_t total_resident_byte_count = 0;
+        for (uint64_t resident_byte_count : ResidentByteCounts)
+        {
+            total_resident_byte_count += resident_byte_count;
+        }
+        return total_resident_byte_count;
+    }
+
+    /// Gets the ratio of resident vertex buffers to unique vertex uploads.
+    /// @return The deduplication ratio.  1 if no vertex buffers share uploads (or none are resident).
+    float GpuResourceManager::DeduplicationRatio() const
+    {
+        bool vertex_uploads_exist = (UniqueVertexUploadCount > 0);
+        if (!vertex_uploads_exist)
+        {
+            return 1.0f;
+        }
+
+        float deduplication_ratio = static_cast<float>(ResidentVertexBufferCount) / static_cast<float>(UniqueVertexUploadCount);
+        return deduplication_ratio;
+    }
+
+    /// Computes a hash of vertices.  FNV-1a is used since it's fast, simple, and
+    /// distributes well enough for finding identical vertices; collisions are
+    /// handled by comparing the vertices themselves.
+    /// @param[in]  vertices - The vertices to hash.
+    /// @return The hash of the vertices.
+    uint64_t GpuResourceManager::HashVertices(const std::vector<GRAPHICS::Vertex>& vertices)
+    {
+        const uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+        const uint64_t FNV_PRIME = 1099511628211ULL;
+
+        // HASH THE RAW BYTES OF THE VERTICES.
+        // This is possible since vertices are tightly packed floats without any padding.
+        uint64_t hash = FNV_OFFSET_BASIS;
+        const uint8_t* vertex_bytes = reinterpret_cast<const uint8_t*>(vertices.data());
+        std::size_t vertex_byte_count = vertices.size() * sizeof(GRAPHICS::Vertex);
+        for (std::size_t byte_index = 0; byte_index < vertex_byte_count; ++byte_index)
+        {
+            hash ^= vertex_bytes[byte_index];
+            hash *= FNV_PRIME;
+        }
+        return hash;
+    }
+
+    /// Gets a vertex upload holding a slot's vertices, sharing an existing upload of
+    /// identical vertices if one exists or creating a new upload otherwise.
+    /// @param[in]  slot_index - The index of the vertex buffer's slot.
+    /// @return True if the slot now has a vertex upload; false if uploading failed.
+    bool GpuResourceManager::AcquireVertexUpload(const uint32_t slot_index)
+    {
+        ResourceSlot& slot = Slots[slot_index];
+
+        // CHECK FOR AN EXISTING UPLOAD OF IDENTICAL VERTICES.
+        uint64_t content_hash = HashVertices(*slot.Vertices);
+        auto hash_entries = VertexUploadIndicesByHash.equal_range(content_hash);
+        for (auto hash_entry = hash_entries.first; hash_entry != hash_entries.second; ++hash_entry)
+        {
+            // SHARE THE UPLOAD IF IT HOLDS THE SAME VERTICES.
+            // The vertices are compared in case of hash collisions.  The slot also shares the upload's
+            // copy of the vertices so that its own identical copy can be freed.
+            uint32_t vertex_upload_index = hash_entry->second;
+            VertexUpload& vertex_upload = VertexUploads[vertex_upload_index];
+            bool vertices_identical = (
+                (vertex_upload.Vertices == slot.Vertices) ||
+                (*vertex_upload.Vertices == *slot.Vertices));
+            if (vertices_identical)
+            {
+                ++vertex_upload.ReferenceCount;
+                slot.VertexUploadIndex = vertex_upload_index;
+                slot.Vertices = vertex_upload.Vertices;
+                ++ResidentVertexBufferCount;
+                DeduplicatedByteCount += vertex_upload.SizeInBytes;
+                return true;
+            }
+        }
+
+        // CREATE A NEW UPLOAD, PREFERABLY SUB-ALLOCATED FROM THE ARENA.
+        VertexUpload new_vertex_upload;
+        new_vertex_upload.InUse = true;
+        new_vertex_upload.ContentHash = content_hash;
+        new_vertex_upload.Vertices = slot.Vertices;
+        new_vertex_upload.ReferenceCount = 1;
+        new_vertex_upload.ArenaAllocationId = Arena.Allocate(*slot.Vertices);
+        bool allocated_from_arena = (VertexBufferArena::INVALID_ALLOCATION_ID != new_vertex_upload.ArenaAllocationId);
+        if (allocated_from_arena)
+        {
+            new_vertex_upload.SizeInBytes = Arena.AllocatedSizeInBytes(new_vertex_upload.ArenaAllocationId);
+        }
+        else
+        {
+            // FALL BACK TO A DEDICATED VERTEX BUFFER.
+            std::shared_ptr<OPEN_GL::VertexBuffer> vertex_buffer = GraphicsDevice->CreateVertexBuffer();
+            bool vertex_buffer_created = (nullptr != vertex_buffer);
+            if (!vertex_buffer_created)
+            {
+                return false;
+            }
+
+            vertex_buffer->Fill(*slot.Vertices);
+            new_vertex_upload.DedicatedVertexBuffer = vertex_buffer;
+            new_vertex_upload.SizeInBytes = static_cast<uint64_t>(slot.Vertices->size()) * VertexBuffer::VERTEX_SIZE_IN_BYTES;
+        }
+
+        // STORE THE NEW UPLOAD.
+        uint32_t vertex_upload_index = 0;
+        bool free_vertex_upload_exists = !FreeVertexUploadIndices.empty();
+        if (free_vertex_upload_exists)
+        {
+            vertex_upload_index = FreeVertexUploadIndices.back();
+            FreeVertexUploadIndices.pop_back();
+            VertexUploads[vertex_upload_index] = new_vertex_upload;
+        }
+        else
+        {
+            vertex_upload_index = static_cast<uint32_t>(VertexUploads.size());
+            VertexUploads.push_back(new_vertex_upload);
+        }
+        VertexUploadIndicesByHash.emplace(content_hash, vertex_upload_index);
+
+        // TRACK THE NEW UPLOAD.
+        slot.VertexUploadIndex = vertex_upload_index;
+        ResidentByteCounts[static_cast<std::size_t>(GpuResourceType::VERTEX_BUFFER)] += new_vertex_upload.SizeInBytes;
+        ++ResidentVertexBufferCount;
+        ++UniqueVertexUploadCount;
+        return true;
+    }
+
+    /// Releases a slot's reference to its vertex upload, destroying the upload
+    /// if no other vertex buffers are using it.
+    /// @param[in]  slot_index - The index of the vertex buffer's slot.
+    void GpuResourceManager::ReleaseVertexUpload(const uint32_t slot_index)
+    {
+        // RELEASE THE SLOT'S REFERENCE.
+        ResourceSlot& slot = Slots[slot_index];
+        uint32_t vertex_upload_index = slot.VertexUploadIndex;
+        slot.VertexUploadIndex = UINT32_MAX;
+        VertexUpload& vertex_upload = VertexUploads[vertex_upload_index];
+        --vertex_upload.ReferenceCount;
+        --ResidentVertexBufferCount;
+
+        // KEEP THE UPLOAD IF OTHER VERTEX BUFFERS ARE STILL USING IT.
+        bool vertex_upload_still_used = (vertex_upload.ReferenceCount > 0);
+        if (vertex_upload_still_used)
+        {
+            DeduplicatedByteCount -= vertex_upload.SizeInBytes;
+            return;
+        }
+
+        // DESTROY THE UPLOAD ON THE GRAPHICS DEVICE.
+        bool allocated_from_arena = (VertexBufferArena::INVALID_ALLOCATION_ID != vertex_upload.ArenaAllocationId);
+        if (allocated_from_arena)
+        {
+            Arena.Free(vertex_upload.ArenaAllocationId);
+        }
+        bool dedicated_vertex_buffer_exists = (nullptr != vertex_upload.DedicatedVertexBuffer);
+        if (dedicated_vertex_buffer_exists)
+        {
+            GraphicsDevice->Destroy(vertex_upload.DedicatedVertexBuffer);
+        }
+
+        // STOP TRACKING THE UPLOAD.
+        auto hash_entries = VertexUploadIndicesByHash.equal_range(vertex_upload.ContentHash);
+        for (auto hash_entry = hash_entries.first; hash_entry != hash_entries.second; ++hash_entry)
+        {
+            bool entry_for_upload = (vertex_upload_index == hash_entry->second);
+            if (entry_for_upload)
+            {
+                VertexUploadIndicesByHash.erase(hash_entry);
+                break;
+            }
+        }
+        ResidentByteCounts[static_cast<std::size_t>(GpuResourceType::VERTEX_BUFFER)] -= vertex_upload.SizeInBytes;
+        --UniqueVertexUploadCount;
+        vertex_upload = VertexUpload();
+        FreeVertexUploadIndices.push_back(vertex_upload_index);
+    }
+
+    /// Gets the range of vertices for a vertex upload.
+    /// @param[in]  vertex_upload_index - The index of the vertex upload.
+    /// @return The range of vertices for the upload.
+    VertexBufferRange GpuResourceManager::VertexUploadRange(const uint32_t vertex_upload_index) const
+    {
+        const VertexUpload& vertex_upload = VertexUploads[vertex_upload_index];
+        bool allocated_from_arena = (VertexBufferArena::INVALID_ALLOCATION_ID != vertex_upload.ArenaAllocationId);
+        if (allocated_from_arena)
+        {
+            VertexBufferRange range = Arena.Range(vertex_upload.ArenaAllocationId);
+            return range;
+        }
+
+        VertexBufferRange range;
+        range.Buffer = vertex_upload.DedicatedVertexBuffer.get();
+        range.FirstVertex = 0;
+        range.VertexCount = static_cast<GLsizei>(vertex_upload.Vertices->size());
+        return range;
+    }
+
+    /// Gets a slot's vertices for changing them, first giving the slot its own copy of the
+    /// vertices if they're shared with anything besides the slot's own vertex upload.
+    /// @param[in]  slot_index - The index of the vertex buffer's slot.
+    /// @return The slot's vertices, which may be changed without affecting other vertex buffers.
+    std::vector<GRAPHICS::Vertex>& GpuResourceManager::MutableVertices(const uint32_t slot_index)
+    {
+        // COUNT THE EXPECTED OWNERS OF THE VERTICES.
+        // A resident slot whose upload isn't shared with other slots may change the vertices in place,
+        // with the upload seeing the changes too.
+        ResourceSlot& slot = Slots[slot_index];
+        long expected_owner_count = 1;
+        bool vertices_shared_with_own_upload = (
+            slot.Resident &&
+            (VertexUploads[slot.VertexUploadIndex].Vertices == slot.Vertices));
+        if (vertices_shared_with_own_upload)
+        {
+            ++expected_owner_count;
+        }
+
+        // COPY THE VERTICES IF ANYTHING ELSE SHARES THEM.
+        bool vertices_shared_with_others = (slot.Vertices.use_count() > expected_owner_count);
+        if (vertices_shared_with_others)
+        {
+            slot.Vertices = std::make_shared<std::vector<GRAPHICS::Vertex>>(*slot.Vertices);
+        }
+        return *slot.Vertices;
+    }
+
+    /// Gets the slot referred to by a handle.
+    /// @param[in]  handle - The handle of the slot.
+    /// @return The slot, if the handle refers to an existing resource; null otherwise.
+    GpuResourceManager::ResourceSlot* GpuResourceManager::GetSlot(const GpuResourceHandle& handle)
+    {
+        const GpuResourceManager* const_this = this;
+        const ResourceSlot* slot = const_this->GetSlot(handle);
+        return const_cast<ResourceSlot*>(slot);
+    }
+
+    /// Gets the slot referred to by a handle.
+    /// @param[in]  handle - The handle of the slot.
+    /// @return The slot, if the handle refers to an existing resource; null otherwise.
+    const GpuResourceManager::ResourceSlot* GpuResourceManager::GetSlot(const GpuResourceHandle& handle) const
+    {
+        // MAKE SURE THE HANDLE REFERS TO A SLOT.
+        bool slot_index_valid = (handle.Index < Slots.size());
+        if (!slot_index_valid)
+        {
+            return nullptr;
+        }
+
+        // MAKE SURE THE SLOT STILL HOLDS THE RESOURCE FOR THE HANDLE.
+        const ResourceSlot& slot = Slots[handle.Index];
+        bool slot_holds_handle_resource = (slot.InUse && (slot.Generation == handle.Generation));
+        if (!slot_holds_handle_resource)
+        {
+            return nullptr;
+        }
+
+        return &slot;
+    }
+
+    /// Allocates a slot for a new resource, reusing a free slot if possible.
+    /// @param[in]  resource_type - The type of resource for the slot.
+    /// @return A handle to the allocated slot.
+    GpuResourceHandle GpuResourceManager::AllocateSlot(const GpuResourceType resource_type)
+    {
+        // GET A FREE SLOT.
+        uint32_t slot_index = 0;
+        bool free_slot_exists = !FreeSlotIndices.empty();
+        if (free_slot_exists)
+        {
+            slot_index = FreeSlotIndices.back();
+            FreeSlotIndices.pop_back();
+        }
+        else
+        {
+            slot_index = static_cast<uint32_t>(Slots.size());
+            Slots.push_back(ResourceSlot());
+        }
+
+        // MARK THE SLOT AS USED.
+        ResourceSlot& slot = Slots[slot_index];
+        slot.InUse = true;
+        slot.Type = resource_type;
+        slot.LastUsedFrame = CurrentFrame;
+
+        GpuResourceHandle handle;
+        handle.Index = slot_index;
+        handle.Generation = slot.Generation;
+        return handle;
+    }
+
+    /// Finds the ranges of vertices that differ between two sets of vertices.
+    /// @param[in]  old_vertices - The old vertices.
+    /// @param[in]  new_vertices - The new vertices.
+    /// @return The ranges of new vertices that differ from the old vertices.  If the number
+    ///     of vertices differs, a single range covering all new vertices is returned.
+    std::vector<GRAPHICS::VertexRange> GpuResourceManager::FindChangedRanges(
+        const std::vector<GRAPHICS::Vertex>& old_vertices,
+        const std::vector<GRAPHICS::Vertex>& new_vertices)
+    {
+        std::vector<GRAPHICS::VertexRange> changed_ranges;
+
+        // CONSIDER ALL VERTICES CHANGED IF THE NUMBER OF VERTICES CHANGED.
+        bool vertex_count_changed = (old_vertices.size() != new_vertices.size());
+        if (vertex_count_changed)
+        {
+            GRAPHICS::VertexRange all_vertices;
+            all_vertices.FirstVertex = 0;
+            all_vertices.VertexCount = new_vertices.size();
+            changed_ranges.push_back(all_vertices);
+            return changed_ranges;
+        }
+
+        // FIND EACH RUN OF CHANGED VERTICES.
+        std::size_t vertex_index = 0;
+        while (vertex_index < new_vertices.size())
+        {
+            // SKIP UNCHANGED VERTICES.
+            bool vertex_changed = (old_vertices[vertex_index] != new_vertices[vertex_index]);
+            if (!vertex_changed)
+            {
+                ++vertex_index;
+                continue;
+            }
+
+            // FIND THE END OF THE CHANGED RUN.
+            GRAPHICS::VertexRange changed_range;
+            changed_range.FirstVertex = vertex_index;
+            while ((vertex_index < new_vertices.size()) && (old_vertices[vertex_index] != new_vertices[vertex_index]))
+            {
+                ++vertex_index;
+            }
+            changed_range.VertexCount = vertex_index - changed_range.FirstVertex;
+            changed_ranges.push_back(changed_range);
+        }
+
+        return changed_ranges;
+    }
+
+    /// Updates ranges of vertices for a vertex buffer slot.  Nearby ranges are coalesced,
+    /// and only those ranges are uploaded if the buffer is resident.  If the number of
+    /// vertices changed, the buffer is freed so that it gets entirely replaced on its next use.
+    /// @param[in]  slot_index - The index of the vertex buffer's slot.
+    /// @param[in]  vertices - The new vertices.
+    /// @param[in,out]  changed_ranges - The ranges of vertices that changed.  Coalesced upon return.
+    void GpuResourceManager::UpdateVertexRanges(
+        const uint32_t slot_index,
+        const std::vector<GRAPHICS::Vertex>& vertices,
+        std::vector<GRAPHICS::VertexRange>& changed_ranges)
+    {
+        ResourceSlot& slot = Slots[slot_index];
+
+        // REPLACE ALL VERTICES IF THE NUMBER OF VERTICES CHANGED.
+        bool vertex_count_changed = (slot.Vertices->size() != vertices.size());
+        if (vertex_count_changed)
+        {
+            // The buffer will be reallocated with the right size on its next use.
+            FreeDeviceMemory(slot_index);
+            slot.Vertices = std::make_shared<std::vector<GRAPHICS::Vertex>>(vertices);
+            return;
+        }
+
+        // STOP SHARING ANY UPLOAD THAT OTHER VERTEX BUFFERS ARE STILL USING.
+        // The buffer will get its own upload with the changed vertices on its next use.
+        bool upload_shared = slot.Resident && (VertexUploads[slot.VertexUploadIndex].ReferenceCount > 1);
+        if (upload_shared)
+        {
+            FreeDeviceMemory(slot_index);
+        }
+
+        // GET THE RANGE OF THE BUFFER HOLDING THE VERTICES, IF RESIDENT.
+        VertexBufferRange buffer_range;
+        if (slot.Resident)
+        {
+            buffer_range = VertexUploadRange(slot.VertexUploadIndex);
+        }
+
+        // UPDATE EACH CHANGED RANGE.
+        std::vector<GRAPHICS::Vertex>& retained_vertices = MutableVertices(slot_index);
+        GRAPHICS::VertexRange::Coalesce(MAX_COALESCED_GAP_VERTEX_COUNT, changed_ranges);
+        for (const GRAPHICS::VertexRange& changed_range : changed_ranges)
+        {
+            // IGNORE ANY PART OF THE RANGE PAST THE END OF THE VERTICES.
+            bool range_in_bounds = (changed_range.FirstVertex < vertices.size());
+            if (!range_in_bounds)
+            {
+                continue;
+            }
+            std::size_t vertex_count = std::min(changed_range.VertexCount, vertices.size() - changed_range.FirstVertex);
+
+            // UPDATE THE RETAINED COPY OF THE VERTICES.
+            auto first_changed_vertex = vertices.cbegin() + changed_range.FirstVertex;
+            std::copy(
+                first_changed_vertex,
+                first_changed_vertex + vertex_count,
+                retained_vertices.begin() + changed_range.FirstVertex);
+
+            // UPLOAD THE CHANGED VERTICES IF THE BUFFER IS RESIDENT.
+            bool buffer_resident = (nullptr != buffer_range.Buffer);
+            if (buffer_resident)
+            {
+                unsigned int buffer_first_vertex = static_cast<unsigned int>(buffer_range.FirstVertex + changed_range.FirstVertex);
+                buffer_range.Buffer->FillRange(buffer_first_vertex, &retained_vertices[changed_range.FirstVertex], vertex_count);
+                UpdatedVertexCount += vertex_count;
+            }
+        }
+
+        // KEEP THE UPLOAD'S VERTICES AND HASH IN SYNC WITH ITS UPDATED CONTENTS.
+        if (slot.Resident)
+        {
+            VertexUpload& vertex_upload = VertexUploads[slot.VertexUploadIndex];
+            auto hash_entries = VertexUploadIndicesByHash.equal_range(vertex_upload.ContentHash);
+            for (auto hash_entry = hash_entries.first; hash_entry != hash_entries.second; ++hash_entry)
+            {
+                bool entry_for_upload = (slot.VertexUploadIndex == hash_entry->second);
+                if (entry_for_upload)
+                {
+                    VertexUploadIndicesByHash.erase(hash_entry);
+                    break;
+                }
+            }
+
+            vertex_upload.Vertices = slot.Vertices;
+            vertex_upload.ContentHash = HashVertices(*vertex_upload.Vertices);
+            VertexUploadIndicesByHash.emplace(vertex_upload.ContentHash, slot.VertexUploadIndex);
+        }
+    }
+
+    /// Marks a slot's resource as now having memory allocated on the graphics device.
+    /// @param[in]  slot_index - The index of the slot.
+    void GpuResourceManager::MarkResident(const uint32_t slot_index)
+    {
+        ResourceSlot& slot = Slots[slot_index];
+        slot.Resident = true;
+        slot.LeastRecentlyUsedPosition = LeastRecentlyUsedSlotIndices.insert(LeastRecentlyUsedSlotIndices.end(), slot_index);
+
+        if (slot.Evicted)
+        {
+            ++ReuploadCount;
+            slot.Evicted = false;
+        }
+    }
+
+    /// Marks a resident slot's resource as the most recently used resource.
+    /// @param[in]  slot_index - The index of the slot.
+    void GpuResourceManager::MarkUsed(const uint32_t slot_index)
+    {
+        ResourceSlot& slot = Slots[slot_index];
+        slot.LastUsedFrame = CurrentFrame;
+
+        // MOVE THE SLOT TO THE MOST RECENTLY USED END OF THE LIST.
+        // Splicing avoids reallocating the list node and keeps the slot's iterator valid.
+        LeastRecentlyUsedSlotIndices.splice(
+            LeastRecentlyUsedSlotIndices.end(),
+            LeastRecentlyUsedSlotIndices,
+            slot.LeastRecentlyUsedPosition);
+    }
+
+    /// Frees any memory on the graphics device for a slot's resource.
+    /// @param[in]  slot_index - The index of the slot.
+    void GpuResourceManager::FreeDeviceMemory(const uint32_t slot_index)
+    {
+        // MAKE SURE THE RESOURCE HAS MEMORY ON THE GRAPHICS DEVICE.
+        ResourceSlot& slot = Slots[slot_index];
+        if (!slot.Resident)
+        {
+            return;
+        }
+
+        // RELEASE THE RESOURCE ON THE GRAPHICS DEVICE.
+        // Vertex uploads are only destroyed once no other vertex buffers share them.
+        bool vertex_upload_used = (UINT32_MAX != slot.VertexUploadIndex);
+        if (vertex_upload_used)
+        {
+            ReleaseVertexUpload(slot_index);
+        }
+        bool streaming_vertex_buffer_resident = (nullptr != slot.ResidentStreamingVertexBuffer);
+        if (streaming_vertex_buffer_resident)
+        {
+            GraphicsDevice->Destroy(slot.ResidentStreamingVertexBuffer);
+            slot.ResidentStreamingVertexBuffer = nullptr;
+            ResidentByteCounts[static_cast<std::size_t>(slot.Type)] -= slot.SizeInBytes;
+        }
+
+        // STOP TRACKING THE RESOURCE AS RESIDENT.
+        LeastRecentlyUsedSlotIndices.erase(slot.LeastRecentlyUsedPosition);
+        slot.Resident = false;
+    }
+
+    /// Evicts a slot's resource from the graphics device.  The resource remains
+    /// valid and will be made resident again on its next use.
+    /// @param[in]  slot_index - The index of the slot.
+    void GpuResourceManager::Evict(const uint32_t slot_index)
+    {
+        FreeDeviceMemory(slot_index);
+        Slots[slot_index].Evicted = true;
+        ++EvictionCount;
+    }
+
+    /// Evicts least recently used resources until resident resources are within the
+    /// memory budget.  Resources used in the current frame are never evicted since
+    /// they would just need to be re-uploaded again.
+    void GpuResourceManager::EvictUntilWithinBudget()
+    {
+        while (TotalResidentByteCount() > MemoryBudgetInBytes)
+        {
+            // STOP IF NO RESOURCES REMAIN TO BE EVICTED.
+            // Bytes may still be resident without any evictable resources, such as arena storage
+            // whose allocations were all freed, so the budget can't always be met.
+            bool evictable_resources_exist = !LeastRecentlyUsedSlotIndices.empty();
+            if (!evictable_resources_exist)
+            {
+                break;
+            }
+
+            // STOP IF ALL REMAINING RESOURCES ARE NEEDED FOR THE CURRENT FRAME.
+            // Since the list is ordered by use, all later resources were used in the current frame too.
+            uint32_t least_recently_used_slot_index = LeastRecentlyUsedSlotIndices.front();
+            bool used_in_current_frame = (CurrentFrame == Slots[least_recently_used_slot_index].LastUsedFrame);
+            if (used_in_current_frame)
+            {
+                break;
+            }
+
+            Evict(least_recently_used_slot_index);
+        }
+    }
+}
+}
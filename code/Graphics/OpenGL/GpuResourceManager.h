@@ -0,0 +1,222 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include "Graphics/OpenGL/GraphicsDevice.h"
+#include "Graphics/OpenGL/StreamingVertexBuffer.h"
+#include "Graphics/OpenGL/VertexBuffer.h"
+#include "Graphics/OpenGL/VertexBufferArena.h"
+#include "Graphics/Vertex.h"
+#include "Graphics/VertexChangeTracker.h"
+
+namespace GRAPHICS
+{
+namespace OPEN_GL
+{
+    /// The types of resources managed by a GpuResourceManager.
+    enum class GpuResourceType
+    {
+        /// A regular VertexBuffer.
+        VERTEX_BUFFER = 0,
+        /// A StreamingVertexBuffer.
+        STREAMING_VERTEX_BUFFER,
+        /// The number of resource types.  Not a valid resource type.
+        COUNT
+    };
+
+    /// A handle to a resource owned by a GpuResourceManager.  Handles stay the same
+    /// size and remain safe to use even after the resource they refer to has been
+    /// destroyed, since each handle includes the generation of the slot it refers to.
+    /// Once a slot is reused for a different resource, old handles to the slot are
+    /// detected as invalid rather than silently referring to the new resource.
+    struct GpuResourceHandle
+    {
+        /// The index of the resource's slot in the resource manager.
+        uint32_t Index = UINT32_MAX;
+        /// The generation of the slot when the handle was created.
+        uint32_t Generation = 0;
+    };
+
+    /// Manages vertex buffers on a graphics device, keeping the total memory they
+    /// use within a configurable budget.  Vertex buffers small enough are sub-allocated
+    /// from a shared VertexBufferArena rather than getting their own buffer.
+    ///
+    /// Vertex buffers with identical vertices (for example, many objects created from the
+    /// same shape) share a single reference-counted upload on the graphics device.  Uploads
+    /// are found by a hash of their vertices, with the vertices themselves compared to rule
+    /// out hash collisions.  Changing the vertices of a shared upload gives the changed
+    /// vertex buffer its own upload rather than affecting the others sharing it.
+    ///
+    /// Resources are referred to via generation-checked handles rather than pointers.
+    /// Each use of a resource marks it as most recently used, and when the budget is
+    /// exceeded, the least recently used resources have their memory on the graphics
+    /// device freed (evicted).  Evicted resources keep their handles valid: vertex
+    /// buffers retain a copy of their vertices so that they can be transparently
+    /// re-uploaded on their next use, and streaming vertex buffers are recreated
+    /// since their contents are rewritten on every use anyway.  Retained vertices are
+    /// shared between a vertex buffer and its upload (and between all vertex buffers with
+    /// identical vertices), so each unique set of vertices has only a single CPU copy,
+    /// which is only copied again if a vertex buffer sharing it changes its vertices.
+    class GpuResourceManager
+    {
+    public:
+        // CONSTANTS.
+        /// The default memory budget for resources on the graphics device.
+        static const uint64_t DEFAULT_MEMORY_BUDGET_IN_BYTES = 256 * 1024 * 1024;
+        /// The maximum number of unchanged vertices between changed ranges for the ranges
+        /// to be updated together, since separate updates have more overhead than a few extra vertices.
+        static const std::size_t MAX_COALESCED_GAP_VERTEX_COUNT = 8;
+        /// The maximum number of arena allocations moved per frame to defragment the arena.
+        static const unsigned int MAX_DEFRAGMENTED_ALLOCATION_COUNT_PER_FRAME = 8;
+
+        // CONSTRUCTION.
+        explicit GpuResourceManager(const std::shared_ptr<OPEN_GL::GraphicsDevice>& graphics_device);
+        ~GpuResourceManager();
+
+        // RESOURCE CREATION/DESTRUCTION.
+        GpuResourceHandle CreateVertexBuffer(const std::vector<GRAPHICS::Vertex>& vertices, const uint64_t vertices_version = 0);
+        GpuResourceHandle CreateStreamingVertexBuffer(const unsigned int max_vertex_count_per_region);
+        void Destroy(const GpuResourceHandle& handle);
+        bool IsValid(const GpuResourceHandle& handle) const;
+
+        // RESOURCE UPDATES.
+        void SetVertices(const GpuResourceHandle& handle, const std::vector<GRAPHICS::Vertex>& vertices);
+        void UpdateVertices(
+            const GpuResourceHandle& handle,
+            const std::vector<GRAPHICS::Vertex>& vertices,
+            const GRAPHICS::VertexChangeTracker& vertex_changes);
+        static std::vector<GRAPHICS::VertexRange> FindChangedRanges(
+            const std::vector<GRAPHICS::Vertex>& old_vertices,
+            const std::vector<GRAPHICS::Vertex>& new_vertices);
+
+        // RESOURCE USAGE.
+        VertexBufferRange UseVertexBuffer(const GpuResourceHandle& handle);
+        StreamingVertexBuffer* UseStreamingVertexBuffer(const GpuResourceHandle& handle);
+        void AdvanceFrame();
+        uint64_t FramesSinceLastUse(const GpuResourceHandle& handle) const;
+
+        // STATISTICS.
+        uint64_t ResidentByteCount(const GpuResourceType resource_type) const;
+        uint64_t TotalResidentByteCount() const;
+        float DeduplicationRatio() const;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The maximum number of bytes that resident resources should use on the graphics device.
+        /// Resources used in the current frame are never evicted, so this may be exceeded
+        /// if a single frame uses more memory than the budget.
+        uint64_t MemoryBudgetInBytes;
+        /// The number of evictions that have occurred.
+        uint64_t EvictionCount;
+        /// The number of times evicted resources have been re-uploaded.
+        uint64_t ReuploadCount;
+        /// The number of vertices uploaded to update resident vertex buffers with changed vertices.
+        uint64_t UpdatedVertexCount;
+        /// The number of resident vertex buffers, including ones sharing an upload with others.
+        uint64_t ResidentVertexBufferCount;
+        /// The number of unique vertex uploads on the graphics device.
+        uint64_t UniqueVertexUploadCount;
+        /// The number of bytes saved on the graphics device by resident vertex buffers
+        /// sharing uploads rather than each having their own.
+        uint64_t DeduplicatedByteCount;
+
+    private:
+        // PRIVATE TYPES.
+        /// A slot holding a single resource and its bookkeeping information.
+        struct ResourceSlot
+        {
+            /// The generation of the slot, incremented each time the slot's resource is destroyed.
+            uint32_t Generation = 0;
+            /// True if the slot currently holds a resource; false if the slot is free.
+            bool InUse = false;
+            /// The type of resource in the slot.
+            GpuResourceType Type = GpuResourceType::VERTEX_BUFFER;
+            /// The index of the vertex upload used, if the slot holds a resident vertex buffer.
+            uint32_t VertexUploadIndex = UINT32_MAX;
+            /// The vertices for a vertex buffer, retained for re-uploading after eviction.
+            /// Shared with the vertex buffer's upload and any others with identical vertices.
+            std::shared_ptr<std::vector<GRAPHICS::Vertex>> Vertices = nullptr;
+            /// The version of the vertices (from a VertexChangeTracker), if known; 0 otherwise.
+            uint64_t VerticesVersion = 0;
+            /// The streaming vertex buffer, if the slot holds a resident streaming vertex buffer.
+            std::shared_ptr<OPEN_GL::StreamingVertexBuffer> ResidentStreamingVertexBuffer = nullptr;
+            /// The maximum number of vertices per region for a streaming vertex buffer.
+            unsigned int MaxVertexCountPerRegion = 0;
+            /// The number of bytes a streaming vertex buffer uses on the graphics device when resident.
+            /// Bytes for vertex buffers are tracked by their uploads since uploads may be shared.
+            uint64_t SizeInBytes = 0;
+            /// The frame in which the resource was last used.
+            uint64_t LastUsedFrame = 0;
+            /// The position of the slot in the least recently used list, if resident.
+            std::list<uint32_t>::iterator LeastRecentlyUsedPosition = {};
+            /// True if the resource currently has memory allocated on the graphics device.
+            bool Resident = false;
+            /// True if the resource has been evicted since it was last resident.
+            bool Evicted = false;
+        };
+
+        /// Vertices uploaded to the graphics device, shared by all vertex buffers with identical vertices.
+        struct VertexUpload
+        {
+            /// True if the upload is in use; false if the upload is free.
+            bool InUse = false;
+            /// The hash of the vertices.
+            uint64_t ContentHash = 0;
+            /// The uploaded vertices, shared with the vertex buffers using the upload.
+            std::shared_ptr<std::vector<GRAPHICS::Vertex>> Vertices = nullptr;
+            /// The ID of the arena allocation holding the vertices, if allocated from the arena.
+            uint32_t ArenaAllocationId = VertexBufferArena::INVALID_ALLOCATION_ID;
+            /// The dedicated vertex buffer holding the vertices, if too large for the arena.
+            std::shared_ptr<OPEN_GL::VertexBuffer> DedicatedVertexBuffer = nullptr;
+            /// The number of resident vertex buffers using the upload.
+            uint32_t ReferenceCount = 0;
+            /// The number of bytes the upload uses on the graphics device.
+            uint64_t SizeInBytes = 0;
+        };
+
+        // HELPER METHODS.
+        static uint64_t HashVertices(const std::vector<GRAPHICS::Vertex>& vertices);
+        bool AcquireVertexUpload(const uint32_t slot_index);
+        void ReleaseVertexUpload(const uint32_t slot_index);
+        VertexBufferRange VertexUploadRange(const uint32_t vertex_upload_index) const;
+        std::vector<GRAPHICS::Vertex>& MutableVertices(const uint32_t slot_index);
+        ResourceSlot* GetSlot(const GpuResourceHandle& handle);
+        const ResourceSlot* GetSlot(const GpuResourceHandle& handle) const;
+        GpuResourceHandle AllocateSlot(const GpuResourceType resource_type);
+        void UpdateVertexRanges(
+            const uint32_t slot_index,
+            const std::vector<GRAPHICS::Vertex>& vertices,
+            std::vector<GRAPHICS::VertexRange>& changed_ranges);
+        void MarkResident(const uint32_t slot_index);
+        void MarkUsed(const uint32_t slot_index);
+        void FreeDeviceMemory(const uint32_t slot_index);
+        void Evict(const uint32_t slot_index);
+        void EvictUntilWithinBudget();
+
+        // MEMBER VARIABLES.
+        /// The graphics device on which resources are allocated.
+        std::shared_ptr<OPEN_GL::GraphicsDevice> GraphicsDevice;
+        /// The arena from which most vertex buffers are sub-allocated.
+        VertexBufferArena Arena;
+        /// All slots for resources, including free ones.
+        std::vector<ResourceSlot> Slots;
+        /// The indices of free slots that can be reused.
+        std::vector<uint32_t> FreeSlotIndices;
+        /// All vertex uploads, including free ones.
+        std::vector<VertexUpload> VertexUploads;
+        /// The indices of free vertex uploads that can be reused.
+        std::vector<uint32_t> FreeVertexUploadIndices;
+        /// The indices of vertex uploads in use, keyed by the hash of their vertices.
+        std::unordered_multimap<uint64_t, uint32_t> VertexUploadIndicesByHash;
+        /// The indices of slots with resident resources, ordered from least to most recently used.
+        std::list<uint32_t> LeastRecentlyUsedSlotIndices;
+        /// The number of bytes used by resident resources of each type.
+        std::array<uint64_t, static_cast<std::size_t>(GpuResourceType::COUNT)> ResidentByteCounts;
+        /// The current frame, incremented by AdvanceFrame().
+        uint64_t CurrentFrame;
+    };
+}
+}
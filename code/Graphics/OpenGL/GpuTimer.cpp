@@ -0,0 +1,278 @@
+#include <utility>
+#include "Graphics/OpenGL/GpuTimer.h"
+
+namespace GRAPHICS
+{
+namespace OPEN_GL
+{
+    /// Attempts to create a GPU timer.
+    /// @return The GPU timer, if timer queries are supported; null otherwise.
+    std::unique_ptr<GpuTimer> GpuTimer::Create()
+    {
+        // MAKE SURE TIMER QUERIES ARE SUPPORTED.
+        bool timer_queries_supported = OpenGLTimestampQuerySource::Supported();
+        if (!timer_queries_supported)
+        {
+            return nullptr;
+        }
+
+        // CREATE THE TIMER.
+        std::unique_ptr<GpuTimestampQuerySource> query_source = std::make_unique<OpenGLTimestampQuerySource>();
+        std::unique_ptr<GpuTimer> gpu_timer = std::make_unique<GpuTimer>(std::move(query_source));
+        return gpu_timer;
+    }
+
+    /// Constructor.  Query objects are only created once passes are timed.
+    /// @param[in]  query_source - The source of timestamp queries.
+    GpuTimer::GpuTimer(std::unique_ptr<GpuTimestampQuerySource>&& query_source) :
+        LatestFrameTimings(),
+        LatestFrameLatencyInFrames(0),
+        DiscardedFrameCount(0),
+        AveragedFrameCount(0),
+        QuerySource(std::move(query_source)),
+        QueryIds(),
+        FreeQueryIds(),
+        CurrentFrame(),
+        OpenPassIndices(),
+        PendingFrames(),
+        PassTimingTotals()
+    {}
+
+    /// Destructor that deletes all query objects.  For OpenGL queries, the context must still exist.
+    GpuTimer::~GpuTimer()
+    {
+        bool queries_created = !QueryIds.empty();
+        if (queries_created)
+        {
+            QuerySource->DeleteQueries(static_cast<GLsizei>(QueryIds.size()), QueryIds.data());
+        }
+    }
+
+    /// Begins timing a pass.  Passes may be nested but must be ended in the reverse order they began.
+    /// @param[in]  name - The name of the pass.
+    void GpuTimer::BeginPass(const std::string& name)
+    {
+        // RECORD THE START OF THE PASS.
+        PendingPass pass;
+        pass.Timing.Name = name;
+        pass.Timing.Depth = static_cast<unsigned int>(OpenPassIndices.size());
+        pass.StartQueryId = IssueTimestampQuery();
+        pass.CpuStartTime = std::chrono::high_resolution_clock::now();
+
+        // TRACK THE PASS UNTIL IT ENDS.
+        OpenPassIndices.push_back(CurrentFrame.Passes.size());
+        CurrentFrame.Passes.push_back(pass);
+    }
+
+    /// Ends timing the most recently begun pass that hasn't yet ended.
+    void GpuTimer::EndPass()
+    {
+        // MAKE SURE A PASS IS OPEN.
+        bool pass_open = !OpenPassIndices.empty();
+        if (!pass_open)
+        {
+            return;
+        }
+
+        // RECORD THE END OF THE PASS.
+        PendingPass& pass = CurrentFrame.Passes[OpenPassIndices.back()];
+        OpenPassIndices.pop_back();
+        auto cpu_end_time = std::chrono::high_resolution_clock::now();
+        const double MILLISECONDS_PER_SECOND = 1000.0;
+        double cpu_time_in_seconds = std::chrono::duration_cast<std::chrono::duration<double>>(cpu_end_time - pass.CpuStartTime).count();
+        pass.Timing.CpuTimeInMilliseconds = cpu_time_in_seconds * MILLISECONDS_PER_SECOND;
+        pass.EndQueryId = IssueTimestampQuery();
+        CurrentFrame.LastQueryId = pass.EndQueryId;
+    }
+
+    /// Marks the end of a frame, ending any passes still open and reading
+    /// results for any earlier frames that have become available.
+    void GpuTimer::EndFrame()
+    {
+        // END ANY PASSES STILL OPEN.
+        while (!OpenPassIndices.empty())
+        {
+            EndPass();
+        }
+
+        // WAIT FOR RESULTS FOR THE FRAME IF ANY PASSES WERE TIMED.
+        bool passes_timed = !CurrentFrame.Passes.empty();
+        if (passes_timed)
+        {
+            PendingFrames.push_back(CurrentFrame);
+        }
+
+        // START THE NEXT FRAME.
+        uint64_t next_frame_number = CurrentFrame.FrameNumber + 1;
+        CurrentFrame = PendingFrame();
+        CurrentFrame.FrameNumber = next_frame_number;
+
+        // READ ANY RESULTS THAT HAVE ARRIVED.
+        ReadAvailableResults();
+
+        // DISCARD RESULTS THAT ARE TAKING TOO LONG TO ARRIVE.
+        while (PendingFrames.size() > MAX_PENDING_FRAME_COUNT)
+        {
+            Recycle(PendingFrames.front());
+            PendingFrames.pop_front();
+            ++DiscardedFrameCount;
+        }
+    }
+
+    /// Computes the average timing of each pass over all frames with available results
+    /// since averages were last reset.  Passes are identified by their names and depths.
+    /// @return The average timing of each pass, in the order the passes were first timed.
+    std::vector<GpuTimer::PassTiming> GpuTimer::AveragePassTimings() const
+    {
+        std::vector<PassTiming> average_pass_timings;
+        for (const PassTimingTotal& pass_timing_total : PassTimingTotals)
+        {
+            PassTiming average_pass_timing = pass_timing_total.Timing;
+            double sample_count = static_cast<double>(pass_timing_total.SampleCount);
+            average_pass_timing.CpuTimeInMilliseconds /= sample_count;
+            average_pass_timing.GpuTimeInMilliseconds /= sample_count;
+            average_pass_timings.push_back(average_pass_timing);
+        }
+        return average_pass_timings;
+    }
+
+    /// Starts averaging timings over only frames whose results become available after this call.
+    void GpuTimer::ResetAverages()
+    {
+        PassTimingTotals.clear();
+        AveragedFrameCount = 0;
+    }
+
+    /// Issues a query for the GPU's timestamp once it reaches all previously submitted commands.
+    /// @return The ID of the query.
+    GLuint GpuTimer::IssueTimestampQuery()
+    {
+        // CREATE MORE QUERIES IF THE POOL IS EMPTY.
+        bool free_query_exists = !FreeQueryIds.empty();
+        if (!free_query_exists)
+        {
+            std::size_t first_new_query_index = QueryIds.size();
+            QueryIds.resize(first_new_query_index + QUERY_ALLOCATION_COUNT);
+            QuerySource->CreateQueries(static_cast<GLsizei>(QUERY_ALLOCATION_COUNT), &QueryIds[first_new_query_index]);
+            FreeQueryIds.insert(FreeQueryIds.end(), QueryIds.begin() + first_new_query_index, QueryIds.end());
+        }
+
+        // ISSUE THE QUERY.
+        GLuint query_id = FreeQueryIds.back();
+        FreeQueryIds.pop_back();
+        QuerySource->IssueTimestampQuery(query_id);
+        return query_id;
+    }
+
+    /// Reads results for all pending frames whose results are available, without waiting.
+    /// The timings for the newest such frame become the latest timings.
+    void GpuTimer::ReadAvailableResults()
+    {
+        while (!PendingFrames.empty())
+        {
+            // STOP IF THE OLDEST FRAME'S RESULTS AREN'T AVAILABLE YET.
+            // Results for later frames can't be available before earlier ones.
+            PendingFrame& oldest_frame = PendingFrames.front();
+            bool results_available = QuerySource->ResultAvailable(oldest_frame.LastQueryId);
+            if (!results_available)
+            {
+                break;
+            }
+
+            // READ THE TIMING FOR EACH PASS.
+            LatestFrameTimings.clear();
+            for (PendingPass& pass : oldest_frame.Passes)
+            {
+                uint64_t start_timestamp_in_nanoseconds = QuerySource->ReadTimestampInNanoseconds(pass.StartQueryId);
+                uint64_t end_timestamp_in_nanoseconds = QuerySource->ReadTimestampInNanoseconds(pass.EndQueryId);
+
+                // Timestamps are only guaranteed to increase, so differences are clamped at zero for safety.
+                uint64_t gpu_time_in_nanoseconds = 0;
+                if (end_timestamp_in_nanoseconds > start_timestamp_in_nanoseconds)
+                {
+                    gpu_time_in_nanoseconds = end_timestamp_in_nanoseconds - start_timestamp_in_nanoseconds;
+                }
+                const double NANOSECONDS_PER_MILLISECOND = 1000000.0;
+                pass.Timing.GpuTimeInMilliseconds = static_cast<double>(gpu_time_in_nanoseconds) / NANOSECONDS_PER_MILLISECOND;
+                LatestFrameTimings.push_back(pass.Timing);
+                AddToTotals(pass.Timing);
+            }
+            LatestFrameLatencyInFrames = CurrentFrame.FrameNumber - oldest_frame.FrameNumber;
+            ++AveragedFrameCount;
+
+            // RETURN THE FRAME'S QUERIES TO THE POOL.
+            Recycle(oldest_frame);
+            PendingFrames.pop_front();
+        }
+    }
+
+    /// Returns all queries used by a frame to the pool.
+    /// @param[in]  frame - The frame whose queries are no longer needed.
+    void GpuTimer::Recycle(const PendingFrame& frame)
+    {
+        for (const PendingPass& pass : frame.Passes)
+        {
+            FreeQueryIds.push_back(pass.StartQueryId);
+            FreeQueryIds.push_back(pass.EndQueryId);
+        }
+    }
+
+    /// Adds a pass's timing to the totals being averaged.
+    /// @param[in]  pass_timing - The timing of the pass.
+    void GpuTimer::AddToTotals(const PassTiming& pass_timing)
+    {
+        // FIND THE TOTAL FOR THE PASS.
+        PassTimingTotal* pass_timing_total = nullptr;
+        for (PassTimingTotal& existing_pass_timing_total : PassTimingTotals)
+        {
+            bool same_pass = (
+                (existing_pass_timing_total.Timing.Name == pass_timing.Name) &&
+                (existing_pass_timing_total.Timing.Depth == pass_timing.Depth));
+            if (same_pass)
+            {
+                pass_timing_total = &existing_pass_timing_total;
+                break;
+            }
+        }
+
+        // START A NEW TOTAL IF THE PASS HASN'T BEEN TIMED YET.
+        bool pass_timed_before = (nullptr != pass_timing_total);
+        if (!pass_timed_before)
+        {
+            PassTimingTotal new_pass_timing_total;
+            new_pass_timing_total.Timing.Name = pass_timing.Name;
+            new_pass_timing_total.Timing.Depth = pass_timing.Depth;
+            PassTimingTotals.push_back(new_pass_timing_total);
+            pass_timing_total = &PassTimingTotals.back();
+        }
+
+        // ADD THE TIMING.
+        pass_timing_total->Timing.CpuTimeInMilliseconds += pass_timing.CpuTimeInMilliseconds;
+        pass_timing_total->Timing.GpuTimeInMilliseconds += pass_timing.GpuTimeInMilliseconds;
+        ++pass_timing_total->SampleCount;
+    }
+
+    /// Constructor that begins timing a pass.
+    /// @param[in]  gpu_timer - The timer to time the pass.  Nothing is timed if null.
+    /// @param[in]  pass_name - The name of the pass.
+    GpuTimerScope::GpuTimerScope(OPEN_GL::GpuTimer* const gpu_timer, const std::string& pass_name) :
+        GpuTimer(gpu_timer)
+    {
+        bool timing_supported = (nullptr != GpuTimer);
+        if (timing_supported)
+        {
+            GpuTimer->BeginPass(pass_name);
+        }
+    }
+
+    /// Destructor that ends timing the pass.
+    GpuTimerScope::~GpuTimerScope()
+    {
+        bool timing_supported = (nullptr != GpuTimer);
+        if (timing_supported)
+        {
+            GpuTimer->EndPass();
+        }
+    }
+}
+}
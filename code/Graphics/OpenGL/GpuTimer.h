@@ -0,0 +1,153 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Graphics/OpenGL/GpuTimestampQuerySource.h"
+#include "Graphics/OpenGL/OpenGL.h"
+
+namespace GRAPHICS
+{
+namespace OPEN_GL
+{
+    /// Measures how long the GPU (and CPU) spends on named passes within each frame.
+    ///
+    /// A timestamp query is issued (via glQueryCounter) at the start and end of each pass,
+    /// which, unlike GL_TIME_ELAPSED queries, allows passes to be nested.  The GPU only
+    /// writes timestamps once it reaches them, so results are read back several frames
+    /// later, and only once they're reported as available, so that reading them never
+    /// stalls the CPU.  Query objects are recycled through a pool to avoid creating
+    /// new ones every frame.  Timings for each pass are also averaged over frames until
+    /// the averages are reset, smoothing out variation between individual frames.
+    ///
+    /// Queries are issued through a query source, so a fake source returning synthetic
+    /// results can be used in place of the OpenGL driver for testing.
+    ///
+    /// Requires OpenGL 3.3 or ARB_timer_query.
+    class GpuTimer
+    {
+    public:
+        // CONSTANTS.
+        /// The number of query objects created at once when the pool runs out.
+        static const unsigned int QUERY_ALLOCATION_COUNT = 64;
+        /// The maximum number of frames that may be waiting for results.  Results for
+        /// older frames are discarded so that queries aren't leaked if results never arrive.
+        static const unsigned int MAX_PENDING_FRAME_COUNT = 8;
+
+        // PUBLIC TYPES.
+        /// The time spent on a single pass within a frame.
+        struct PassTiming
+        {
+            /// The name of the pass.
+            std::string Name = "";
+            /// The number of passes the pass is nested within.
+            unsigned int Depth = 0;
+            /// The time the CPU spent between the start and end of the pass, in milliseconds.
+            double CpuTimeInMilliseconds = 0.0;
+            /// The time the GPU spent between the start and end of the pass, in milliseconds.
+            double GpuTimeInMilliseconds = 0.0;
+        };
+
+        // CONSTRUCTION.
+        static std::unique_ptr<GpuTimer> Create();
+        explicit GpuTimer(std::unique_ptr<GpuTimestampQuerySource>&& query_source);
+        ~GpuTimer();
+
+        // TIMING.
+        void BeginPass(const std::string& name);
+        void EndPass();
+        void EndFrame();
+
+        // AVERAGES.
+        std::vector<PassTiming> AveragePassTimings() const;
+        void ResetAverages();
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The timings of passes in the most recent frame with available results,
+        /// in the order that the passes began.
+        std::vector<PassTiming> LatestFrameTimings;
+        /// The number of frames between the frame the latest timings are from and the current frame.
+        uint64_t LatestFrameLatencyInFrames;
+        /// The total number of frames whose results were discarded because they took too long to arrive.
+        uint64_t DiscardedFrameCount;
+        /// The number of frames with available results since averages were last reset.
+        uint64_t AveragedFrameCount;
+
+    private:
+        // PRIVATE TYPES.
+        /// A pass whose GPU results haven't been read yet.
+        struct PendingPass
+        {
+            /// The timing of the pass, with the GPU time filled in once results are available.
+            PassTiming Timing = {};
+            /// The query for the timestamp at the start of the pass.
+            GLuint StartQueryId = INVALID_ID;
+            /// The query for the timestamp at the end of the pass.
+            GLuint EndQueryId = INVALID_ID;
+            /// When the CPU started the pass.
+            std::chrono::high_resolution_clock::time_point CpuStartTime = {};
+        };
+
+        /// The total time spent on a pass over all frames being averaged.
+        struct PassTimingTotal
+        {
+            /// The sum of the pass's timings, identified by the pass's name and depth.
+            PassTiming Timing = {};
+            /// The number of times the pass was timed.
+            uint64_t SampleCount = 0;
+        };
+
+        /// A frame whose GPU results haven't been read yet.
+        struct PendingFrame
+        {
+            /// The number of the frame (counting from 0).
+            uint64_t FrameNumber = 0;
+            /// The passes in the frame, in the order they began.
+            std::vector<PendingPass> Passes = {};
+            /// The last query issued in the frame.  Queries finish in order, so all
+            /// results in the frame are available once this query's result is.
+            GLuint LastQueryId = INVALID_ID;
+        };
+
+        // HELPER METHODS.
+        GLuint IssueTimestampQuery();
+        void ReadAvailableResults();
+        void Recycle(const PendingFrame& frame);
+        void AddToTotals(const PassTiming& pass_timing);
+
+        // MEMBER VARIABLES.
+        /// The source of timestamp queries.
+        std::unique_ptr<GpuTimestampQuerySource> QuerySource;
+        /// All query objects created by the timer.
+        std::vector<GLuint> QueryIds;
+        /// Query objects that aren't currently in use.
+        std::vector<GLuint> FreeQueryIds;
+        /// The frame currently being timed.
+        PendingFrame CurrentFrame;
+        /// The indices of passes in the current frame that have begun but not ended, innermost last.
+        std::vector<std::size_t> OpenPassIndices;
+        /// Completed frames waiting for GPU results, from oldest to newest.
+        std::deque<PendingFrame> PendingFrames;
+        /// The totals of each pass timed since averages were last reset, in the order the passes were first timed.
+        std::vector<PassTimingTotal> PassTimingTotals;
+    };
+
+    /// Times a pass for as long as the scope exists, beginning the pass when constructed
+    /// and ending it when destroyed.
+    class GpuTimerScope
+    {
+    public:
+        // CONSTRUCTION/DESTRUCTION.
+        explicit GpuTimerScope(OPEN_GL::GpuTimer* const gpu_timer, const std::string& pass_name);
+        ~GpuTimerScope();
+
+    private:
+        // MEMBER VARIABLES.
+        /// The timer timing the pass.  Null if timing isn't supported.
+        OPEN_GL::GpuTimer* const GpuTimer;
+    };
+}
+}
@@ -0,0 +1,63 @@
+#include "Graphics/OpenGL/GpuTimestampQuerySource.h"
+
+namespace GRAPHICS
+{
+namespace OPEN_GL
+{
+    /// Determines if the OpenGL functions for timestamp queries have been loaded.
+    /// @return True if timestamp queries are supported; false otherwise.
+    bool OpenGLTimestampQuerySource::Supported()
+    {
+        bool timer_query_functions_loaded = (
+            (nullptr != glGenQueries) &&
+            (nullptr != glDeleteQueries) &&
+            (nullptr != glGetQueryObjectiv) &&
+            (nullptr != glQueryCounter) &&
+            (nullptr != glGetQueryObjectui64v));
+        return timer_query_functions_loaded;
+    }
+
+    /// Creates query objects.
+    /// @param[in]  query_count - The number of query objects to create.
+    /// @param[out] query_ids - The IDs of the created query objects.
+    void OpenGLTimestampQuerySource::CreateQueries(const GLsizei query_count, GLuint* const query_ids)
+    {
+        glGenQueries(query_count, query_ids);
+    }
+
+    /// Deletes query objects.  The OpenGL context must still exist.
+    /// @param[in]  query_count - The number of query objects to delete.
+    /// @param[in]  query_ids - The IDs of the query objects to delete.
+    void OpenGLTimestampQuerySource::DeleteQueries(const GLsizei query_count, const GLuint* const query_ids)
+    {
+        glDeleteQueries(query_count, query_ids);
+    }
+
+    /// Issues a query for the GPU's timestamp once it reaches all previously submitted commands.
+    /// @param[in]  query_id - The ID of the query.
+    void OpenGLTimestampQuerySource::IssueTimestampQuery(const GLuint query_id)
+    {
+        glQueryCounter(query_id, GL_TIMESTAMP);
+    }
+
+    /// Determines if a query's result can be read without waiting for the GPU.
+    /// @param[in]  query_id - The ID of the query.
+    /// @return True if the result is available; false otherwise.
+    bool OpenGLTimestampQuerySource::ResultAvailable(const GLuint query_id)
+    {
+        GLint result_available = GL_FALSE;
+        glGetQueryObjectiv(query_id, GL_QUERY_RESULT_AVAILABLE, &result_available);
+        return (GL_TRUE == result_available);
+    }
+
+    /// Reads the timestamp recorded by a query.  Waits for the GPU if the result isn't available.
+    /// @param[in]  query_id - The ID of the query.
+    /// @return The timestamp, in nanoseconds.
+    uint64_t OpenGLTimestampQuerySource::ReadTimestampInNanoseconds(const GLuint query_id)
+    {
+        GLuint64 timestamp_in_nanoseconds = 0;
+        glGetQueryObjectui64v(query_id, GL_QUERY_RESULT, &timestamp_in_nanoseconds);
+        return static_cast<uint64_t>(timestamp_in_nanoseconds);
+    }
+}
+}
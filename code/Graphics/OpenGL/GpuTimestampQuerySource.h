@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstdint>
+#include "Graphics/OpenGL/OpenGL.h"
+
+namespace GRAPHICS
+{
+namespace OPEN_GL
+{
+    /// A source of GPU timestamp queries, allowing GpuTimer to be driven by synthetic
+    /// results (such as for testing) instead of the OpenGL driver.
+    class GpuTimestampQuerySource
+    {
+    public:
+        // DESTRUCTION.
+        virtual ~GpuTimestampQuerySource() = default;
+
+        // QUERY OBJECTS.
+        /// Creates query objects.
+        /// @param[in]  query_count - The number of query objects to create.
+        /// @param[out] query_ids - The IDs of the created query objects.
+        virtual void CreateQueries(const GLsizei query_count, GLuint* const query_ids) = 0;
+        /// Deletes query objects.
+        /// @param[in]  query_count - The number of query objects to delete.
+        /// @param[in]  query_ids - The IDs of the query objects to delete.
+        virtual void DeleteQueries(const GLsizei query_count, const GLuint* const query_ids) = 0;
+
+        // TIMESTAMPS.
+        /// Issues a query for the GPU's timestamp once it reaches all previously submitted commands.
+        /// @param[in]  query_id - The ID of the query.
+        virtual void IssueTimestampQuery(const GLuint query_id) = 0;
+        /// Determines if a query's result can be read without waiting for the GPU.
+        /// @param[in]  query_id - The ID of the query.
+        /// @return True if the result is available; false otherwise.
+        virtual bool ResultAvailable(const GLuint query_id) = 0;
+        /// Reads the timestamp recorded by a query.  Waits for the GPU if the result isn't available.
+        /// @param[in]  query_id - The ID of the query.
+        /// @return The timestamp, in nanoseconds.
+        virtual uint64_t ReadTimestampInNanoseconds(const GLuint query_id) = 0;
+    };
+
+    /// Timestamp queries issued to the OpenGL driver.  Requires OpenGL 3.3 or ARB_timer_query.
+    class OpenGLTimestampQuerySource : public GpuTimestampQuerySource
+    {
+    public:
+        // CONSTRUCTION.
+        static bool Supported();
+
+        // QUERY OBJECTS.
+        void CreateQueries(const GLsizei query_count, GLuint* const query_ids) override;
+        void DeleteQueries(const GLsizei query_count, const GLuint* const query_ids) override;
+
+        // TIMESTAMPS.
+        void IssueTimestampQuery(const GLuint query_id) override;
+        bool ResultAvailable(const GLuint query_id) override;
+        uint64_t ReadTimestampInNanoseconds(const GLuint query_id) override;
+    };
+}
+}
@@ -7,14 +7,19 @@ namespace OPEN_GL
     /// Attempts to crete a graphics device using OpenGL for the provided window.
     /// @param[in]  device_context - The handle to the device context for which the graphics device
     ///     should be created.
+    /// @param[in]  debug_output_enabled - True to create a debug context whose debug messages are
+    ///     logged as they're reported (if supported); false to create a regular context without
+    ///     any error reporting, which avoids the overhead of the driver validating calls.
     /// @return The graphics device, if successfully created; null otherwise.
-    std::shared_ptr<GraphicsDevice> GraphicsDevice::Create(const HDC device_context)
+    std::shared_ptr<GraphicsDevice> GraphicsDevice::Create(const HDC device_context, const bool debug_output_enabled)
     {
         // CREATE THE OPEN GL RENDERING CONTEXT.
         const HGLRC NO_CONTEXT_TO_SHARE_WITH = nullptr;
+        const int NO_CONTEXT_FLAGS = 0;
+        const int context_flags = debug_output_enabled ? WGL_CONTEXT_DEBUG_BIT_ARB : NO_CONTEXT_FLAGS;
         const int context_attribute_list[] =
         {
-            WGL_CONTEXT_FLAGS_ARB, WGL_CONTEXT_DEBUG_BIT_ARB,
+            WGL_CONTEXT_FLAGS_ARB, context_flags,
             ATTRIBUTE_LIST_TERMINATOR
         };
         HGLRC open_gl_render_context = wglCreateContextAttribsARB(device_context, NO_CONTEXT_TO_SHARE_WITH, context_attribute_list);
@@ -23,11 +28,26 @@ namespace OPEN_GL
         {
             return nullptr;
         }
+
+        // DETECT WHICH OPTIONAL FUNCTIONS THE RENDERING CONTEXT SUPPORTS.
+        DetectSupportedFunctions();
         
         // CREATE THE GRAPHICS DEVICE.
         std::shared_ptr<GraphicsDevice> graphics_device = std::make_shared<GraphicsDevice>(
             device_context,
             open_gl_render_context);
+
+        // LOG DEBUG MESSAGES AS THEY'RE REPORTED IF DEBUGGING.
+        // This replaces polling glGetError(), which can force the CPU to wait for the GPU.
+        bool debug_message_callback_supported = (nullptr != glDebugMessageCallback);
+        bool debug_message_log_enabled = (debug_output_enabled && debug_message_callback_supported);
+        if (debug_message_log_enabled)
+        {
+            graphics_device->DebugMessageLog = std::make_unique<OPEN_GL::DebugMessageLog>();
+            glEnable(GL_DEBUG_OUTPUT);
+            glDebugMessageCallback(&DebugMessageLog::HandleDebugMessage, graphics_device->DebugMessageLog.get());
+        }
+
         return graphics_device;
     }
 
@@ -36,14 +56,63 @@ namespace OPEN_GL
     /// @param[in]  open_gl_render_context - The OpenGL rendering context.
     GraphicsDevice::GraphicsDevice(const HDC device_context, const HGLRC open_gl_render_context) :
         DeviceContext(device_context),
+        CurrentFramePipelineStatistics(),
+        PreviousFramePipelineStatistics(),
+        ShaderProgramBinaryCache(),
+        DebugMessageLog(),
+        FrameFenceWaitTimeInMilliseconds(0.0),
+        TotalFrameFenceWaitTimeInSeconds(0.0),
+        ResourceDeletionQueue(),
+        GpuTimer(OPEN_GL::GpuTimer::Create()),
         OpenGLRenderContext(open_gl_render_context),
+        ParallelShaderCompileSupported(nullptr != glMaxShaderCompilerThreadsARB),
+        SeparateVertexAttributeFormatsSupported(
+            DirectStateAccessSupported() || (
+                (nullptr != glVertexAttribFormat) &&
+                (nullptr != glVertexAttribBinding) &&
+                (nullptr != glBindVertexBuffer) &&
+                (nullptr != glVertexBindingDivisor))),
+        CurrentShaderProgram(nullptr),
+        FrameContexts(),
+        CurrentFrameContextIndex(0),
+        CurrentVertexArrayId(INVALID_ID),
+        CurrentPipelineState(nullptr),
+        CurrentFixedFunctionState(),
+        PipelineStatesByHash(),
+        InputFormatVertexArrays(),
         VertexBuffers(),
-        ShaderPrograms()
-    {}
+        StreamingVertexBuffers(),
+        InstanceBuffers(),
+        IndirectDrawBuffers(),
+        ShaderPrograms(),
+        PendingShaderPrograms()
+    {
+        // NUMBER THE FRAME CONTEXTS.
+        for (unsigned int frame_context_index = 0; frame_context_index < MAX_FRAMES_IN_FLIGHT; ++frame_context_index)
+        {
+            FrameContexts[frame_context_index].Index = frame_context_index;
+        }
+
+        // LET THE DRIVER CHOOSE HOW MANY THREADS TO COMPILE SHADERS WITH.
+        if (ParallelShaderCompileSupported)
+        {
+            const GLuint DRIVER_CHOSEN_THREAD_COUNT = 0xFFFFFFFF;
+            glMaxShaderCompilerThreadsARB(DRIVER_CHOSEN_THREAD_COUNT);
+        }
+    }
 
     /// Destructor that deletes resources and the OpenGL rendering context for the device.
     GraphicsDevice::~GraphicsDevice()
     {
+        // STOP LOGGING DEBUG MESSAGES SINCE THE LOG WILL BE DESTROYED WITH THE DEVICE.
+        bool debug_message_log_enabled = (nullptr != DebugMessageLog);
+        if (debug_message_log_enabled)
+        {
+            const GLDEBUGPROC NO_CALLBACK = nullptr;
+            const void* const NO_USER_PARAMETER = nullptr;
+            glDebugMessageCallback(NO_CALLBACK, NO_USER_PARAMETER);
+        }
+
         // DELETE SHADER PROGRAMS.
         for (const auto& shader_program : ShaderPrograms)
         {
@@ -63,6 +132,23 @@ namespace OPEN_GL
             glDeleteShader(shader_program->VertexShader.Id);
         }
 
+        // DELETE ANY REMAINING FRAME FENCES.
+        for (const FrameContext& frame_context : FrameContexts)
+        {
+            bool frame_fence_exists = (nullptr != frame_context.Fence);
+            if (frame_fence_exists)
+            {
+                glDeleteSync(frame_context.Fence);
+            }
+        }
+
+        // DELETE VERTEX ARRAYS FOR SHADER INPUT FORMATS.
+        for (const auto& input_format_vertex_array : InputFormatVertexArrays)
+        {
+            const GLsizei ONE_ARRAY = 1;
+            glDeleteVertexArrays(ONE_ARRAY, &input_format_vertex_array.ArrayId);
+        }
+
         // DELETE VERTEX BUFFERS/ARRAYS.
         for (const auto& vertex_buffer : VertexBuffers)
         {
@@ -80,9 +166,79 @@ namespace OPEN_GL
 
             // DELETE THE VERTEX ARRAY.
             const GLsizei ONE_ARRAY = 1;
-            glDeleteBuffers(ONE_ARRAY, &vertex_buffer->ArrayId);
+            glDeleteVertexArrays(ONE_ARRAY, &vertex_buffer->ArrayId);
+        }
+
+        // DELETE STREAMING VERTEX BUFFERS/ARRAYS.
+        for (const auto& streaming_vertex_buffer : StreamingVertexBuffers)
+        {
+            // MAKE SURE THE STREAMING VERTEX BUFFER EXISTS.
+            bool streaming_vertex_buffer_exists = (nullptr != streaming_vertex_buffer);
+            if (!streaming_vertex_buffer_exists)
+            {
+                // Continue trying to delete other streaming vertex buffers that still exist.
+                continue;
+            }
+
+            // DELETE ANY REMAINING FENCES.
+            for (GLsync region_fence : streaming_vertex_buffer->RegionFences)
+            {
+                bool region_fence_exists = (nullptr != region_fence);
+                if (region_fence_exists)
+                {
+                    glDeleteSync(region_fence);
+                }
+            }
+
+            // UNMAP AND DELETE THE VERTEX BUFFER.
+            UnmapBufferObject(streaming_vertex_buffer->BufferId);
+            const GLsizei ONE_BUFFER = 1;
+            glDeleteBuffers(ONE_BUFFER, &streaming_vertex_buffer->BufferId);
+
+            // DELETE THE VERTEX ARRAY.
+            const GLsizei ONE_ARRAY = 1;
+            glDeleteVertexArrays(ONE_ARRAY, &streaming_vertex_buffer->ArrayId);
+        }
+
+        // DELETE INSTANCE BUFFERS.
+        for (const auto& instance_buffer : InstanceBuffers)
+        {
+            // MAKE SURE THE INSTANCE BUFFER EXISTS.
+            bool instance_buffer_exists = (nullptr != instance_buffer);
+            if (!instance_buffer_exists)
+            {
+                // Continue trying to delete other instance buffers that still exist.
+                continue;
+            }
+
+            // DELETE THE INSTANCE BUFFER.
+            const GLsizei ONE_BUFFER = 1;
+            glDeleteBuffers(ONE_BUFFER, &instance_buffer->BufferId);
+        }
+
+        // DELETE INDIRECT DRAW BUFFERS.
+        for (const auto& indirect_draw_buffer : IndirectDrawBuffers)
+        {
+            // MAKE SURE THE INDIRECT DRAW BUFFER EXISTS.
+            bool indirect_draw_buffer_exists = (nullptr != indirect_draw_buffer);
+            if (!indirect_draw_buffer_exists)
+            {
+                // Continue trying to delete other indirect draw buffers that still exist.
+                continue;
+            }
+
+            // DELETE THE INDIRECT DRAW BUFFER.
+            const GLsizei ONE_BUFFER = 1;
+            glDeleteBuffers(ONE_BUFFER, &indirect_draw_buffer->BufferId);
         }
 
+        // DELETE THE GPU TIMER'S QUERIES WHILE THE RENDERING CONTEXT STILL EXISTS.
+        GpuTimer.reset();
+
+        // DELETE OBJECTS STILL WAITING IN THE DELETION QUEUE.
+        // The rendering context is about to be deleted, so there's no point waiting for the GPU.
+        ResourceDeletionQueue.DeleteAll();
+
         // DELETE THE RENDERING CONTEXT.
         wglDeleteContext(OpenGLRenderContext);
     }
@@ -91,15 +247,17 @@ namespace OPEN_GL
     /// @return A new vertex buffer, if successfully created; null otherwise.
     std::shared_ptr<VertexBuffer> GraphicsDevice::CreateVertexBuffer()
     {
-        // ALLOCATE A VERTEX ARRAY.
-        const GLsizei ONE_VERTEX_ARRAY = 1;
+        // ALLOCATE A VERTEX ARRAY IF INPUTS MUST BE SET RELATIVE TO EACH BUFFER.
+        // Otherwise, the buffer is attached to the vertex array of the shader program in use.
         GLuint array_id = INVALID_ID;
-        glGenVertexArrays(ONE_VERTEX_ARRAY, &array_id);
+        if (!SeparateVertexAttributeFormatsSupported)
+        {
+            const GLsizei ONE_VERTEX_ARRAY = 1;
+            glGenVertexArrays(ONE_VERTEX_ARRAY, &array_id);
+        }
 
         // ALLOCATE A VERTEX BUFFER.
-        const GLsizei ONE_VERTEX_BUFFER = 1;
-        GLuint buffer_id = INVALID_ID;
-        glGenBuffers(ONE_VERTEX_BUFFER, &buffer_id);
+        GLuint buffer_id = CreateBufferObject();
 
         // CREATE AND STORE THE VERTEX BUFFER.
         std::shared_ptr<VertexBuffer> vertex_buffer = std::make_shared<VertexBuffer>(array_id, buffer_id);
@@ -107,66 +265,1032 @@ namespace OPEN_GL
         return vertex_buffer;
     }
 
-    /// Binds a vertex buffer for current use.
+    /// Binds a vertex buffer for current use as input to the shader program in use.
+    /// Must be called after Use() since vertex inputs are read according to the shader program.
     /// @param[in]  vertex_buffer - The vertex buffer to bind.
     void GraphicsDevice::Bind(const VertexBuffer& vertex_buffer)
     {
-        glBindVertexArray(vertex_buffer.ArrayId);
+        BindVertexBuffer(vertex_buffer.ArrayId, vertex_buffer.BufferId);
+    }
+
+    /// Destroys a vertex buffer, freeing its memory on the graphics device once the GPU
+    /// has finished any frames in flight.  The vertex buffer must not be used after being destroyed.
+    /// @param[in]  vertex_buffer - The vertex buffer to destroy.
+    void GraphicsDevice::Destroy(const std::shared_ptr<VertexBuffer>& vertex_buffer)
+    {
+        // MAKE SURE THE VERTEX BUFFER BELONGS TO THIS DEVICE.
+        auto device_vertex_buffer = std::find(VertexBuffers.begin(), VertexBuffers.end(), vertex_buffer);
+        bool vertex_buffer_found = (VertexBuffers.end() != device_vertex_buffer);
+        if (!vertex_buffer_found)
+        {
+            return;
+        }
+
+        // QUEUE THE VERTEX BUFFER AND ARRAY FOR DELETION.
+        uint64_t frame_number = CurrentFrameContext().FrameNumber;
+        ResourceDeletionQueue.QueueBuffer(vertex_buffer->BufferId, frame_number);
+        ResourceDeletionQueue.QueueVertexArray(vertex_buffer->ArrayId, frame_number);
+        ForgetBoundVertexArray(vertex_buffer->ArrayId);
+
+        // STOP TRACKING THE VERTEX BUFFER.
+        VertexBuffers.erase(device_vertex_buffer);
+    }
+
+    /// Creates a streaming vertex buffer for vertices that change frequently.
+    /// Requires persistently mapped buffers (OpenGL 4.4 or ARB_buffer_storage).
+    /// @param[in]  max_vertex_count_per_region - The maximum number of vertices that
+    ///     can be written to a single region of the buffer (for example, per frame).
+    /// @return A new streaming vertex buffer, if successfully created; null otherwise
+    ///     (including if persistently mapped buffers are not supported).
+    std::shared_ptr<StreamingVertexBuffer> GraphicsDevice::CreateStreamingVertexBuffer(const unsigned int max_vertex_count_per_region)
+    {
+        // MAKE SURE PERSISTENTLY MAPPED BUFFERS ARE SUPPORTED.
+        bool persistent_mapping_supported = (nullptr != glBufferStorage);
+        if (!persistent_mapping_supported)
+        {
+            return nullptr;
+        }
+
+        // ALLOCATE A VERTEX ARRAY IF INPUTS MUST BE SET RELATIVE TO EACH BUFFER.
+        const GLsizei ONE_VERTEX_ARRAY = 1;
+        GLuint array_id = INVALID_ID;
+        if (!SeparateVertexAttributeFormatsSupported)
+        {
+            glGenVertexArrays(ONE_VERTEX_ARRAY, &array_id);
+        }
+
+        // ALLOCATE A VERTEX BUFFER.
+        const GLsizei ONE_VERTEX_BUFFER = 1;
+        GLuint buffer_id = CreateBufferObject();
+
+        // ALLOCATE IMMUTABLE STORAGE FOR ALL REGIONS OF THE BUFFER.
+        // The storage is coherent so that writes become visible to the graphics
+        // device without explicit flushing.
+        const GLbitfield STORAGE_FLAGS = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        GLsizeiptr buffer_size_in_bytes = static_cast<GLsizeiptr>(
+            StreamingVertexBuffer::REGION_COUNT *
+            max_vertex_count_per_region *
+            StreamingVertexBuffer::FLOAT_COUNT_PER_VERTEX *
+            sizeof(float));
+        const void* const NO_INITIAL_DATA = nullptr;
+        const GLintptr START_OF_BUFFER = 0;
+        void* mapped_vertex_data = nullptr;
+        if (DirectStateAccessSupported())
+        {
+            glNamedBufferStorage(buffer_id, buffer_size_in_bytes, NO_INITIAL_DATA, STORAGE_FLAGS);
+
+            // PERSISTENTLY MAP THE ENTIRE BUFFER.
+            mapped_vertex_data = glMapNamedBufferRange(buffer_id, START_OF_BUFFER, buffer_size_in_bytes, STORAGE_FLAGS);
+        }
+        else
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, buffer_id);
+            glBufferStorage(GL_ARRAY_BUFFER, buffer_size_in_bytes, NO_INITIAL_DATA, STORAGE_FLAGS);
+
+            // PERSISTENTLY MAP THE ENTIRE BUFFER.
+            mapped_vertex_data = glMapBufferRange(GL_ARRAY_BUFFER, START_OF_BUFFER, buffer_size_in_bytes, STORAGE_FLAGS);
+        }
+        bool buffer_mapped = (nullptr != mapped_vertex_data);
+        if (!buffer_mapped)
+        {
+            glDeleteBuffers(ONE_VERTEX_BUFFER, &buffer_id);
+            glDeleteVertexArrays(ONE_VERTEX_ARRAY, &array_id);
+            return nullptr;
+        }
+
+        // CREATE AND STORE THE STREAMING VERTEX BUFFER.
+        std::shared_ptr<StreamingVertexBuffer> streaming_vertex_buffer = std::make_shared<StreamingVertexBuffer>(
+            array_id,
+            buffer_id,
+            static_cast<float*>(mapped_vertex_data),
+            max_vertex_count_per_region);
+        StreamingVertexBuffers.push_back(streaming_vertex_buffer);
+        return streaming_vertex_buffer;
+    }
+
+    /// Binds a streaming vertex buffer for current use as input to the shader program in use.
+    /// Must be called after Use() since vertex inputs are read according to the shader program.
+    /// @param[in]  vertex_buffer - The streaming vertex buffer to bind.
+    void GraphicsDevice::Bind(const StreamingVertexBuffer& vertex_buffer)
+    {
+        BindVertexBuffer(vertex_buffer.ArrayId, vertex_buffer.BufferId);
     }
 
-    /// Creates a shader program from the provided description.
+    /// Destroys a streaming vertex buffer, freeing its memory on the graphics device once the GPU
+    /// has finished any frames in flight.  The vertex buffer must not be used after being destroyed.
+    /// @param[in]  vertex_buffer - The streaming vertex buffer to destroy.
+    void GraphicsDevice::Destroy(const std::shared_ptr<StreamingVertexBuffer>& vertex_buffer)
+    {
+        // MAKE SURE THE STREAMING VERTEX BUFFER BELONGS TO THIS DEVICE.
+        auto device_vertex_buffer = std::find(StreamingVertexBuffers.begin(), StreamingVertexBuffers.end(), vertex_buffer);
+        bool vertex_buffer_found = (StreamingVertexBuffers.end() != device_vertex_buffer);
+        if (!vertex_buffer_found)
+        {
+            return;
+        }
+
+        // DELETE ANY REMAINING FENCES.
+        // The frame fences already guard the buffer until its deletion, so region fences aren't needed.
+        for (GLsync& region_fence : vertex_buffer->RegionFences)
+        {
+            bool region_fence_exists = (nullptr != region_fence);
+            if (region_fence_exists)
+            {
+                glDeleteSync(region_fence);
+                region_fence = nullptr;
+            }
+        }
+
+        // UNMAP THE VERTEX BUFFER.
+        // The CPU won't write to the buffer again, so it can be unmapped immediately.
+        UnmapBufferObject(vertex_buffer->BufferId);
+
+        // QUEUE THE VERTEX BUFFER AND ARRAY FOR DELETION.
+        uint64_t frame_number = CurrentFrameContext().FrameNumber;
+        ResourceDeletionQueue.QueueBuffer(vertex_buffer->BufferId, frame_number);
+        ResourceDeletionQueue.QueueVertexArray(vertex_buffer->ArrayId, frame_number);
+        ForgetBoundVertexArray(vertex_buffer->ArrayId);
+
+        // STOP TRACKING THE STREAMING VERTEX BUFFER.
+        StreamingVertexBuffers.erase(device_vertex_buffer);
+    }
+
+    /// Creates a buffer for per-instance data.
+    /// @return A new instance buffer, if successfully created; null otherwise.
+    std::shared_ptr<InstanceBuffer> GraphicsDevice::CreateInstanceBuffer()
+    {
+        // ALLOCATE THE BUFFER.
+        GLuint buffer_id = CreateBufferObject();
+
+        // CREATE AND STORE THE INSTANCE BUFFER.
+        std::shared_ptr<InstanceBuffer> instance_buffer = std::make_shared<InstanceBuffer>(buffer_id);
+        InstanceBuffers.push_back(instance_buffer);
+        return instance_buffer;
+    }
+
+    /// Binds an instance buffer for current use as per-instance input to the shader program in use.
+    /// Must be called after binding the vertex buffer for the mesh being instanced.
+    /// @param[in]  instance_buffer - The instance buffer to bind.
+    /// @param[in]  first_instance_byte_offset - The number of bytes from the start of the
+    ///     buffer to the data for the first instance to be drawn.
+    void GraphicsDevice::Bind(const InstanceBuffer& instance_buffer, const uint64_t first_instance_byte_offset)
+    {
+        // MAKE SURE A SHADER PROGRAM IS IN USE TO READ THE INSTANCE DATA.
+        bool shader_program_in_use = (nullptr != CurrentShaderProgram);
+        if (!shader_program_in_use)
+        {
+            return;
+        }
+
+        // ATTACH THE BUFFER TO THE INSTANCE BINDING OF THE SHADER PROGRAM'S VERTEX ARRAY.
+        if (DirectStateAccessSupported())
+        {
+            glVertexArrayVertexBuffer(
+                CurrentShaderProgram->VertexArrayId,
+                INSTANCE_BUFFER_BINDING_INDEX,
+                instance_buffer.BufferId,
+                static_cast<GLintptr>(first_instance_byte_offset),
+                static_cast<GLsizei>(CurrentShaderProgram->VertexShader.InstanceSizeInBytes));
+        }
+        else if (SeparateVertexAttributeFormatsSupported)
+        {
+            glBindVertexBuffer(
+                INSTANCE_BUFFER_BINDING_INDEX,
+                instance_buffer.BufferId,
+                static_cast<GLintptr>(first_instance_byte_offset),
+                static_cast<GLsizei>(CurrentShaderProgram->VertexShader.InstanceSizeInBytes));
+        }
+        else
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, instance_buffer.BufferId);
+            CurrentShaderProgram->SetInstanceInputs(first_instance_byte_offset);
+        }
+    }
+
+    /// Destroys an instance buffer, freeing its memory on the graphics device once the GPU
+    /// has finished any frames in flight.  The instance buffer must not be used after being destroyed.
+    /// @param[in]  instance_buffer - The instance buffer to destroy.
+    void GraphicsDevice::Destroy(const std::shared_ptr<InstanceBuffer>& instance_buffer)
+    {
+        // MAKE SURE THE INSTANCE BUFFER BELONGS TO THIS DEVICE.
+        auto device_instance_buffer = std::find(InstanceBuffers.begin(), InstanceBuffers.end(), instance_buffer);
+        bool instance_buffer_found = (InstanceBuffers.end() != device_instance_buffer);
+        if (!instance_buffer_found)
+        {
+            return;
+        }
+
+        // QUEUE THE INSTANCE BUFFER FOR DELETION.
+        ResourceDeletionQueue.QueueBuffer(instance_buffer->BufferId, CurrentFrameContext().FrameNumber);
+
+        // STOP TRACKING THE INSTANCE BUFFER.
+        InstanceBuffers.erase(device_instance_buffer);
+    }
+
+    /// Creates a buffer for indirect draw commands.
+    /// @return A new indirect draw buffer, if successfully created; null otherwise.
+    std::shared_ptr<IndirectDrawBuffer> GraphicsDevice::CreateIndirectDrawBuffer()
+    {
+        // ALLOCATE THE BUFFER.
+        GLuint buffer_id = CreateBufferObject();
+
+        // CREATE AND STORE THE INDIRECT DRAW BUFFER.
+        std::shared_ptr<IndirectDrawBuffer> indirect_draw_buffer = std::make_shared<IndirectDrawBuffer>(buffer_id);
+        IndirectDrawBuffers.push_back(indirect_draw_buffer);
+        return indirect_draw_buffer;
+    }
+
+    /// Binds an indirect draw buffer as the source of commands for indirect draw calls.
+    /// @param[in]  indirect_draw_buffer - The indirect draw buffer to bind.
+    void GraphicsDevice::Bind(const IndirectDrawBuffer& indirect_draw_buffer)
+    {
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, indirect_draw_buffer.BufferId);
+    }
+
+    /// Destroys an indirect draw buffer, freeing its memory on the graphics device once the GPU
+    /// has finished any frames in flight.  The indirect draw buffer must not be used after being destroyed.
+    /// @param[in]  indirect_draw_buffer - The indirect draw buffer to destroy.
+    void GraphicsDevice::Destroy(const std::shared_ptr<IndirectDrawBuffer>& indirect_draw_buffer)
+    {
+        // MAKE SURE THE INDIRECT DRAW BUFFER BELONGS TO THIS DEVICE.
+        auto device_indirect_draw_buffer = std::find(IndirectDrawBuffers.begin(), IndirectDrawBuffers.end(), indirect_draw_buffer);
+        bool indirect_draw_buffer_found = (IndirectDrawBuffers.end() != device_indirect_draw_buffer);
+        if (!indirect_draw_buffer_found)
+        {
+            return;
+        }
+
+        // QUEUE THE INDIRECT DRAW BUFFER FOR DELETION.
+        ResourceDeletionQueue.QueueBuffer(indirect_draw_buffer->BufferId, CurrentFrameContext().FrameNumber);
+
+        // STOP TRACKING THE INDIRECT DRAW BUFFER.
+        IndirectDrawBuffers.erase(device_indirect_draw_buffer);
+    }
+
+    /// Creates a shader program from the provided description, waiting for compilation to finish.
     /// @param[in]  shader_program_description - A description of the shader program to create.
-    /// @return The shader program based on the description, if successfully created; null otherwise.
+    /// @return The shader program based on the description.  Its status indicates if it was successfully created.
     std::shared_ptr<SHADERS::ShaderProgram> GraphicsDevice::CreateShaderProgram(const SHADERS::ShaderProgramDescription& shader_program_description)
     {
-        // COMPILE THE VERTEX SHADER.
-        GLuint vertex_shader_id = CompileShader(
-            GL_VERTEX_SHADER,
-            shader_program_description.VertexShader.UncompiledCode);
+        // SUBMIT THE SHADER PROGRAM FOR COMPILATION.
+        PendingShaderProgram pending_shader_program = SubmitShaderProgram(shader_program_description);
+
+        // WAIT FOR COMPILATION TO FINISH.
+        FinishShaderProgram(pending_shader_program);
+        return pending_shader_program.ShaderProgram;
+    }
+
+    /// Starts creating a shader program from the provided description without waiting for
+    /// compilation to finish.  If parallel shader compilation is supported, the driver compiles
+    /// on background threads, so many shader programs can be submitted up front and compile
+    /// concurrently.  The shader program may only be used once IsReady() returns true.
+    /// @param[in]  shader_program_description - A description of the shader program to create.
+    /// @return The shader program based on the description, which may still be compiling.
+    std::shared_ptr<SHADERS::ShaderProgram> GraphicsDevice::CreateShaderProgramAsync(const SHADERS::ShaderProgramDescription& shader_program_description)
+    {
+        // SUBMIT THE SHADER PROGRAM FOR COMPILATION.
+        PendingShaderProgram pending_shader_program = SubmitShaderProgram(shader_program_description);
+
+        // TRACK THE SHADER PROGRAM UNTIL IT FINISHES COMPILING.
+        // Shader programs loaded from the binary cache are already finished.
+        bool shader_program_compiling = (SHADERS::ShaderProgramStatus::COMPILING == pending_shader_program.ShaderProgram->Status);
+        if (shader_program_compiling)
+        {
+            PendingShaderPrograms.push_back(pending_shader_program);
+        }
+        return pending_shader_program.ShaderProgram;
+    }
+
+    /// Determines if a shader program has finished compiling successfully so that it can be used.
+    /// If parallel shader compilation is supported, this never waits for compilation.  Otherwise,
+    /// compilation status can't be checked without waiting, so the first call for a shader
+    /// program waits for it to finish.
+    /// @param[in]  shader_program - The shader program to check.
+    /// @return True if the shader program is ready to use; false if it is still compiling or failed.
+    bool GraphicsDevice::IsReady(const SHADERS::ShaderProgram& shader_program)
+    {
+        // CHECK IF A SHADER PROGRAM THAT WAS STILL COMPILING HAS FINISHED.
+        bool shader_program_compiling = (SHADERS::ShaderProgramStatus::COMPILING == shader_program.Status);
+        if (shader_program_compiling)
+        {
+            auto pending_shader_program = std::find_if(
+                PendingShaderPrograms.begin(),
+                PendingShaderPrograms.end(),
+                [&shader_program](const PendingShaderProgram& current_pending_shader_program)
+                {
+                    return (&shader_program == current_pending_shader_program.ShaderProgram.get());
+                });
+            bool shader_program_pending = (PendingShaderPrograms.end() != pending_shader_program);
+            if (shader_program_pending)
+            {
+                bool compilation_finished = !ShaderProgramCompilationPending(*pending_shader_program->ShaderProgram);
+                if (compilation_finished)
+                {
+                    FinishShaderProgram(*pending_shader_program);
+                    PendingShaderPrograms.erase(pending_shader_program);
+                }
+            }
+        }
+
+        bool shader_program_ready = (SHADERS::ShaderProgramStatus::READY == shader_program.Status);
+        return shader_program_ready;
+    }
+
+    /// Finishes any shader programs created asynchronously that have finished compiling,
+    /// without waiting for any others.  Called automatically at the end of each frame.
+    void GraphicsDevice::UpdatePendingShaderPrograms()
+    {
+        for (auto pending_shader_program = PendingShaderPrograms.begin(); pending_shader_program != PendingShaderPrograms.end();)
+        {
+            bool compilation_pending = ShaderProgramCompilationPending(*pending_shader_program->ShaderProgram);
+            if (compilation_pending)
+            {
+                ++pending_shader_program;
+                continue;
+            }
+
+            FinishShaderProgram(*pending_shader_program);
+            pending_shader_program = PendingShaderPrograms.erase(pending_shader_program);
+        }
+    }
+
+    /// Sets the graphics device to use the provided shader program.
+    /// Any vertex buffers must be bound after calling this method.
+    /// @param[in]  shader_program - The shader program to use.
+    void GraphicsDevice::Use(const SHADERS::ShaderProgram& shader_program)
+    {
+        // SET THE PROGRAM AS THE CURRENT ONE IF IT ISN'T ALREADY.
+        bool shader_program_changed = (&shader_program != CurrentShaderProgram);
+        if (shader_program_changed)
+        {
+            glUseProgram(shader_program.Id);
+            CurrentShaderProgram = &shader_program;
+            ++CurrentFramePipelineStatistics.StateChangeCount;
+
+            // Any applied pipeline state no longer fully describes the current state.
+            CurrentPipelineState = nullptr;
+        }
+
+        // SET THE VERTEX ARRAY HOLDING THE FORMATS OF THE PROGRAM'S INPUTS.
+        // Vertex buffers bound afterward will be read according to these formats.
+        if (SeparateVertexAttributeFormatsSupported)
+        {
+            BindVertexArray(shader_program.VertexArrayId);
+        }
+    }
+
+    /// Sets a compute shader program as the current one for dispatching compute work.
+    /// Any shader program or pipeline state previously in use is forgotten so that
+    /// it gets set again the next time it's used for drawing.
+    /// @param[in]  compute_program_id - The ID of the linked compute shader program to use.
+    void GraphicsDevice::UseComputeProgram(const GLuint compute_program_id)
+    {
+        glUseProgram(compute_program_id);
+        CurrentShaderProgram = nullptr;
+        CurrentPipelineState = nullptr;
+        ++CurrentFramePipelineStatistics.StateChangeCount;
+    }
+
+    /// Creates a pipeline state from the provided description.  Pipeline states are shared,
+    /// so the same pipeline state is returned for identical descriptions.
+    /// @param[in]  description - A description of the pipeline state to create.
+    /// @return The pipeline state for the description.
+    std::shared_ptr<const PipelineState> GraphicsDevice::CreatePipelineState(const PipelineStateDescription& description)
+    {
+        // CHECK FOR AN EXISTING PIPELINE STATE WITH THE SAME DESCRIPTION.
+        // Descriptions are compared in case of hash collisions.
+        uint64_t description_hash = description.Hash();
+        auto hash_entries = PipelineStatesByHash.equal_range(description_hash);
+        for (auto hash_entry = hash_entries.first; hash_entry != hash_entries.second; ++hash_entry)
+        {
+            const std::shared_ptr<const PipelineState>& existing_pipeline_state = hash_entry->second;
+            bool descriptions_identical = (existing_pipeline_state->Description == description);
+            if (descriptions_identical)
+            {
+                return existing_pipeline_state;
+            }
+        }
+
+        // CREATE AND STORE A NEW PIPELINE STATE.
+        std::shared_ptr<const PipelineState> pipeline_state = std::make_shared<const PipelineState>(description);
+        PipelineStatesByHash.emplace(description_hash, pipeline_state);
+        return pipeline_state;
+    }
+
+    /// Applies a pipeline state to the graphics device.  Only state that differs from
+    /// the current state is changed, and nothing is changed if the pipeline state is
+    /// already applied.  Any vertex buffers must be bound after calling this method.
+    /// @param[in]  pipeline_state - The pipeline state to apply.
+    void GraphicsDevice::Apply(const PipelineState& pipeline_state)
+    {
+        // CHECK IF THE PIPELINE STATE IS ALREADY APPLIED.
+        // Since pipeline states are shared for identical descriptions, comparing addresses is sufficient.
+        bool pipeline_state_already_applied = (&pipeline_state == CurrentPipelineState);
+        if (pipeline_state_already_applied)
+        {
+            ++CurrentFramePipelineStatistics.RedundantApplyCount;
+            return;
+        }
+        ++CurrentFramePipelineStatistics.PipelineSwitchCount;
+
+        // SET THE SHADER PROGRAM AND ITS VERTEX LAYOUT.
+        const PipelineStateDescription& description = pipeline_state.Description;
+        bool shader_program_exists = (nullptr != description.ShaderProgram);
+        if (shader_program_exists)
+        {
+            Use(*description.ShaderProgram);
+        }
+
+        // SET ANY DIFFERENT BLENDING STATE.
+        if (description.Blend != CurrentFixedFunctionState.Blend)
+        {
+            SetBlendMode(description.Blend);
+            ++CurrentFramePipelineStatistics.StateChangeCount;
+        }
+
+        // SET ANY DIFFERENT COLOR WRITE STATE.
+        if (description.ColorWriteEnabled != CurrentFixedFunctionState.ColorWriteEnabled)
+        {
+            GLboolean color_write_enabled = description.ColorWriteEnabled ? GL_TRUE : GL_FALSE;
+            glColorMask(color_write_enabled, color_write_enabled, color_write_enabled, color_write_enabled);
+            ++CurrentFramePipelineStatistics.StateChangeCount;
+        }
+
+        // SET ANY DIFFERENT DEPTH STATE.
+        if (description.DepthTestEnabled != CurrentFixedFunctionState.DepthTestEnabled)
+        {
+            if (description.DepthTestEnabled)
+            {
+                glEnable(GL_DEPTH_TEST);
+            }
+            else
+            {
+                glDisable(GL_DEPTH_TEST);
+            }
+            ++CurrentFramePipelineStatistics.StateChangeCount;
+        }
+        if (description.DepthWriteEnabled != CurrentFixedFunctionState.DepthWriteEnabled)
+        {
+            glDepthMask(description.DepthWriteEnabled ? GL_TRUE : GL_FALSE);
+            ++CurrentFramePipelineStatistics.StateChangeCount;
+        }
+        if (description.DepthComparison != CurrentFixedFunctionState.DepthComparison)
+        {
+            glDepthFunc(description.DepthComparison);
+            ++CurrentFramePipelineStatistics.StateChangeCount;
+        }
+
+        // SET ANY DIFFERENT CULLING STATE.
+        if (description.Cull != CurrentFixedFunctionState.Cull)
+        {
+            SetCullMode(description.Cull);
+            ++CurrentFramePipelineStatistics.StateChangeCount;
+        }
+
+        // TRACK THE NEWLY APPLIED STATE.
+        CurrentFixedFunctionState = description;
+        CurrentPipelineState = &pipeline_state;
+    }
+
+    /// Gets the number of unique pipeline states created on the device.
+    /// @return The number of pipeline states.
+    std::size_t GraphicsDevice::PipelineStateCount() const
+    {
+        return PipelineStatesByHash.size();
+    }
+
+    /// Marks the end of a frame, which should be called after swapping buffers.  Any shader programs
+    /// that finished compiling are finished, the frame's commands are fenced, and statistics tracked
+    /// per frame are reset.  If the maximum number of frames are already in flight, this waits
+    /// for the GPU to finish the oldest one before the next frame begins.
+    void GraphicsDevice::EndFrame()
+    {
+        UpdatePendingShaderPrograms();
+
+        // FENCE THE COMMANDS SUBMITTED FOR THE CURRENT FRAME.
+        // The fence gets signaled once the GPU finishes everything submitted before it.
+        FrameContext& finished_frame_context = FrameContexts[CurrentFrameContextIndex];
+        bool previous_fence_exists = (nullptr != finished_frame_context.Fence);
+        if (previous_fence_exists)
+        {
+            glDeleteSync(finished_frame_context.Fence);
+        }
+        const GLbitfield NO_FLAGS = 0;
+        finished_frame_context.Fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, NO_FLAGS);
+
+        // MOVE TO THE NEXT FRAME CONTEXT.
+        CurrentFrameContextIndex = (CurrentFrameContextIndex + 1) % MAX_FRAMES_IN_FLIGHT;
+        FrameContext& next_frame_context = FrameContexts[CurrentFrameContextIndex];
+        next_frame_context.FrameNumber = finished_frame_context.FrameNumber + 1;
+
+        // WAIT FOR THE GPU TO FINISH THE OLDEST FRAME IN FLIGHT.
+        // This is the frame that last used the next context, so the CPU can't get more than
+        // the maximum number of frames ahead, and that frame's resources can be safely reused.
+        auto wait_start_time = std::chrono::high_resolution_clock::now();
+        WaitForFence(next_frame_context.Fence);
+        auto wait_end_time = std::chrono::high_resolution_clock::now();
+        double wait_time_in_seconds = std::chrono::duration_cast<std::chrono::duration<double>>(wait_end_time - wait_start_time).count();
+        const double MILLISECONDS_PER_SECOND = 1000.0;
+        FrameFenceWaitTimeInMilliseconds = wait_time_in_seconds * MILLISECONDS_PER_SECOND;
+        TotalFrameFenceWaitTimeInSeconds += wait_time_in_seconds;
+
+        // DELETE OBJECTS DESTROYED IN FRAMES THE GPU HAS FINISHED.
+        // The frame that last used the next context (and all earlier frames) is now known to be finished.
+        bool oldest_frame_fenced = (next_frame_context.FrameNumber >= MAX_FRAMES_IN_FLIGHT);
+        if (oldest_frame_fenced)
+        {
+            uint64_t completed_frame_number = next_frame_context.FrameNumber - MAX_FRAMES_IN_FLIGHT;
+            ResourceDeletionQueue.DeleteRetired(completed_frame_number);
+        }
+
+        // READ GPU TIMINGS FOR EARLIER FRAMES.
+        // This is done after waiting for the oldest frame so that its results are likely available.
+        bool gpu_timer_exists = (nullptr != GpuTimer);
+        if (gpu_timer_exists)
+        {
+            GpuTimer->EndFrame();
+        }
+
+        // RESET STATISTICS FOR THE NEXT FRAME.
+        PreviousFramePipelineStatistics = CurrentFramePipelineStatistics;
+        CurrentFramePipelineStatistics = PipelineStatistics();
+    }
+
+    /// Gets the context for the frame currently being submitted.  Transient resources
+    /// that are rewritten every frame can be indexed by the context's index to avoid
+    /// overwriting resources the GPU may still be reading for earlier frames.
+    /// @return The context for the current frame.
+    const GraphicsDevice::FrameContext& GraphicsDevice::CurrentFrameContext() const
+    {
+        return FrameContexts[CurrentFrameContextIndex];
+    }
+
+    /// Binds a vertex array if it isn't already bound.
+    /// @param[in]  array_id - The ID of the vertex array to bind.
+    void GraphicsDevice::BindVertexArray(const GLuint array_id)
+    {
+        bool vertex_array_changed = (array_id != CurrentVertexArrayId);
+        if (vertex_array_changed)
+        {
+            glBindVertexArray(array_id);
+            CurrentVertexArrayId = array_id;
+            ++CurrentFramePipelineStatistics.StateChangeCount;
+        }
+    }
+
+    /// Stops tracking a vertex array as bound if it's about to be deleted.  OpenGL unbinds
+    /// deleted vertex arrays, and the ID may be reused for a new vertex array, so the
+    /// next bind must not be skipped.
+    /// @param[in]  array_id - The ID of the vertex array being deleted.
+    void GraphicsDevice::ForgetBoundVertexArray(const GLuint array_id)
+    {
+        bool vertex_array_bound = (array_id == CurrentVertexArrayId);
+        if (vertex_array_bound)
+        {
+            CurrentVertexArrayId = INVALID_ID;
+        }
+    }
+
+    /// Sets how output colors are combined with existing colors.
+    /// @param[in]  blend_mode - The blend mode to set.
+    void GraphicsDevice::SetBlendMode(const BlendMode blend_mode)
+    {
+        switch (blend_mode)
+        {
+            case BlendMode::ALPHA:
+                glEnable(GL_BLEND);
+                glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+                break;
+            case BlendMode::ADDITIVE:
+                glEnable(GL_BLEND);
+                glBlendFunc(GL_SRC_ALPHA, GL_ONE);
+                break;
+            case BlendMode::DISABLED:
+            default:
+                glDisable(GL_BLEND);
+                break;
+        }
+    }
+
+    /// Sets which faces of triangles are culled.
+    /// @param[in]  cull_mode - The cull mode to set.
+    void GraphicsDevice::SetCullMode(const CullMode cull_mode)
+    {
+        switch (cull_mode)
+        {
+            case CullMode::BACK_FACES:
+                glEnable(GL_CULL_FACE);
+                glCullFace(GL_BACK);
+                break;
+            case CullMode::FRONT_FACES:
+                glEnable(GL_CULL_FACE);
+                glCullFace(GL_FRONT);
+                break;
+            case CullMode::DISABLED:
+            default:
+                glDisable(GL_CULL_FACE);
+                break;
+        }
+    }
+
+    /// Creates a buffer object.  If direct state access is supported, the buffer is created
+    /// immediately (rather than on first bind) so that it can be modified without binding it.
+    /// @return The ID of the buffer.
+    GLuint GraphicsDevice::CreateBufferObject()
+    {
+        const GLsizei ONE_BUFFER = 1;
+        GLuint buffer_id = INVALID_ID;
+        if (DirectStateAccessSupported())
+        {
+            glCreateBuffers(ONE_BUFFER, &buffer_id);
+        }
+        else
+        {
+            glGenBuffers(ONE_BUFFER, &buffer_id);
+        }
+        return buffer_id;
+    }
+
+    /// Unmaps a mapped buffer object.
+    /// @param[in]  buffer_id - The ID of the buffer to unmap.
+    void GraphicsDevice::UnmapBufferObject(const GLuint buffer_id)
+    {
+        if (DirectStateAccessSupported())
+        {
+            glUnmapNamedBuffer(buffer_id);
+        }
+        else
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, buffer_id);
+            glUnmapBuffer(GL_ARRAY_BUFFER);
+        }
+    }
+
+    /// Binds a buffer of vertices as input to the shader program in use.
+    /// @param[in]  array_id - The ID of the buffer's own vertex array, if separate
+    ///     vertex attribute formats aren't supported.
+    /// @param[in]  buffer_id - The ID of the buffer.
+    void GraphicsDevice::BindVertexBuffer(const GLuint array_id, const GLuint buffer_id)
+    {
+        // MAKE SURE A SHADER PROGRAM IS IN USE TO READ THE VERTICES.
+        bool shader_program_in_use = (nullptr != CurrentShaderProgram);
+        if (!shader_program_in_use)
+        {
+            return;
+        }
+
+        // ATTACH THE BUFFER TO THE VERTEX BINDING OF THE SHADER PROGRAM'S VERTEX ARRAY.
+        const GLintptr START_OF_BUFFER = 0;
+        if (DirectStateAccessSupported())
+        {
+            glVertexArrayVertexBuffer(
+                CurrentShaderProgram->VertexArrayId,
+                VERTEX_BUFFER_BINDING_INDEX,
+                buffer_id,
+                START_OF_BUFFER,
+                static_cast<GLsizei>(CurrentShaderProgram->VertexShader.VertexSizeInBytes));
+        }
+        else if (SeparateVertexAttributeFormatsSupported)
+        {
+            glBindVertexBuffer(
+                VERTEX_BUFFER_BINDING_INDEX,
+                buffer_id,
+                START_OF_BUFFER,
+                static_cast<GLsizei>(CurrentShaderProgram->VertexShader.VertexSizeInBytes));
+        }
+        else
+        {
+            // Vertex inputs must be set relative to the bound array buffer each time
+            // since the buffer's vertex array may have last been used with a different program.
+            BindVertexArray(array_id);
+            glBindBuffer(GL_ARRAY_BUFFER, buffer_id);
+            CurrentShaderProgram->SetVertexInputs();
+        }
+    }
+
+    /// Gets a vertex array holding the formats of a shader program's vertex inputs, creating
+    /// it if needed.  Vertex arrays are shared by all shader programs whose inputs have the
+    /// same formats.  Requires separate vertex attribute formats to be supported.
+    /// @param[in]  shader_program - The shader program whose vertex inputs should be held.
+    /// @return The ID of the vertex array.
+    GLuint GraphicsDevice::GetInputFormatVertexArray(const SHADERS::ShaderProgram& shader_program)
+    {
+        // CHECK FOR AN EXISTING VERTEX ARRAY WITH THE SAME INPUT FORMATS.
+        const SHADERS::VertexShader& vertex_shader = shader_program.VertexShader;
+        for (const auto& input_format_vertex_array : InputFormatVertexArrays)
+        {
+            bool input_formats_match = (
+                InputFormatsMatch(input_format_vertex_array.InputVariables, vertex_shader.InputVariables) &&
+                InputFormatsMatch(input_format_vertex_array.InstanceInputVariables, vertex_shader.InstanceInputVariables));
+            if (input_formats_match)
+            {
+                return input_format_vertex_array.ArrayId;
+            }
+        }
+
+        // CREATE A NEW VERTEX ARRAY.
+        // Without direct state access, the vertex array must be bound to be modified.
+        const GLsizei ONE_VERTEX_ARRAY = 1;
+        GLuint array_id = INVALID_ID;
+        bool direct_state_access_supported = DirectStateAccessSupported();
+        if (direct_state_access_supported)
+        {
+            glCreateVertexArrays(ONE_VERTEX_ARRAY, &array_id);
+        }
+        else
+        {
+            glGenVertexArrays(ONE_VERTEX_ARRAY, &array_id);
+            glBindVertexArray(array_id);
+        }
+
+        // RECORD THE FORMATS OF PER-VERTEX INPUTS.
+        for (std::size_t input_variable_index = 0; input_variable_index < vertex_shader.InputVariables.size(); ++input_variable_index)
+        {
+            SetInputFormat(
+                array_id,
+                static_cast<GLuint>(input_variable_index),
+                vertex_shader.InputVariables[input_variable_index],
+                VERTEX_BUFFER_BINDING_INDEX);
+        }
+
+        // RECORD THE FORMATS OF PER-INSTANCE INPUTS.
+        for (std::size_t instance_input_variable_index = 0; instance_input_variable_index < vertex_shader.InstanceInputVariables.size(); ++instance_input_variable_index)
+        {
+            SetInputFormat(
+                array_id,
+                shader_program.InstanceInputLocation(instance_input_variable_index),
+                vertex_shader.InstanceInputVariables[instance_input_variable_index],
+                INSTANCE_BUFFER_BINDING_INDEX);
+        }
+
+        // ADVANCE PER-INSTANCE INPUTS ONCE PER INSTANCE RATHER THAN ONCE PER VERTEX.
+        const GLuint ADVANCE_ONCE_PER_INSTANCE = 1;
+        if (direct_state_access_supported)
+        {
+            glVertexArrayBindingDivisor(array_id, INSTANCE_BUFFER_BINDING_INDEX, ADVANCE_ONCE_PER_INSTANCE);
+        }
+        else
+        {
+            glVertexBindingDivisor(INSTANCE_BUFFER_BINDING_INDEX, ADVANCE_ONCE_PER_INSTANCE);
+
+            // RESTORE THE PREVIOUSLY BOUND VERTEX ARRAY.
+            glBindVertexArray(CurrentVertexArrayId);
+        }
+
+        // STORE THE VERTEX ARRAY FOR REUSE.
+        InputFormatVertexArray input_format_vertex_array;
+        input_format_vertex_array.InputVariables = vertex_shader.InputVariables;
+        input_format_vertex_array.InstanceInputVariables = vertex_shader.InstanceInputVariables;
+        input_format_vertex_array.ArrayId = array_id;
+        InputFormatVertexArrays.push_back(input_format_vertex_array);
+        return array_id;
+    }
+
+    /// Records the format of a vertex shader input in a vertex array.  Without direct state
+    /// access, the vertex array must already be bound.
+    /// @param[in]  array_id - The ID of the vertex array in which to record the format.
+    /// @param[in]  input_variable_location - The location of the input variable in shader programs.
+    /// @param[in]  input_variable - The input variable whose format to record.
+    /// @param[in]  binding_index - The vertex buffer binding point from which the input is read.
+    void GraphicsDevice::SetInputFormat(
+        const GLuint array_id,
+        const GLuint input_variable_location,
+        const SHADERS::VertexShaderInputVariable& input_variable,
+        const GLuint binding_index)
+    {
+        GLuint relative_byte_offset = static_cast<GLuint>(input_variable.ByteOffsetToFirstComponent);
+        if (DirectStateAccessSupported())
+        {
+            glEnableVertexArrayAttrib(array_id, input_variable_location);
+            glVertexArrayAttribFormat(
+                array_id,
+                input_variable_location,
+                input_variable.ComponentCount,
+                input_variable.ComponentType,
+                input_variable.Normalized,
+                relative_byte_offset);
+            glVertexArrayAttribBinding(array_id, input_variable_location, binding_index);
+        }
+        else
+        {
+            glEnableVertexAttribArray(input_variable_location);
+            glVertexAttribFormat(
+                input_variable_location,
+                input_variable.ComponentCount,
+                input_variable.ComponentType,
+                input_variable.Normalized,
+                relative_byte_offset);
+            glVertexAttribBinding(input_variable_location, binding_index);
+        }
+    }
+
+    /// Waits for the GPU to finish all commands guarded by a fence, then deletes the fence.
+    /// @param[in,out]  fence - The fence to wait for.  Nothing is done if null.  Set to null after waiting.
+    void GraphicsDevice::WaitForFence(GLsync& fence)
+    {
+        // CHECK IF THERE IS A FENCE TO WAIT FOR.
+        bool fence_exists = (nullptr != fence);
+        if (!fence_exists)
+        {
+            return;
+        }
+
+        // WAIT FOR THE FENCE TO BE SIGNALED.
+        // Commands are flushed on the first wait to guarantee that the fence eventually gets signaled.
+        // Waiting is done in a loop with a timeout to avoid potentially blocking forever in the driver.
+        const GLuint64 ONE_SECOND_IN_NANOSECONDS = 1000000000;
+        GLenum wait_result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, ONE_SECOND_IN_NANOSECONDS);
+        while (GL_TIMEOUT_EXPIRED == wait_result)
+        {
+            const GLbitfield NO_FLAGS = 0;
+            wait_result = glClientWaitSync(fence, NO_FLAGS, ONE_SECOND_IN_NANOSECONDS);
+        }
+
+        // DELETE THE FENCE SINCE IT IS NO LONGER NEEDED.
+        glDeleteSync(fence);
+        fence = nullptr;
+    }
+
+    /// Determines if two sets of vertex shader inputs have the same formats and would therefore
+    /// be read identically from buffers.  Names are ignored since inputs are located by index.
+    /// @param[in]  lhs - The first set of inputs to compare.
+    /// @param[in]  rhs - The second set of inputs to compare.
+    /// @return True if the inputs have the same formats; false otherwise.
+    bool GraphicsDevice::InputFormatsMatch(
+        const std::vector<SHADERS::VertexShaderInputVariable>& lhs,
+        const std::vector<SHADERS::VertexShaderInputVariable>& rhs)
+    {
+        bool input_counts_match = (lhs.size() == rhs.size());
+        if (!input_counts_match)
+        {
+            return false;
+        }
+
+        for (std::size_t input_variable_index = 0; input_variable_index < lhs.size(); ++input_variable_index)
+        {
+            const SHADERS::VertexShaderInputVariable& lhs_input_variable = lhs[input_variable_index];
+            const SHADERS::VertexShaderInputVariable& rhs_input_variable = rhs[input_variable_index];
+            bool input_formats_match = (
+                (lhs_input_variable.ComponentCount == rhs_input_variable.ComponentCount) &&
+                (lhs_input_variable.ComponentType == rhs_input_variable.ComponentType) &&
+                (lhs_input_variable.Normalized == rhs_input_variable.Normalized) &&
+                (lhs_input_variable.ByteOffsetToFirstComponent == rhs_input_variable.ByteOffsetToFirstComponent));
+            if (!input_formats_match)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /// Submits a shader program for compilation and linking without waiting for either to finish.
+    /// The shader program is loaded from the binary cache instead if possible.
+    /// @param[in]  shader_program_description - A description of the shader program to create.
+    /// @return The submitted shader program, which is only ready if it was loaded from the binary cache.
+    GraphicsDevice::PendingShaderProgram GraphicsDevice::SubmitShaderProgram(const SHADERS::ShaderProgramDescription& shader_program_description)
+    {
+        // TRY LOADING THE LINKED SHADER PROGRAM FROM THE BINARY CACHE.
+        PendingShaderProgram pending_shader_program;
+        pending_shader_program.CompileStartTime = std::chrono::high_resolution_clock::now();
+        GLuint shader_program_id = glCreateProgram();
+        bool binary_cache_enabled = (nullptr != ShaderProgramBinaryCache);
+        bool shader_program_loaded_from_cache = false;
+        if (binary_cache_enabled)
+        {
+            pending_shader_program.BinaryCacheKey = ShaderProgramBinaryCache->Key(shader_program_description);
+            shader_program_loaded_from_cache = ShaderProgramBinaryCache->Load(shader_program_id, pending_shader_program.BinaryCacheKey);
+        }
+
+        // START COMPILING THE VERTEX SHADER IF NEEDED.
+        GLuint vertex_shader_id = INVALID_ID;
+        if (!shader_program_loaded_from_cache)
+        {
+            vertex_shader_id = CompileShader(
+                GL_VERTEX_SHADER,
+                shader_program_description.VertexShader.UncompiledCode);
+        }
         SHADERS::VertexShader vertex_shader(
             vertex_shader_id,
             shader_program_description.VertexShader.VertexSizeInBytes,
-            shader_program_description.VertexShader.InputVariables);
+            shader_program_description.VertexShader.InputVariables,
+            shader_program_description.VertexShader.InstanceSizeInBytes,
+            shader_program_description.VertexShader.InstanceInputVariables);
 
-        // COMPILE THE FRAGMENT SHADER.
-        GLuint fragment_shader_id = CompileShader(
-            GL_FRAGMENT_SHADER,
-            shader_program_description.FragmentShader.UncompiledCode);
+        // START COMPILING THE FRAGMENT SHADER IF NEEDED.
+        GLuint fragment_shader_id = INVALID_ID;
+        if (!shader_program_loaded_from_cache)
+        {
+            fragment_shader_id = CompileShader(
+                GL_FRAGMENT_SHADER,
+                shader_program_description.FragmentShader.UncompiledCode);
+        }
         SHADERS::FragmentShader fragment_shader(fragment_shader_id, shader_program_description.FragmentShader.OutputColorVariableName);
 
-        // ATTACH THE SHADERS TO A SHADER PROGRAM.
-        GLuint shader_program_id = glCreateProgram();
-        std::shared_ptr<SHADERS::ShaderProgram> shader_program = std::make_shared<SHADERS::ShaderProgram>(
+        // ATTACH THE SHADERS TO THE SHADER PROGRAM.
+        pending_shader_program.ShaderProgram = std::make_shared<SHADERS::ShaderProgram>(
             shader_program_id, 
             vertex_shader, 
             fragment_shader);
+        SHADERS::ShaderProgram& shader_program = *pending_shader_program.ShaderProgram;
 
-        // SET THE FRAGMENT SHADER'S OUTPUT COLOR VARIABLE.
-        shader_program->SetFragmentShaderOutputColorVariable();
+        // START LINKING THE SHADER PROGRAM IF IT WASN'T LOADED FROM THE CACHE.
+        // Input and output locations are already part of cached binaries.
+        if (shader_program_loaded_from_cache)
+        {
+            shader_program.Status = SHADERS::ShaderProgramStatus::READY;
+        }
+        else
+        {
+            // SET THE FRAGMENT SHADER'S OUTPUT COLOR VARIABLE AND THE VERTEX SHADER'S INPUT LOCATIONS.
+            shader_program.SetFragmentShaderOutputColorVariable();
+            shader_program.SetVertexInputLocations();
+
+            // LINK THE SHADER PROGRAM.
+            // Linking waits for the shaders to compile, so errors are only checked once linking finishes.
+            if (binary_cache_enabled)
+            {
+                glProgramParameteri(shader_program.Id, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+            }
+            glLinkProgram(shader_program.Id);
+        }
 
-        // LINK THE SHADER PROGRAM.
-        glLinkProgram(shader_program->Id);
+        // RECORD THE FORMATS OF THE VERTEX SHADER'S INPUTS ONCE.
+        // This only depends on the description, so it doesn't need to wait for linking.
+        if (SeparateVertexAttributeFormatsSupported)
+        {
+            shader_program.VertexArrayId = GetInputFormatVertexArray(shader_program);
+        }
 
-        // STORE AND RETURN THE SHADER PROGRAM.
-        ShaderPrograms.push_back(shader_program);
-        return shader_program;
+        // STORE THE SHADER PROGRAM.
+        ShaderPrograms.push_back(pending_shader_program.ShaderProgram);
+        return pending_shader_program;
     }
 
-    /// Sets the graphics device to use the provided shader program.
-    /// @param[in]  shader_program - The shader program to use.
-    void GraphicsDevice::Use(const SHADERS::ShaderProgram& shader_program)
+    /// Determines if a shader program is still compiling or linking, without waiting.
+    /// @param[in]  shader_program - The shader program to check.
+    /// @return True if the shader program is known to still be compiling; false if it is finished
+    ///     or if that can't be determined without waiting (when parallel compilation isn't supported).
+    bool GraphicsDevice::ShaderProgramCompilationPending(const SHADERS::ShaderProgram& shader_program) const
     {
-        // SET THE INPUT VARIABLES FOR THE PROGRAM.
-        shader_program.SetVertexInputs();
-        
-        // SET THE PROGRAM AS THE CURRENT ONE.
-        glUseProgram(shader_program.Id);
+        if (!ParallelShaderCompileSupported)
+        {
+            return false;
+        }
+
+        GLint completion_status = GL_FALSE;
+        glGetProgramiv(shader_program.Id, GL_COMPLETION_STATUS_ARB, &completion_status);
+        bool compilation_pending = (GL_FALSE == completion_status);
+        return compilation_pending;
     }
 
-    /// Attempts to compile a shader.
+    /// Finishes creating a submitted shader program by checking if it linked successfully,
+    /// waiting for compilation and linking if they aren't yet finished.
+    /// @param[in,out]  pending_shader_program - The shader program to finish.  Its status is updated.
+    void GraphicsDevice::FinishShaderProgram(PendingShaderProgram& pending_shader_program)
+    {
+        // MAKE SURE THE SHADER PROGRAM ISN'T ALREADY FINISHED.
+        SHADERS::ShaderProgram& shader_program = *pending_shader_program.ShaderProgram;
+        bool shader_program_compiling = (SHADERS::ShaderProgramStatus::COMPILING == shader_program.Status);
+        if (!shader_program_compiling)
+        {
+            return;
+        }
+
+        // CHECK IF LINKING SUCCEEDED.
+        GLint link_status = GL_FALSE;
+        glGetProgramiv(shader_program.Id, GL_LINK_STATUS, &link_status);
+
+        // RECORD HOW LONG COMPILING AND LINKING TOOK.
+        // Checking the link status waits for linking to finish, so the full time is measured.
+        // For shader programs created asynchronously, the time extends to when completion
+        // was noticed, so it may be slightly longer than the actual time.
+        auto compile_end_time = std::chrono::high_resolution_clock::now();
+        shader_program.CompileTimeInSeconds = std::chrono::duration_cast<std::chrono::duration<double>>(
+            compile_end_time - pending_shader_program.CompileStartTime).count();
+
+        bool shader_program_linked = (GL_TRUE == link_status);
+        if (!shader_program_linked)
+        {
+            LogShaderProgramErrors(shader_program);
+            shader_program.Status = SHADERS::ShaderProgramStatus::FAILED;
+            return;
+        }
+        shader_program.Status = SHADERS::ShaderProgramStatus::READY;
+
+        // STORE THE LINKED SHADER PROGRAM IN THE BINARY CACHE.
+        bool binary_cache_enabled = (nullptr != ShaderProgramBinaryCache);
+        if (binary_cache_enabled)
+        {
+            ShaderProgramBinaryCache->Store(shader_program.Id, pending_shader_program.BinaryCacheKey, shader_program.CompileTimeInSeconds);
+        }
+    }
+
+    /// Starts compiling a shader without waiting for compilation to finish.
+    /// Any compilation errors are logged if the shader program using it fails to link.
     /// @param[in]  shader_type - The type of shader being compiled.
     /// @param[in]  source_code - The shader source code to compile.
-    /// @return The shader ID, if successfully compiled; INVALID_ID otherwise.
+    /// @return The shader ID, if the shader was created; INVALID_ID otherwise.
     GLuint GraphicsDevice::CompileShader(const GLenum shader_type, const std::string& source_code)
     {
         // CREATE THE SHADER.
@@ -187,34 +1311,58 @@ namespace OPEN_GL
             &source_code_text,
             SOURCE_CODE_IS_NULL_TERMINATED);
 
-        // COMPILE THE SHADER.
+        // START COMPILING THE SHADER.
         glCompileShader(shader);
+        return shader;
+    }
 
-        // CHECK IF COMPILATION SUCCEEDED.
-        GLint shader_compile_status;
-        glGetShaderiv(shader, GL_COMPILE_STATUS, &shader_compile_status);
-        bool shader_compiled = (GL_TRUE == shader_compile_status);
-        if (shader_compiled)
-        {
-            return shader;
-        }
-        else
+    /// Logs any errors from compiling the shaders in a shader program or from linking it.
+    /// @param[in]  shader_program - The shader program that failed to link.
+    void GraphicsDevice::LogShaderProgramErrors(const SHADERS::ShaderProgram& shader_program) const
+    {
+        GLsizei* const LENGTH_OF_LOG_NOT_NEEDED = nullptr;
+
+        // LOG ANY SHADER COMPILER ERRORS.
+        const GLuint SHADER_IDS[] = { shader_program.VertexShader.Id, shader_program.FragmentShader.Id };
+        for (const GLuint shader_id : SHADER_IDS)
         {
+            // SKIP SHADERS THAT WERE NEVER CREATED OR COMPILED SUCCESSFULLY.
+            bool shader_exists = (INVALID_ID != shader_id);
+            if (!shader_exists)
+            {
+                continue;
+            }
+
+            GLint shader_compile_status = GL_FALSE;
+            glGetShaderiv(shader_id, GL_COMPILE_STATUS, &shader_compile_status);
+            bool shader_compiled = (GL_TRUE == shader_compile_status);
+            if (shader_compiled)
+            {
+                continue;
+            }
+
             // GET THE SHADER COMPILER ERROR.
-            const GLsizei LEGNTH_OF_LOG_NOT_NEEDED = NULL;
             char shader_compile_log_buffer[512];
             glGetShaderInfoLog(
-                shader,
+                shader_id,
                 sizeof(shader_compile_log_buffer) / sizeof(shader_compile_log_buffer[0]),
-                LEGNTH_OF_LOG_NOT_NEEDED,
+                LENGTH_OF_LOG_NOT_NEEDED,
                 shader_compile_log_buffer);
             /// @todo   Log via a better mechanism.
             OutputDebugString("Shader compile error: ");
             OutputDebugString(shader_compile_log_buffer);
-
-            // INDICATE THAT THE SHADER COULD NOT BE CREATED.
-            return INVALID_ID;
         }
+
+        // LOG THE SHADER PROGRAM LINKER ERROR.
+        char shader_program_link_log_buffer[512];
+        glGetProgramInfoLog(
+            shader_program.Id,
+            sizeof(shader_program_link_log_buffer) / sizeof(shader_program_link_log_buffer[0]),
+            LENGTH_OF_LOG_NOT_NEEDED,
+            shader_program_link_log_buffer);
+        /// @todo   Log via a better mechanism.
+        OutputDebugString("Shader program link error: ");
+        OutputDebugString(shader_program_link_log_buffer);
     }
 }
 }
@@ -1,12 +1,25 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 #include <gl/GL.h>
 #include <Windows.h>
+#include "Graphics/OpenGL/DebugMessageLog.h"
+#include "Graphics/OpenGL/GpuTimer.h"
+#include "Graphics/OpenGL/IndirectDrawBuffer.h"
+#include "Graphics/OpenGL/InstanceBuffer.h"
 #include "Graphics/OpenGL/OpenGL.h"
+#include "Graphics/OpenGL/PipelineState.h"
+#include "Graphics/OpenGL/ResourceDeletionQueue.h"
 #include "Graphics/OpenGL/Shaders/ShaderProgram.h"
+#include "Graphics/OpenGL/Shaders/ShaderProgramBinaryCache.h"
 #include "Graphics/OpenGL/Shaders/ShaderProgramDescription.h"
+#include "Graphics/OpenGL/StreamingVertexBuffer.h"
 #include "Graphics/OpenGL/VertexBuffer.h"
 
 namespace GRAPHICS
@@ -14,38 +27,207 @@ namespace GRAPHICS
 namespace OPEN_GL
 {
     /// Represents a device for rendering graphics using OpenGL.
-    /// @note   Currently only supports up to OpenGL 4.2.0.
+    /// @note   Requires OpenGL 3.2 (for GLSL 1.50 shaders and fence sync objects).  Features from
+    ///     later versions up to OpenGL 4.6 (such as direct state access, immutable buffer storage,
+    ///     compute shaders, and indirect drawing) are used when supported, with fallbacks otherwise.
     class GraphicsDevice
     {
     public:
+        // CONSTANTS.
+        /// The maximum number of frames the CPU may submit before the GPU finishes them.
+        /// Allowing 2 frames lets the CPU prepare one frame while the GPU renders the previous
+        /// one, while bounding latency and how long transient per-frame resources stay in use.
+        static const unsigned int MAX_FRAMES_IN_FLIGHT = 2;
+
+        // PUBLIC TYPES.
+        /// The state for one of the frames that may be in flight at once.  Frame contexts are
+        /// reused in a ring, and a context is only reused once the GPU has finished the frame
+        /// that last used it, so resources indexed by the context are safe to overwrite.
+        struct FrameContext
+        {
+            /// The index of the context, for selecting transient per-frame resources.
+            unsigned int Index = 0;
+            /// The number of the frame currently using the context (starting from 0).
+            uint64_t FrameNumber = 0;
+            /// The fence signaled once the GPU finishes the commands of the frame that last
+            /// used the context.  Null if the GPU isn't known to be using the context.
+            GLsync Fence = nullptr;
+        };
+
+        /// Counts of changes to pipeline state, for checking how well drawing is ordered to avoid changes.
+        struct PipelineStatistics
+        {
+            /// The number of times a different pipeline state was applied.
+            unsigned int PipelineSwitchCount = 0;
+            /// The number of individual pieces of state (shader program, vertex array, blending,
+            /// depth testing, or culling) that actually had to be changed.
+            unsigned int StateChangeCount = 0;
+            /// The number of times the pipeline state already in use was applied again, requiring no changes.
+            unsigned int RedundantApplyCount = 0;
+        };
+
         // CONSTRUCTION.
-        static std::shared_ptr<GraphicsDevice> Create(const HDC device_context);
+        static std::shared_ptr<GraphicsDevice> Create(const HDC device_context, const bool debug_output_enabled);
         explicit GraphicsDevice(const HDC device_context, const HGLRC open_gl_render_context);
         ~GraphicsDevice();
 
         // VERTEX BUFFER METHODS.
         std::shared_ptr<VertexBuffer> CreateVertexBuffer();
         void Bind(const VertexBuffer& vertex_buffer);
+        void Destroy(const std::shared_ptr<VertexBuffer>& vertex_buffer);
+        std::shared_ptr<StreamingVertexBuffer> CreateStreamingVertexBuffer(const unsigned int max_vertex_count_per_region);
+        void Bind(const StreamingVertexBuffer& vertex_buffer);
+        void Destroy(const std::shared_ptr<StreamingVertexBuffer>& vertex_buffer);
+        std::shared_ptr<InstanceBuffer> CreateInstanceBuffer();
+        void Bind(const InstanceBuffer& instance_buffer, const uint64_t first_instance_byte_offset = 0);
+        void Destroy(const std::shared_ptr<InstanceBuffer>& instance_buffer);
+        std::shared_ptr<IndirectDrawBuffer> CreateIndirectDrawBuffer();
+        void Bind(const IndirectDrawBuffer& indirect_draw_buffer);
+        void Destroy(const std::shared_ptr<IndirectDrawBuffer>& indirect_draw_buffer);
 
         // SHADER METHODS.
         std::shared_ptr<SHADERS::ShaderProgram> CreateShaderProgram(const SHADERS::ShaderProgramDescription& shader_program_description);
+        std::shared_ptr<SHADERS::ShaderProgram> CreateShaderProgramAsync(const SHADERS::ShaderProgramDescription& shader_program_description);
+        bool IsReady(const SHADERS::ShaderProgram& shader_program);
+        void UpdatePendingShaderPrograms();
         void Use(const SHADERS::ShaderProgram& shader_program);
+        void UseComputeProgram(const GLuint compute_program_id);
+
+        // PIPELINE STATE METHODS.
+        std::shared_ptr<const PipelineState> CreatePipelineState(const PipelineStateDescription& description);
+        void Apply(const PipelineState& pipeline_state);
+        std::size_t PipelineStateCount() const;
+
+        // FRAME METHODS.
+        const FrameContext& CurrentFrameContext() const;
+        void EndFrame();
 
         // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
         /// The regular Windows device context.
         HDC DeviceContext;
+        /// Pipeline state changes made so far in the current frame.
+        PipelineStatistics CurrentFramePipelineStatistics;
+        /// Pipeline state changes made in the previous (completed) frame.
+        PipelineStatistics PreviousFramePipelineStatistics;
+        /// The cache of linked shader program binaries used when creating shader programs.
+        /// Null (the default) if shader programs should always be compiled from source.
+        std::unique_ptr<SHADERS::ShaderProgramBinaryCache> ShaderProgramBinaryCache;
+        /// The log of debug messages reported by the driver.
+        /// Null if debug output wasn't enabled or isn't supported.
+        std::unique_ptr<OPEN_GL::DebugMessageLog> DebugMessageLog;
+        /// The time the CPU spent waiting at the start of the current frame for the GPU
+        /// to finish the oldest frame in flight, in milliseconds.
+        double FrameFenceWaitTimeInMilliseconds;
+        /// The total time the CPU has spent waiting for frames in flight, in seconds.
+        double TotalFrameFenceWaitTimeInSeconds;
+        /// Objects destroyed at run time that are waiting for the GPU to finish frames that may use them.
+        OPEN_GL::ResourceDeletionQueue ResourceDeletionQueue;
+        /// The timer for measuring how long the GPU spends on passes within each frame.
+        /// Null if timer queries aren't supported.
+        std::unique_ptr<OPEN_GL::GpuTimer> GpuTimer;
 
     private:
-        // SHADER METHODS.
+        // CONSTANTS.
+        /// The vertex buffer binding point from which per-vertex inputs are read.
+        static const GLuint VERTEX_BUFFER_BINDING_INDEX = 0;
+        /// The vertex buffer binding point from which per-instance inputs are read.
+        static const GLuint INSTANCE_BUFFER_BINDING_INDEX = 1;
+
+        // PRIVATE TYPES.
+        /// A vertex array holding the formats of a set of vertex shader inputs.
+        /// Buffers are attached when bound, so the same vertex array can be used
+        /// for any buffers holding data in the same formats.
+        struct InputFormatVertexArray
+        {
+            /// The per-vertex inputs whose formats are held in the vertex array.
+            std::vector<SHADERS::VertexShaderInputVariable> InputVariables;
+            /// The per-instance inputs whose formats are held in the vertex array.
+            std::vector<SHADERS::VertexShaderInputVariable> InstanceInputVariables;
+            /// The ID of the vertex array.
+            GLuint ArrayId;
+        };
+
+        /// A shader program that has been submitted for compilation but may not be finished.
+        struct PendingShaderProgram
+        {
+            /// The shader program.
+            std::shared_ptr<SHADERS::ShaderProgram> ShaderProgram = nullptr;
+            /// The key of the shader program in the binary cache, if the cache is enabled.
+            SHADERS::ShaderProgramBinaryCache::ProgramKey BinaryCacheKey = {};
+            /// When compilation of the shader program started.
+            std::chrono::high_resolution_clock::time_point CompileStartTime = {};
+        };
+
+        // HELPER METHODS.
+        void BindVertexArray(const GLuint array_id);
+        void ForgetBoundVertexArray(const GLuint array_id);
+        void SetBlendMode(const BlendMode blend_mode);
+        void SetCullMode(const CullMode cull_mode);
+        GLuint CreateBufferObject();
+        void UnmapBufferObject(const GLuint buffer_id);
+        void BindVertexBuffer(const GLuint array_id, const GLuint buffer_id);
+        PendingShaderProgram SubmitShaderProgram(const SHADERS::ShaderProgramDescription& shader_program_description);
+        bool ShaderProgramCompilationPending(const SHADERS::ShaderProgram& shader_program) const;
+        void FinishShaderProgram(PendingShaderProgram& pending_shader_program);
         GLuint CompileShader(const GLenum shader_type, const std::string& source_code);
+        void LogShaderProgramErrors(const SHADERS::ShaderProgram& shader_program) const;
+        GLuint GetInputFormatVertexArray(const SHADERS::ShaderProgram& shader_program);
+        void SetInputFormat(
+            const GLuint array_id,
+            const GLuint input_variable_location,
+            const SHADERS::VertexShaderInputVariable& input_variable,
+            const GLuint binding_index);
+        static void WaitForFence(GLsync& fence);
+        static bool InputFormatsMatch(
+            const std::vector<SHADERS::VertexShaderInputVariable>& lhs,
+            const std::vector<SHADERS::VertexShaderInputVariable>& rhs);
 
         // MEMBER VARIABLES.
         /// The OpenGL rendering context.
         HGLRC OpenGLRenderContext;
+        /// True if the driver can compile shaders on background threads and report when
+        /// they're finished without waiting (KHR/ARB_parallel_shader_compile); false otherwise.
+        bool ParallelShaderCompileSupported;
+        /// True if vertex attribute formats can be specified separately from buffers
+        /// (OpenGL 4.3 or ARB_vertex_attrib_binding); false otherwise.
+        bool SeparateVertexAttributeFormatsSupported;
+        /// The shader program currently in use.  Null if none has been used yet.
+        const SHADERS::ShaderProgram* CurrentShaderProgram;
+        /// The contexts for all frames that may be in flight, used in a ring.
+        std::array<FrameContext, MAX_FRAMES_IN_FLIGHT> FrameContexts;
+        /// The index of the context for the frame currently being submitted.
+        unsigned int CurrentFrameContextIndex;
+        /// The ID of the vertex array currently bound.
+        GLuint CurrentVertexArrayId;
+        /// The pipeline state currently applied.  Null if none is applied or if the shader
+        /// program has been changed directly since the pipeline state was applied.
+        const PipelineState* CurrentPipelineState;
+        /// The state currently set for blending, depth testing, and culling.
+        /// Only these parts of the description are kept up-to-date.
+        PipelineStateDescription CurrentFixedFunctionState;
+        /// All pipeline states created on the device, keyed by the hashes of their descriptions.
+        /// Multiple pipeline states may share a hash in the unlikely case of hash collisions.
+        std::unordered_multimap< uint64_t, std::shared_ptr<const PipelineState> > PipelineStatesByHash;
+        /// All vertex arrays for vertex shader input formats, if separate formats are supported.
+        std::vector<InputFormatVertexArray> InputFormatVertexArrays;
         /// All vertex buffers allocated on the device.
         std::vector< std::shared_ptr<VertexBuffer> > VertexBuffers;
+        /// All streaming vertex buffers allocated on the device.
+        std::vector< std::shared_ptr<StreamingVertexBuffer> > StreamingVertexBuffers;
+        /// All instance buffers allocated on the device.
+        std::vector< std::shared_ptr<InstanceBuffer> > InstanceBuffers;
+        /// All indirect draw buffers allocated on the device.
+        std::vector< std::shared_ptr<IndirectDrawBuffer> > IndirectDrawBuffers;
         /// All shader programs allocated on the device.
         std::vector< std::shared_ptr<SHADERS::ShaderProgram> > ShaderPrograms;
+        /// Shader programs created asynchronously that haven't yet been checked as finished.
+        std::vector<PendingShaderProgram> PendingShaderPrograms;
     };
+
+    // Streaming buffers only allow one region to be written per frame, so having more regions
+    // than frames in flight guarantees that the region being reused has already been finished.
+    static_assert(
+        StreamingVertexBuffer::REGION_COUNT > GraphicsDevice::MAX_FRAMES_IN_FLIGHT,
+        "Streaming vertex buffers need more regions than frames in flight to avoid waiting on regions.");
 }
 }
@@ -0,0 +1,32 @@
+#include "Graphics/OpenGL/IndirectDrawBuffer.h"
+
+namespace GRAPHICS
+{
+namespace OPEN_GL
+{
+    /// Constructor.
+    /// @param[in]  buffer_id - The ID of the indirect draw buffer.
+    IndirectDrawBuffer::IndirectDrawBuffer(const GLuint buffer_id) :
+        BufferId(buffer_id)
+    {}
+
+    /// Fills this buffer with the provided draw commands.  The buffer must be bound
+    /// via the graphics device for the commands to be drawn.
+    /// @param[in]  draw_commands - The draw commands to place in the buffer.
+    void IndirectDrawBuffer::Fill(const std::vector<DrawArraysIndirectCommand>& draw_commands) const
+    {
+        // FILL THE BUFFER WITH THE DRAW COMMANDS.
+        // Stream usage is specified since the commands are typically only drawn once.
+        GLsizeiptr draw_commands_size_in_bytes = sizeof(DrawArraysIndirectCommand) * draw_commands.size();
+        if (DirectStateAccessSupported())
+        {
+            glNamedBufferData(BufferId, draw_commands_size_in_bytes, draw_commands.data(), GL_STREAM_DRAW);
+        }
+        else
+        {
+            glBindBuffer(GL_DRAW_INDIRECT_BUFFER, BufferId);
+            glBufferData(GL_DRAW_INDIRECT_BUFFER, draw_commands_size_in_bytes, draw_commands.data(), GL_STREAM_DRAW);
+        }
+    }
+}
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <vector>
+#include "Graphics/OpenGL/OpenGL.h"
+
+namespace GRAPHICS
+{
+namespace OPEN_GL
+{
+    /// A single draw command read by the graphics device from an indirect draw buffer.
+    /// The layout of this structure is defined by OpenGL and must not be changed.
+    struct DrawArraysIndirectCommand
+    {
+        /// The number of vertices to draw.
+        GLuint VertexCount;
+        /// The number of instances to draw.
+        GLuint InstanceCount;
+        /// The index of the first vertex to draw in the bound vertex buffer.
+        GLuint FirstVertex;
+        /// The index of the first instance to draw in any bound per-instance data.
+        GLuint BaseInstance;
+    };
+
+    /// A buffer on a graphics device for holding draw commands, allowing many draws
+    /// to be submitted with a single call.  The contents are expected to be replaced
+    /// each frame.
+    class IndirectDrawBuffer
+    {
+    public:
+        // CONSTRUCTION.
+        explicit IndirectDrawBuffer(const GLuint buffer_id);
+
+        // PUBLIC METHODS.
+        void Fill(const std::vector<DrawArraysIndirectCommand>& draw_commands) const;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The ID of the indirect draw buffer.
+        GLuint BufferId;
+    };
+}
+}
@@ -0,0 +1,32 @@
+#include "Graphics/OpenGL/InstanceBuffer.h"
+
+namespace GRAPHICS
+{
+namespace OPEN_GL
+{
+    /// Constructor.
+    /// @param[in]  buffer_id - The ID of the instance buffer.
+    InstanceBuffer::InstanceBuffer(const GLuint buffer_id) :
+        BufferId(buffer_id)
+    {}
+
+    /// Fills this instance buffer with the provided data.  The buffer must be bound
+    /// via the graphics device for shader programs to read instance inputs from it.
+    /// @param[in]  instance_data - The raw per-instance data to place in the buffer.
+    void InstanceBuffer::Fill(const std::vector<float>& instance_data) const
+    {
+        // FILL THE BUFFER WITH THE INSTANCE DATA.
+        // Stream usage is specified since the data is typically only drawn once.
+        GLsizeiptr instance_data_size_in_bytes = sizeof(float) * instance_data.size();
+        if (DirectStateAccessSupported())
+        {
+            glNamedBufferData(BufferId, instance_data_size_in_bytes, instance_data.data(), GL_STREAM_DRAW);
+        }
+        else
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, BufferId);
+            glBufferData(GL_ARRAY_BUFFER, instance_data_size_in_bytes, instance_data.data(), GL_STREAM_DRAW);
+        }
+    }
+}
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <vector>
+#include "Graphics/OpenGL/OpenGL.h"
+
+namespace GRAPHICS
+{
+namespace OPEN_GL
+{
+    /// A buffer on a graphics device for holding per-instance data for instanced rendering.
+    /// Unlike a VertexBuffer, no vertex array is associated with this buffer since
+    /// instance data is meant to be attached to the vertex array of the mesh being
+    /// instanced.  The contents are expected to be replaced each frame.
+    class InstanceBuffer
+    {
+    public:
+        // CONSTRUCTION.
+        explicit InstanceBuffer(const GLuint buffer_id);
+
+        // PUBLIC METHODS.
+        void Fill(const std::vector<float>& instance_data) const;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The ID of the instance buffer.
+        GLuint BufferId;
+    };
+}
+}
@@ -0,0 +1,217 @@
+#include "Graphics/OpenGL/OcclusionCuller.h"
+
+namespace GRAPHICS
+{
+namespace OPEN_GL
+{
+    /// Attempts to create an occlusion culler.
+    /// @return The occlusion culler, if occlusion queries are supported; null otherwise.
+    std::unique_ptr<OcclusionCuller> OcclusionCuller::Create()
+    {
+        // MAKE SURE OCCLUSION QUERIES ARE SUPPORTED.
+        bool occlusion_query_functions_loaded = (
+            (nullptr != glGenQueries) &&
+            (nullptr != glDeleteQueries) &&
+            (nullptr != glBeginQuery) &&
+            (nullptr != glEndQuery) &&
+            (nullptr != glGetQueryObjectiv));
+        if (!occlusion_query_functions_loaded)
+        {
+            return nullptr;
+        }
+
+        // CREATE THE OCCLUSION CULLER.
+        std::unique_ptr<OcclusionCuller> occlusion_culler = std::make_unique<OcclusionCuller>();
+        return occlusion_culler;
+    }
+
+    /// Constructor.  Queries are only created once objects are submitted.
+    OcclusionCuller::OcclusionCuller() :
+        CurrentFrameStatistics(),
+        PreviousFrameStatistics(),
+        FrameNumber(0),
+        ObjectVisibilities(),
+        FreeQueryIds(),
+        RandomNumberGenerator()
+    {}
+
+    /// Destructor that deletes all queries.  The OpenGL context must still exist.
+    OcclusionCuller::~OcclusionCuller()
+    {
+        // COLLECT ALL QUERIES SO THEY CAN BE DELETED AT ONCE.
+        std::vector<GLuint> query_ids = FreeQueryIds;
+        for (const auto& object_and_visibility : ObjectVisibilities)
+        {
+            GLuint query_id = object_and_visibility.second.QueryId;
+            bool query_exists = (INVALID_ID != query_id);
+            if (query_exists)
+            {
+                query_ids.push_back(query_id);
+            }
+        }
+
+        // DELETE THE QUERIES.
+        bool queries_exist = !query_ids.empty();
+        if (queries_exist)
+        {
+            glDeleteQueries(static_cast<GLsizei>(query_ids.size()), query_ids.data());
+        }
+    }
+
+    /// Determines if objects can be drawn conditioned on the results of their queries.
+    /// @return True if conditional rendering is supported; false otherwise.
+    bool OcclusionCuller::ConditionalRenderingSupported() const
+    {
+        bool conditional_rendering_supported = (
+            (nullptr != glBeginConditionalRender) &&
+            (nullptr != glEndConditionalRender));
+        return conditional_rendering_supported;
+    }
+
+    /// Determines if an object should be assumed to be visible in the current frame.
+    /// The result of the object's latest query is used if it has become available,
+    /// without waiting for it.  Newly seen objects are assumed to be visible.
+    /// @param[in]  object_3D - The object to check.
+    /// @return True if the object should be drawn as visible; false if it was hidden.
+    bool OcclusionCuller::IsVisible(const GRAPHICS::Object3D& object_3D)
+    {
+        ObjectVisibility& visibility = Visibility(object_3D);
+        if (visibility.QueryPending)
+        {
+            // READ THE QUERY RESULT IF IT'S AVAILABLE.
+            GLint result_available = GL_FALSE;
+            glGetQueryObjectiv(visibility.QueryId, GL_QUERY_RESULT_AVAILABLE, &result_available);
+            if (GL_TRUE == result_available)
+            {
+                GLint any_samples_passed = GL_FALSE;
+                glGetQueryObjectiv(visibility.QueryId, GL_QUERY_RESULT, &any_samples_passed);
+                visibility.QueryPending = false;
+
+                // SCHEDULE THE NEXT CHECK FOR OBJECTS THAT BECAME VISIBLE.
+                // Visible objects are assumed to stay visible for a randomized number of frames.
+                bool became_visible = (GL_FALSE != any_samples_passed) && !visibility.Visible;
+                if (became_visible)
+                {
+                    std::uniform_int_distribution<unsigned int> assumed_visible_frame_counts(1, MAX_ASSUMED_VISIBLE_FRAME_COUNT);
+                    visibility.NextQueryFrameNumber = FrameNumber + assumed_visible_frame_counts(RandomNumberGenerator);
+                }
+                visibility.Visible = (GL_FALSE != any_samples_passed);
+            }
+        }
+        return visibility.Visible;
+    }
+
+    /// Begins a query around the draw of a visible object if its visibility is due to be checked.
+    /// If a query is begun, EndQuery() must be called after drawing the object.
+    /// @param[in]  object_3D - The visible object about to be drawn.
+    /// @return True if a query was begun; false otherwise.
+    bool OcclusionCuller::BeginObjectQuery(const GRAPHICS::Object3D& object_3D)
+    {
+        // CHECK IF THE OBJECT'S VISIBILITY IS DUE TO BE CHECKED.
+        ObjectVisibility& visibility = Visibility(object_3D);
+        bool query_due = !visibility.QueryPending && (FrameNumber >= visibility.NextQueryFrameNumber);
+        if (!query_due)
+        {
+            return false;
+        }
+
+        // BEGIN THE QUERY.
+        BeginQuery(visibility);
+        std::uniform_int_distribution<unsigned int> assumed_visible_frame_counts(1, MAX_ASSUMED_VISIBLE_FRAME_COUNT);
+        visibility.NextQueryFrameNumber = FrameNumber + assumed_visible_frame_counts(RandomNumberGenerator);
+        ++CurrentFrameStatistics.ObjectQueryCount;
+        return true;
+    }
+
+    /// Begins a query around the bounding box of a hidden object, unless one is already pending.
+    /// If a query is begun, the bounding box must be drawn and then EndQuery() called.
+    /// @param[in]  object_3D - The hidden object whose bounding box is about to be drawn.
+    /// @return The ID of the newly begun query; invalid if the object's previous query is still pending.
+    GLuint OcclusionCuller::BeginBoundingBoxQuery(const GRAPHICS::Object3D& object_3D)
+    {
+        // CHECK IF A QUERY IS STILL PENDING.
+        ObjectVisibility& visibility = Visibility(object_3D);
+        if (visibility.QueryPending)
+        {
+            return INVALID_ID;
+        }
+
+        // BEGIN THE QUERY.
+        BeginQuery(visibility);
+        ++CurrentFrameStatistics.BoundingBoxQueryCount;
+        return visibility.QueryId;
+    }
+
+    /// Ends the query begun most recently.
+    void OcclusionCuller::EndQuery()
+    {
+        glEndQuery(GL_ANY_SAMPLES_PASSED);
+    }
+
+    /// Marks the end of a frame, resetting statistics and forgetting objects that haven't been drawn recently.
+    void OcclusionCuller::EndFrame()
+    {
+        // FORGET OBJECTS THAT HAVEN'T BEEN DRAWN RECENTLY.
+        // They may have been moved or destroyed, and their queries can be reused.
+        for (auto object_and_visibility = ObjectVisibilities.begin(); object_and_visibility != ObjectVisibilities.end();)
+        {
+            const ObjectVisibility& visibility = object_and_visibility->second;
+            bool object_used_recently = ((FrameNumber - visibility.LastUsedFrameNumber) <= MAX_UNUSED_FRAME_COUNT);
+            if (object_used_recently)
+            {
+                ++object_and_visibility;
+                continue;
+            }
+
+            bool query_exists = (INVALID_ID != visibility.QueryId);
+            if (query_exists)
+            {
+                FreeQueryIds.push_back(visibility.QueryId);
+            }
+            object_and_visibility = ObjectVisibilities.erase(object_and_visibility);
+        }
+
+        // RESET STATISTICS FOR THE NEXT FRAME.
+        PreviousFrameStatistics = CurrentFrameStatistics;
+        CurrentFrameStatistics = OcclusionStatistics();
+        ++FrameNumber;
+    }
+
+    /// Gets the visibility of an object, tracking the object if it's newly seen.
+    /// @param[in]  object_3D - The object whose visibility to get.
+    /// @return The visibility of the object.
+    OcclusionCuller::ObjectVisibility& OcclusionCuller::Visibility(const GRAPHICS::Object3D& object_3D)
+    {
+        // A new object is default constructed as visible and due for a query.
+        ObjectVisibility& visibility = ObjectVisibilities[&object_3D];
+        visibility.LastUsedFrameNumber = FrameNumber;
+        return visibility;
+    }
+
+    /// Begins an occlusion query for an object, reusing a free query if possible.
+    /// @param[in,out]  visibility - The visibility of the object being queried.
+    void OcclusionCuller::BeginQuery(ObjectVisibility& visibility)
+    {
+        // GET A QUERY FOR THE OBJECT IF IT DOESN'T HAVE ONE.
+        bool query_exists = (INVALID_ID != visibility.QueryId);
+        if (!query_exists)
+        {
+            bool free_query_exists = !FreeQueryIds.empty();
+            if (free_query_exists)
+            {
+                visibility.QueryId = FreeQueryIds.back();
+                FreeQueryIds.pop_back();
+            }
+            else
+            {
+                const GLsizei ONE_QUERY = 1;
+                glGenQueries(ONE_QUERY, &visibility.QueryId);
+            }
+        }
+
+        // BEGIN THE QUERY.
+        glBeginQuery(GL_ANY_SAMPLES_PASSED, visibility.QueryId);
+        visibility.QueryPending = true;
+    }
+}
+}
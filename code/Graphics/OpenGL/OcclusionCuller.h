@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <vector>
+#include "Graphics/Object3D.h"
+#include "Graphics/OpenGL/OpenGL.h"
+
+namespace GRAPHICS
+{
+namespace OPEN_GL
+{
+    /// Tracks which objects are hidden behind others using hardware occlusion queries
+    /// (GL_ANY_SAMPLES_PASSED), following the temporal coherence ideas of CHC++.
+    ///
+    /// Objects are assumed to stay visible or hidden from one frame to the next:
+    /// - Objects visible in the previous frame are drawn immediately, with their own draws
+    ///   occasionally wrapped in queries to detect when they become hidden.  Each visible
+    ///   object is only re-queried after a randomized number of frames, which spreads
+    ///   queries for many objects across frames.
+    /// - Objects hidden in the previous frame are tested by drawing their bounding boxes
+    ///   (after visible objects have filled the depth buffer) inside queries.  If conditional
+    ///   rendering is supported, the objects are then drawn conditioned on the queries, so
+    ///   the GPU (rather than the CPU) skips objects that are still hidden and objects that
+    ///   reappear are drawn without delay.  Otherwise, they stay culled until results arrive.
+    ///
+    /// Query results are only read once available, so the CPU never waits for them.
+    /// Until a result arrives, the object's previous visibility is assumed.
+    ///
+    /// Requires OpenGL 3.3 or ARB_occlusion_query2.
+    class OcclusionCuller
+    {
+    public:
+        // CONSTANTS.
+        /// The maximum number of frames a visible object is assumed to remain visible
+        /// before its visibility is checked again.
+        static const unsigned int MAX_ASSUMED_VISIBLE_FRAME_COUNT = 8;
+        /// The number of frames an object can go without being drawn before its
+        /// visibility (and query) is forgotten.
+        static const uint64_t MAX_UNUSED_FRAME_COUNT = 600;
+
+        // PUBLIC TYPES.
+        /// Counts of how objects were handled within a frame.
+        struct OcclusionStatistics
+        {
+            /// The number of objects submitted for occlusion culling.
+            unsigned int SubmittedObjectCount = 0;
+            /// The number of objects drawn unconditionally because they were assumed to be visible.
+            unsigned int DrawnObjectCount = 0;
+            /// The number of objects drawn conditioned on the results of their bounding box queries.
+            unsigned int ConditionallyDrawnObjectCount = 0;
+            /// The number of objects not drawn at all because they were hidden in an earlier frame.
+            unsigned int CulledObjectCount = 0;
+            /// The number of queries issued for the bounding boxes of hidden objects.
+            unsigned int BoundingBoxQueryCount = 0;
+            /// The number of queries issued for the draws of visible objects.
+            unsigned int ObjectQueryCount = 0;
+        };
+
+        // CONSTRUCTION.
+        static std::unique_ptr<OcclusionCuller> Create();
+        explicit OcclusionCuller();
+        ~OcclusionCuller();
+
+        // VISIBILITY.
+        bool ConditionalRenderingSupported() const;
+        bool IsVisible(const GRAPHICS::Object3D& object_3D);
+        bool BeginObjectQuery(const GRAPHICS::Object3D& object_3D);
+        GLuint BeginBoundingBoxQuery(const GRAPHICS::Object3D& object_3D);
+        void EndQuery();
+        void EndFrame();
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// Statistics for the frame currently being drawn.
+        OcclusionStatistics CurrentFrameStatistics;
+        /// Statistics for the previous (completed) frame.
+        OcclusionStatistics PreviousFrameStatistics;
+
+    private:
+        // PRIVATE TYPES.
+        /// What is known about whether an object is hidden.
+        struct ObjectVisibility
+        {
+            /// True if the object was visible according to the latest query result; false if hidden.
+            bool Visible = true;
+            /// The query for the object.  Invalid if no query has been issued yet.
+            GLuint QueryId = INVALID_ID;
+            /// True if the query has been issued but its result hasn't been read yet.
+            bool QueryPending = false;
+            /// The frame in which a visible object should next have its visibility checked.
+            uint64_t NextQueryFrameNumber = 0;
+            /// The last frame in which the object was submitted.
+            uint64_t LastUsedFrameNumber = 0;
+        };
+
+        // HELPER METHODS.
+        ObjectVisibility& Visibility(const GRAPHICS::Object3D& object_3D);
+        void BeginQuery(ObjectVisibility& visibility);
+
+        // MEMBER VARIABLES.
+        /// The number of the frame currently being drawn.
+        uint64_t FrameNumber;
+        /// The visibility of objects, keyed by their addresses.  Since an address may be reused
+        /// by a different object, a new object may briefly inherit the visibility of an old one.
+        std::unordered_map<const GRAPHICS::Object3D*, ObjectVisibility> ObjectVisibilities;
+        /// Query objects no longer used by any object, for reuse.
+        std::vector<GLuint> FreeQueryIds;
+        /// Generates the randomized intervals between visibility checks for visible objects.
+        std::minstd_rand RandomNumberGenerator;
+    };
+}
+}
@@ -1,3 +1,4 @@
+#include <cstring>
 #include "Graphics/OpenGL/OpenGL.h"
 
 namespace GRAPHICS
@@ -9,6 +10,8 @@ namespace OPEN_GL
     PFNGLGENBUFFERSPROC glGenBuffers = nullptr;
     PFNGLBINDBUFFERPROC glBindBuffer = nullptr;
     PFNGLBUFFERDATAPROC glBufferData = nullptr;
+    PFNGLBUFFERSUBDATAPROC glBufferSubData = nullptr;
+    PFNGLCOPYBUFFERSUBDATAPROC glCopyBufferSubData = nullptr;
     PFNGLCREATESHADERPROC glCreateShader = nullptr;
     PFNGLSHADERSOURCEPROC glShaderSource = nullptr;
     PFNGLCOMPILESHADERPROC glCompileShader = nullptr;
@@ -16,8 +19,11 @@ namespace OPEN_GL
     PFNGLGETSHADERINFOLOGPROC glGetShaderInfoLog = nullptr;
     PFNGLCREATEPROGRAMPROC glCreateProgram = nullptr;
     PFNGLATTACHSHADERPROC glAttachShader = nullptr;
+    PFNGLBINDATTRIBLOCATIONPROC glBindAttribLocation = nullptr;
     PFNGLBINDFRAGDATALOCATIONPROC glBindFragDataLocation = nullptr;
     PFNGLLINKPROGRAMPROC glLinkProgram = nullptr;
+    PFNGLGETPROGRAMIVPROC glGetProgramiv = nullptr;
+    PFNGLGETPROGRAMINFOLOGPROC glGetProgramInfoLog = nullptr;
     PFNGLUSEPROGRAMPROC glUseProgram = nullptr;
     PFNGLGETATTRIBLOCATIONPROC glGetAttribLocation = nullptr;
     PFNGLVERTEXATTRIBPOINTERPROC glVertexAttribPointer = nullptr;
@@ -31,6 +37,55 @@ namespace OPEN_GL
     PFNGLGETUNIFORMLOCATIONPROC glGetUniformLocation = nullptr;
     PFNGLUNIFORM3FPROC glUniform3f = nullptr;
     PFNGLUNIFORMMATRIX4FVPROC glUniformMatrix4fv = nullptr;
+    PFNGLMAPBUFFERRANGEPROC glMapBufferRange = nullptr;
+    PFNGLUNMAPBUFFERPROC glUnmapBuffer = nullptr;
+    PFNGLFENCESYNCPROC glFenceSync = nullptr;
+    PFNGLCLIENTWAITSYNCPROC glClientWaitSync = nullptr;
+    PFNGLDELETESYNCPROC glDeleteSync = nullptr;
+    PFNGLGETSTRINGIPROC glGetStringi = nullptr;
+    PFNGLBUFFERSTORAGEPROC glBufferStorage = nullptr;
+    PFNGLDRAWARRAYSINSTANCEDPROC glDrawArraysInstanced = nullptr;
+    PFNGLVERTEXATTRIBDIVISORPROC glVertexAttribDivisor = nullptr;
+    PFNGLMULTIDRAWARRAYSINDIRECTPROC glMultiDrawArraysIndirect = nullptr;
+    PFNGLVERTEXATTRIBFORMATPROC glVertexAttribFormat = nullptr;
+    PFNGLVERTEXATTRIBBINDINGPROC glVertexAttribBinding = nullptr;
+    PFNGLBINDVERTEXBUFFERPROC glBindVertexBuffer = nullptr;
+    PFNGLVERTEXBINDINGDIVISORPROC glVertexBindingDivisor = nullptr;
+    PFNGLGETPROGRAMBINARYPROC glGetProgramBinary = nullptr;
+    PFNGLPROGRAMBINARYPROC glProgramBinary = nullptr;
+    PFNGLPROGRAMPARAMETERIPROC glProgramParameteri = nullptr;
+    PFNGLMAXSHADERCOMPILERTHREADSARBPROC glMaxShaderCompilerThreadsARB = nullptr;
+    PFNGLDEBUGMESSAGECALLBACKPROC glDebugMessageCallback = nullptr;
+    PFNGLGENQUERIESPROC glGenQueries = nullptr;
+    PFNGLDELETEQUERIESPROC glDeleteQueries = nullptr;
+    PFNGLBEGINQUERYPROC glBeginQuery = nullptr;
+    PFNGLENDQUERYPROC glEndQuery = nullptr;
+    PFNGLGETQUERYOBJECTIVPROC glGetQueryObjectiv = nullptr;
+    PFNGLQUERYCOUNTERPROC glQueryCounter = nullptr;
+    PFNGLGETQUERYOBJECTUI64VPROC glGetQueryObjectui64v = nullptr;
+    PFNGLBEGINCONDITIONALRENDERPROC glBeginConditionalRender = nullptr;
+    PFNGLENDCONDITIONALRENDERPROC glEndConditionalRender = nullptr;
+    PFNGLDISPATCHCOMPUTEPROC glDispatchCompute = nullptr;
+    PFNGLMEMORYBARRIERPROC glMemoryBarrier = nullptr;
+    PFNGLBINDBUFFERBASEPROC glBindBufferBase = nullptr;
+    PFNGLCLEARBUFFERDATAPROC glClearBufferData = nullptr;
+    PFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC glMultiDrawArraysIndirectCountARB = nullptr;
+    PFNGLCREATEBUFFERSPROC glCreateBuffers = nullptr;
+    PFNGLNAMEDBUFFERSTORAGEPROC glNamedBufferStorage = nullptr;
+    PFNGLNAMEDBUFFERDATAPROC glNamedBufferData = nullptr;
+    PFNGLNAMEDBUFFERSUBDATAPROC glNamedBufferSubData = nullptr;
+    PFNGLCOPYNAMEDBUFFERSUBDATAPROC glCopyNamedBufferSubData = nullptr;
+    PFNGLMAPNAMEDBUFFERRANGEPROC glMapNamedBufferRange = nullptr;
+    PFNGLUNMAPNAMEDBUFFERPROC glUnmapNamedBuffer = nullptr;
+    PFNGLCREATEVERTEXARRAYSPROC glCreateVertexArrays = nullptr;
+    PFNGLENABLEVERTEXARRAYATTRIBPROC glEnableVertexArrayAttrib = nullptr;
+    PFNGLVERTEXARRAYATTRIBFORMATPROC glVertexArrayAttribFormat = nullptr;
+    PFNGLVERTEXARRAYATTRIBBINDINGPROC glVertexArrayAttribBinding = nullptr;
+    PFNGLVERTEXARRAYBINDINGDIVISORPROC glVertexArrayBindingDivisor = nullptr;
+    PFNGLVERTEXARRAYVERTEXBUFFERPROC glVertexArrayVertexBuffer = nullptr;
+
+    /// True if all direct state access functions were loaded and are supported by the rendering context; false otherwise.
+    static bool DirectStateAccessFunctionsSupported = false;
 
     /// Attempts to load all necessary OpenGL functions.
     /// @return True if loading succeeds; false otherwise.
@@ -42,6 +97,8 @@ namespace OPEN_GL
         glGenBuffers = (PFNGLGENBUFFERSPROC)wglGetProcAddress("glGenBuffers");
         glBindBuffer = (PFNGLBINDBUFFERPROC)wglGetProcAddress("glBindBuffer");
         glBufferData = (PFNGLBUFFERDATAPROC)wglGetProcAddress("glBufferData");
+        glBufferSubData = (PFNGLBUFFERSUBDATAPROC)wglGetProcAddress("glBufferSubData");
+        glCopyBufferSubData = (PFNGLCOPYBUFFERSUBDATAPROC)wglGetProcAddress("glCopyBufferSubData");
         glCreateShader = (PFNGLCREATESHADERPROC)wglGetProcAddress("glCreateShader");
         glShaderSource = (PFNGLSHADERSOURCEPROC)wglGetProcAddress("glShaderSource");
         glCompileShader = (PFNGLCOMPILESHADERPROC)wglGetProcAddress("glCompileShader");
@@ -49,8 +106,11 @@ namespace OPEN_GL
         glGetShaderInfoLog = (PFNGLGETSHADERINFOLOGPROC)wglGetProcAddress("glGetShaderInfoLog");
         glCreateProgram = (PFNGLCREATEPROGRAMPROC)wglGetProcAddress("glCreateProgram");
         glAttachShader = (PFNGLATTACHSHADERPROC)wglGetProcAddress("glAttachShader");
+        glBindAttribLocation = (PFNGLBINDATTRIBLOCATIONPROC)wglGetProcAddress("glBindAttribLocation");
         glBindFragDataLocation = (PFNGLBINDFRAGDATALOCATIONPROC)wglGetProcAddress("glBindFragDataLocation");
         glLinkProgram = (PFNGLLINKPROGRAMPROC)wglGetProcAddress("glLinkProgram");
+        glGetProgramiv = (PFNGLGETPROGRAMIVPROC)wglGetProcAddress("glGetProgramiv");
+        glGetProgramInfoLog = (PFNGLGETPROGRAMINFOLOGPROC)wglGetProcAddress("glGetProgramInfoLog");
         glUseProgram = (PFNGLUSEPROGRAMPROC)wglGetProcAddress("glUseProgram");
         glGetAttribLocation = (PFNGLGETATTRIBLOCATIONPROC)wglGetProcAddress("glGetAttribLocation");
         glVertexAttribPointer = (PFNGLVERTEXATTRIBPOINTERPROC)wglGetProcAddress("glVertexAttribPointer");
@@ -64,6 +124,65 @@ namespace OPEN_GL
         glGetUniformLocation = (PFNGLGETUNIFORMLOCATIONPROC)wglGetProcAddress("glGetUniformLocation");
         glUniform3f = (PFNGLUNIFORM3FPROC)wglGetProcAddress("glUniform3f");
         glUniformMatrix4fv = (PFNGLUNIFORMMATRIX4FVPROC)wglGetProcAddress("glUniformMatrix4fv");
+        glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC)wglGetProcAddress("glMapBufferRange");
+        glUnmapBuffer = (PFNGLUNMAPBUFFERPROC)wglGetProcAddress("glUnmapBuffer");
+        glFenceSync = (PFNGLFENCESYNCPROC)wglGetProcAddress("glFenceSync");
+        glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)wglGetProcAddress("glClientWaitSync");
+        glDeleteSync = (PFNGLDELETESYNCPROC)wglGetProcAddress("glDeleteSync");
+        glGetStringi = (PFNGLGETSTRINGIPROC)wglGetProcAddress("glGetStringi");
+
+        // LOAD OPTIONAL OPEN GL FUNCTIONS.
+        // These are not checked below since they may legitimately be unavailable.
+        // Since they're loaded through the temporary context, whether the rendering context
+        // actually supports them is only determined later by DetectSupportedFunctions().
+        glBufferStorage = (PFNGLBUFFERSTORAGEPROC)wglGetProcAddress("glBufferStorage");
+        glDrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDPROC)wglGetProcAddress("glDrawArraysInstanced");
+        glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC)wglGetProcAddress("glVertexAttribDivisor");
+        glMultiDrawArraysIndirect = (PFNGLMULTIDRAWARRAYSINDIRECTPROC)wglGetProcAddress("glMultiDrawArraysIndirect");
+        glVertexAttribFormat = (PFNGLVERTEXATTRIBFORMATPROC)wglGetProcAddress("glVertexAttribFormat");
+        glVertexAttribBinding = (PFNGLVERTEXATTRIBBINDINGPROC)wglGetProcAddress("glVertexAttribBinding");
+        glBindVertexBuffer = (PFNGLBINDVERTEXBUFFERPROC)wglGetProcAddress("glBindVertexBuffer");
+        glVertexBindingDivisor = (PFNGLVERTEXBINDINGDIVISORPROC)wglGetProcAddress("glVertexBindingDivisor");
+        glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)wglGetProcAddress("glGetProgramBinary");
+        glProgramBinary = (PFNGLPROGRAMBINARYPROC)wglGetProcAddress("glProgramBinary");
+        glProgramParameteri = (PFNGLPROGRAMPARAMETERIPROC)wglGetProcAddress("glProgramParameteri");
+        glMaxShaderCompilerThreadsARB = (PFNGLMAXSHADERCOMPILERTHREADSARBPROC)wglGetProcAddress("glMaxShaderCompilerThreadsKHR");
+        if (nullptr == glMaxShaderCompilerThreadsARB)
+        {
+            glMaxShaderCompilerThreadsARB = (PFNGLMAXSHADERCOMPILERTHREADSARBPROC)wglGetProcAddress("glMaxShaderCompilerThreadsARB");
+        }
+        glDebugMessageCallback = (PFNGLDEBUGMESSAGECALLBACKPROC)wglGetProcAddress("glDebugMessageCallback");
+        glGenQueries = (PFNGLGENQUERIESPROC)wglGetProcAddress("glGenQueries");
+        glDeleteQueries = (PFNGLDELETEQUERIESPROC)wglGetProcAddress("glDeleteQueries");
+        glBeginQuery = (PFNGLBEGINQUERYPROC)wglGetProcAddress("glBeginQuery");
+        glEndQuery = (PFNGLENDQUERYPROC)wglGetProcAddress("glEndQuery");
+        glGetQueryObjectiv = (PFNGLGETQUERYOBJECTIVPROC)wglGetProcAddress("glGetQueryObjectiv");
+        glQueryCounter = (PFNGLQUERYCOUNTERPROC)wglGetProcAddress("glQueryCounter");
+        glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC)wglGetProcAddress("glGetQueryObjectui64v");
+        glBeginConditionalRender = (PFNGLBEGINCONDITIONALRENDERPROC)wglGetProcAddress("glBeginConditionalRender");
+        glEndConditionalRender = (PFNGLENDCONDITIONALRENDERPROC)wglGetProcAddress("glEndConditionalRender");
+        glDispatchCompute = (PFNGLDISPATCHCOMPUTEPROC)wglGetProcAddress("glDispatchCompute");
+        glMemoryBarrier = (PFNGLMEMORYBARRIERPROC)wglGetProcAddress("glMemoryBarrier");
+        glBindBufferBase = (PFNGLBINDBUFFERBASEPROC)wglGetProcAddress("glBindBufferBase");
+        glClearBufferData = (PFNGLCLEARBUFFERDATAPROC)wglGetProcAddress("glClearBufferData");
+        glMultiDrawArraysIndirectCountARB = (PFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC)wglGetProcAddress("glMultiDrawArraysIndirectCount");
+        if (nullptr == glMultiDrawArraysIndirectCountARB)
+        {
+            glMultiDrawArraysIndirectCountARB = (PFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC)wglGetProcAddress("glMultiDrawArraysIndirectCountARB");
+        }
+        glCreateBuffers = (PFNGLCREATEBUFFERSPROC)wglGetProcAddress("glCreateBuffers");
+        glNamedBufferStorage = (PFNGLNAMEDBUFFERSTORAGEPROC)wglGetProcAddress("glNamedBufferStorage");
+        glNamedBufferData = (PFNGLNAMEDBUFFERDATAPROC)wglGetProcAddress("glNamedBufferData");
+        glNamedBufferSubData = (PFNGLNAMEDBUFFERSUBDATAPROC)wglGetProcAddress("glNamedBufferSubData");
+        glCopyNamedBufferSubData = (PFNGLCOPYNAMEDBUFFERSUBDATAPROC)wglGetProcAddress("glCopyNamedBufferSubData");
+        glMapNamedBufferRange = (PFNGLMAPNAMEDBUFFERRANGEPROC)wglGetProcAddress("glMapNamedBufferRange");
+        glUnmapNamedBuffer = (PFNGLUNMAPNAMEDBUFFERPROC)wglGetProcAddress("glUnmapNamedBuffer");
+        glCreateVertexArrays = (PFNGLCREATEVERTEXARRAYSPROC)wglGetProcAddress("glCreateVertexArrays");
+        glEnableVertexArrayAttrib = (PFNGLENABLEVERTEXARRAYATTRIBPROC)wglGetProcAddress("glEnableVertexArrayAttrib");
+        glVertexArrayAttribFormat = (PFNGLVERTEXARRAYATTRIBFORMATPROC)wglGetProcAddress("glVertexArrayAttribFormat");
+        glVertexArrayAttribBinding = (PFNGLVERTEXARRAYATTRIBBINDINGPROC)wglGetProcAddress("glVertexArrayAttribBinding");
+        glVertexArrayBindingDivisor = (PFNGLVERTEXARRAYBINDINGDIVISORPROC)wglGetProcAddress("glVertexArrayBindingDivisor");
+        glVertexArrayVertexBuffer = (PFNGLVERTEXARRAYVERTEXBUFFERPROC)wglGetProcAddress("glVertexArrayVertexBuffer");
 
         // CHECK IF LOADING SUCCEEDED.
         bool loading_succeeded = (
@@ -72,6 +191,8 @@ namespace OPEN_GL
             glGenBuffers &&
             glBindBuffer &&
             glBufferData &&
+            glBufferSubData &&
+            glCopyBufferSubData &&
             glCreateShader &&
             glShaderSource &&
             glCompileShader &&
@@ -79,8 +200,11 @@ namespace OPEN_GL
             glGetShaderInfoLog &&
             glCreateProgram &&
             glAttachShader &&
+            glBindAttribLocation &&
             glBindFragDataLocation &&
             glLinkProgram &&
+            glGetProgramiv &&
+            glGetProgramInfoLog &&
             glUseProgram &&
             glGetAttribLocation &&
             glVertexAttribPointer &&
@@ -93,10 +217,175 @@ namespace OPEN_GL
             glDeleteVertexArrays &&
             glGetUniformLocation &&
             glUniform3f &&
-            glUniformMatrix4fv);
+            glUniformMatrix4fv &&
+            glMapBufferRange &&
+            glUnmapBuffer &&
+            glFenceSync &&
+            glClientWaitSync &&
+            glDeleteSync &&
+            glGetStringi);
         return loading_succeeded;
     }
 
+    /// Determines if the current OpenGL context is at least a specific version.
+    /// @param[in]  required_major_version - The major version required.
+    /// @param[in]  required_minor_version - The minor version required.
+    /// @return True if the context is at least the required version; false otherwise.
+    static bool VersionSupported(const GLint required_major_version, const GLint required_minor_version)
+    {
+        GLint major_version = 0;
+        glGetIntegerv(GL_MAJOR_VERSION, &major_version);
+        GLint minor_version = 0;
+        glGetIntegerv(GL_MINOR_VERSION, &minor_version);
+
+        bool version_supported = (
+            (major_version > required_major_version) ||
+            ((major_version == required_major_version) && (minor_version >= required_minor_version)));
+        return version_supported;
+    }
+
+    /// Determines if the current OpenGL context supports an extension.
+    /// @param[in]  extension_name - The full name of the extension (like "GL_ARB_buffer_storage").
+    /// @return True if the context reports the extension; false otherwise.
+    static bool ExtensionSupported(const char* const extension_name)
+    {
+        GLint extension_count = 0;
+        glGetIntegerv(GL_NUM_EXTENSIONS, &extension_count);
+        for (GLint extension_index = 0; extension_index < extension_count; ++extension_index)
+        {
+            const GLubyte* current_extension_name = glGetStringi(GL_EXTENSIONS, static_cast<GLuint>(extension_index));
+            bool extension_found = (
+                (nullptr != current_extension_name) &&
+                (0 == std::strcmp(reinterpret_cast<const char*>(current_extension_name), extension_name)));
+            if (extension_found)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /// Clears any optional functions that the current OpenGL context doesn't support so that
+    /// code checking them for null falls back to other functionality.  Functions are loaded
+    /// through a temporary context (and drivers may return addresses for functions they don't
+    /// support anyway), so this must be called once the context used for rendering is current.
+    void DetectSupportedFunctions()
+    {
+        // CLEAR BUFFER STORAGE FUNCTIONS IF UNSUPPORTED.
+        bool buffer_storage_supported = (VersionSupported(4, 4) || ExtensionSupported("GL_ARB_buffer_storage"));
+        if (!buffer_storage_supported)
+        {
+            glBufferStorage = nullptr;
+        }
+
+        // CLEAR INSTANCED RENDERING FUNCTIONS IF UNSUPPORTED.
+        bool instanced_drawing_supported = (VersionSupported(3, 1) || ExtensionSupported("GL_ARB_draw_instanced"));
+        if (!instanced_drawing_supported)
+        {
+            glDrawArraysInstanced = nullptr;
+        }
+        bool instanced_arrays_supported = (VersionSupported(3, 3) || ExtensionSupported("GL_ARB_instanced_arrays"));
+        if (!instanced_arrays_supported)
+        {
+            glVertexAttribDivisor = nullptr;
+        }
+
+        // CLEAR MULTI-DRAW INDIRECT FUNCTIONS IF UNSUPPORTED.
+        bool multi_draw_indirect_supported = (VersionSupported(4, 3) || ExtensionSupported("GL_ARB_multi_draw_indirect"));
+        if (!multi_draw_indirect_supported)
+        {
+            glMultiDrawArraysIndirect = nullptr;
+        }
+        bool indirect_parameters_supported = (VersionSupported(4, 6) || ExtensionSupported("GL_ARB_indirect_parameters"));
+        if (!indirect_parameters_supported)
+        {
+            glMultiDrawArraysIndirectCountARB = nullptr;
+        }
+
+        // CLEAR SEPARATE VERTEX ATTRIBUTE FORMAT FUNCTIONS IF UNSUPPORTED.
+        bool vertex_attribute_binding_supported = (VersionSupported(4, 3) || ExtensionSupported("GL_ARB_vertex_attrib_binding"));
+        if (!vertex_attribute_binding_supported)
+        {
+            glVertexAttribFormat = nullptr;
+            glVertexAttribBinding = nullptr;
+            glBindVertexBuffer = nullptr;
+            glVertexBindingDivisor = nullptr;
+        }
+
+        // CLEAR PROGRAM BINARY FUNCTIONS IF UNSUPPORTED.
+        bool program_binaries_supported = (VersionSupported(4, 1) || ExtensionSupported("GL_ARB_get_program_binary"));
+        if (!program_binaries_supported)
+        {
+            glGetProgramBinary = nullptr;
+            glProgramBinary = nullptr;
+            glProgramParameteri = nullptr;
+        }
+
+        // CLEAR PARALLEL SHADER COMPILATION FUNCTIONS IF UNSUPPORTED.
+        bool parallel_shader_compile_supported = (
+            ExtensionSupported("GL_KHR_parallel_shader_compile") ||
+            ExtensionSupported("GL_ARB_parallel_shader_compile"));
+        if (!parallel_shader_compile_supported)
+        {
+            glMaxShaderCompilerThreadsARB = nullptr;
+        }
+
+        // CLEAR DEBUG OUTPUT FUNCTIONS IF UNSUPPORTED.
+        bool debug_output_supported = (VersionSupported(4, 3) || ExtensionSupported("GL_KHR_debug"));
+        if (!debug_output_supported)
+        {
+            glDebugMessageCallback = nullptr;
+        }
+
+        // CLEAR TIMER QUERY FUNCTIONS IF UNSUPPORTED.
+        bool timer_queries_supported = (VersionSupported(3, 3) || ExtensionSupported("GL_ARB_timer_query"));
+        if (!timer_queries_supported)
+        {
+            glQueryCounter = nullptr;
+            glGetQueryObjectui64v = nullptr;
+        }
+
+        // CLEAR COMPUTE SHADER FUNCTIONS IF UNSUPPORTED.
+        bool compute_shaders_supported = VersionSupported(4, 3) || (
+            ExtensionSupported("GL_ARB_compute_shader") &&
+            ExtensionSupported("GL_ARB_shader_storage_buffer_object") &&
+            ExtensionSupported("GL_ARB_clear_buffer_object"));
+        if (!compute_shaders_supported)
+        {
+            glDispatchCompute = nullptr;
+            glMemoryBarrier = nullptr;
+            glClearBufferData = nullptr;
+        }
+
+        // DETECT IF DIRECT STATE ACCESS IS SUPPORTED.
+        // It is only used if all functions are available so that code paths don't need to mix approaches.
+        bool direct_state_access_reported = (VersionSupported(4, 5) || ExtensionSupported("GL_ARB_direct_state_access"));
+        DirectStateAccessFunctionsSupported = (
+            direct_state_access_reported &&
+            (nullptr != glCreateBuffers) &&
+            (nullptr != glNamedBufferStorage) &&
+            (nullptr != glNamedBufferData) &&
+            (nullptr != glNamedBufferSubData) &&
+            (nullptr != glCopyNamedBufferSubData) &&
+            (nullptr != glMapNamedBufferRange) &&
+            (nullptr != glUnmapNamedBuffer) &&
+            (nullptr != glCreateVertexArrays) &&
+            (nullptr != glEnableVertexArrayAttrib) &&
+            (nullptr != glVertexArrayAttribFormat) &&
+            (nullptr != glVertexArrayAttribBinding) &&
+            (nullptr != glVertexArrayBindingDivisor) &&
+            (nullptr != glVertexArrayVertexBuffer));
+    }
+
+    /// Determines if direct state access functions can be used to create and modify objects
+    /// without binding them.  Only valid once supported functions have been detected.
+    /// @return True if direct state access is supported; false if objects must be bound to be modified.
+    bool DirectStateAccessSupported()
+    {
+        return DirectStateAccessFunctionsSupported;
+    }
+
     /// Initializes OpenGL by loading the necessary functions.
     /// @param[in] device_context - The device context for which OpenGL should be initialized.
     /// @return True if initialization succeeds; false otherwise.
@@ -19,13 +19,18 @@ namespace OPEN_GL
     const GLuint INVALID_ID = 0;
 
     /// The Initialize function should be called once to load OpenGL functions.
+    /// DetectSupportedFunctions should then be called once the rendering context is current.
     bool Initialize(const HDC device_context);
+    void DetectSupportedFunctions();
+    bool DirectStateAccessSupported();
 
     extern PFNWGLCHOOSEPIXELFORMATARBPROC wglChoosePixelFormatARB;
     extern PFNWGLCREATECONTEXTATTRIBSARBPROC wglCreateContextAttribsARB;
     extern PFNGLGENBUFFERSPROC glGenBuffers;
     extern PFNGLBINDBUFFERPROC glBindBuffer;
     extern PFNGLBUFFERDATAPROC glBufferData;
+    extern PFNGLBUFFERSUBDATAPROC glBufferSubData;
+    extern PFNGLCOPYBUFFERSUBDATAPROC glCopyBufferSubData;
     extern PFNGLCREATESHADERPROC glCreateShader;
     extern PFNGLSHADERSOURCEPROC glShaderSource;
     extern PFNGLCOMPILESHADERPROC glCompileShader;
@@ -33,8 +38,11 @@ namespace OPEN_GL
     extern PFNGLGETSHADERINFOLOGPROC glGetShaderInfoLog;
     extern PFNGLCREATEPROGRAMPROC glCreateProgram;
     extern PFNGLATTACHSHADERPROC glAttachShader;
+    extern PFNGLBINDATTRIBLOCATIONPROC glBindAttribLocation;
     extern PFNGLBINDFRAGDATALOCATIONPROC glBindFragDataLocation;
     extern PFNGLLINKPROGRAMPROC glLinkProgram;
+    extern PFNGLGETPROGRAMIVPROC glGetProgramiv;
+    extern PFNGLGETPROGRAMINFOLOGPROC glGetProgramInfoLog;
     extern PFNGLUSEPROGRAMPROC glUseProgram;
     extern PFNGLGETATTRIBLOCATIONPROC glGetAttribLocation;
     extern PFNGLVERTEXATTRIBPOINTERPROC glVertexAttribPointer;
@@ -48,5 +56,68 @@ namespace OPEN_GL
     extern PFNGLGETUNIFORMLOCATIONPROC glGetUniformLocation;
     extern PFNGLUNIFORM3FPROC glUniform3f;
     extern PFNGLUNIFORMMATRIX4FVPROC glUniformMatrix4fv;
+    extern PFNGLMAPBUFFERRANGEPROC glMapBufferRange;
+    extern PFNGLUNMAPBUFFERPROC glUnmapBuffer;
+    extern PFNGLFENCESYNCPROC glFenceSync;
+    extern PFNGLCLIENTWAITSYNCPROC glClientWaitSync;
+    extern PFNGLDELETESYNCPROC glDeleteSync;
+    extern PFNGLGETSTRINGIPROC glGetStringi;
+
+    // OPTIONAL FUNCTIONS.
+    // These functions are only available in newer versions of OpenGL (or via extensions),
+    // so they may be null after initialization.  Code using them must check for null
+    // and fall back to other functionality if they are unavailable.  Since drivers may
+    // return functions the rendering context doesn't support, functions are only left
+    // non-null if the context reports the version or extension that provides them.
+    extern PFNGLBUFFERSTORAGEPROC glBufferStorage;
+    extern PFNGLDRAWARRAYSINSTANCEDPROC glDrawArraysInstanced;
+    extern PFNGLVERTEXATTRIBDIVISORPROC glVertexAttribDivisor;
+    extern PFNGLMULTIDRAWARRAYSINDIRECTPROC glMultiDrawArraysIndirect;
+    extern PFNGLVERTEXATTRIBFORMATPROC glVertexAttribFormat;
+    extern PFNGLVERTEXATTRIBBINDINGPROC glVertexAttribBinding;
+    extern PFNGLBINDVERTEXBUFFERPROC glBindVertexBuffer;
+    extern PFNGLVERTEXBINDINGDIVISORPROC glVertexBindingDivisor;
+    extern PFNGLGETPROGRAMBINARYPROC glGetProgramBinary;
+    extern PFNGLPROGRAMBINARYPROC glProgramBinary;
+    extern PFNGLPROGRAMPARAMETERIPROC glProgramParameteri;
+    // Loaded from KHR_parallel_shader_compile if available, or else ARB_parallel_shader_compile.
+    extern PFNGLMAXSHADERCOMPILERTHREADSARBPROC glMaxShaderCompilerThreadsARB;
+    extern PFNGLDEBUGMESSAGECALLBACKPROC glDebugMessageCallback;
+    // Query functions (timer queries require OpenGL 3.3 or ARB_timer_query, and
+    // GL_ANY_SAMPLES_PASSED occlusion queries require OpenGL 3.3 or ARB_occlusion_query2).
+    extern PFNGLGENQUERIESPROC glGenQueries;
+    extern PFNGLDELETEQUERIESPROC glDeleteQueries;
+    extern PFNGLBEGINQUERYPROC glBeginQuery;
+    extern PFNGLENDQUERYPROC glEndQuery;
+    extern PFNGLGETQUERYOBJECTIVPROC glGetQueryObjectiv;
+    extern PFNGLQUERYCOUNTERPROC glQueryCounter;
+    extern PFNGLGETQUERYOBJECTUI64VPROC glGetQueryObjectui64v;
+    // Conditional rendering functions (OpenGL 3.0 or NV_conditional_render).
+    extern PFNGLBEGINCONDITIONALRENDERPROC glBeginConditionalRender;
+    extern PFNGLENDCONDITIONALRENDERPROC glEndConditionalRender;
+    // Compute shader and shader storage buffer functions (OpenGL 4.3 or ARB_compute_shader,
+    // ARB_shader_storage_buffer_object, and ARB_clear_buffer_object).
+    extern PFNGLDISPATCHCOMPUTEPROC glDispatchCompute;
+    extern PFNGLMEMORYBARRIERPROC glMemoryBarrier;
+    extern PFNGLBINDBUFFERBASEPROC glBindBufferBase;
+    extern PFNGLCLEARBUFFERDATAPROC glClearBufferData;
+    // Loaded from OpenGL 4.6 if available, or else ARB_indirect_parameters.
+    extern PFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC glMultiDrawArraysIndirectCountARB;
+    // Direct state access functions (OpenGL 4.5 or ARB_direct_state_access).
+    // These allow objects to be created and modified without binding them,
+    // so that bindings used for drawing are left undisturbed.
+    extern PFNGLCREATEBUFFERSPROC glCreateBuffers;
+    extern PFNGLNAMEDBUFFERSTORAGEPROC glNamedBufferStorage;
+    extern PFNGLNAMEDBUFFERDATAPROC glNamedBufferData;
+    extern PFNGLNAMEDBUFFERSUBDATAPROC glNamedBufferSubData;
+    extern PFNGLCOPYNAMEDBUFFERSUBDATAPROC glCopyNamedBufferSubData;
+    extern PFNGLMAPNAMEDBUFFERRANGEPROC glMapNamedBufferRange;
+    extern PFNGLUNMAPNAMEDBUFFERPROC glUnmapNamedBuffer;
+    extern PFNGLCREATEVERTEXARRAYSPROC glCreateVertexArrays;
+    extern PFNGLENABLEVERTEXARRAYATTRIBPROC glEnableVertexArrayAttrib;
+    extern PFNGLVERTEXARRAYATTRIBFORMATPROC glVertexArrayAttribFormat;
+    extern PFNGLVERTEXARRAYATTRIBBINDINGPROC glVertexArrayAttribBinding;
+    extern PFNGLVERTEXARRAYBINDINGDIVISORPROC glVertexArrayBindingDivisor;
+    extern PFNGLVERTEXARRAYVERTEXBUFFERPROC glVertexArrayVertexBuffer;
 }
 }
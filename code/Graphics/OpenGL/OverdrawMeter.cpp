@@ -0,0 +1,221 @@
+#include "Graphics/OpenGL/OverdrawMeter.h"
+
+namespace GRAPHICS
+{
+namespace OPEN_GL
+{
+    /// Computes the average number of times each pixel on the screen was shaded.
+    /// @return The number of fragments shaded per pixel; 0 if the screen size is unknown.
+    double OverdrawMeter::FrameOverdraw::ShadedFragmentsPerPixel() const
+    {
+        bool screen_size_known = (ScreenPixelCount > 0);
+        if (!screen_size_known)
+        {
+            return 0.0;
+        }
+
+        double shaded_fragments_per_pixel = static_cast<double>(ColorPassSampleCount) / static_cast<double>(ScreenPixelCount);
+        return shaded_fragments_per_pixel;
+    }
+
+    /// Attempts to create an overdraw meter.
+    /// @return The overdraw meter, if sample queries with 64-bit results are supported; null otherwise.
+    std::unique_ptr<OverdrawMeter> OverdrawMeter::Create()
+    {
+        // MAKE SURE SAMPLE QUERIES ARE SUPPORTED.
+        bool query_functions_loaded = (
+            (nullptr != glGenQueries) &&
+            (nullptr != glDeleteQueries) &&
+            (nullptr != glBeginQuery) &&
+            (nullptr != glEndQuery) &&
+            (nullptr != glGetQueryObjectiv) &&
+            (nullptr != glGetQueryObjectui64v));
+        if (!query_functions_loaded)
+        {
+            return nullptr;
+        }
+
+        // CREATE THE METER.
+        std::unique_ptr<OverdrawMeter> overdraw_meter = std::make_unique<OverdrawMeter>();
+        return overdraw_meter;
+    }
+
+    /// Constructor.  Query objects are only created once passes are measured.
+    OverdrawMeter::OverdrawMeter() :
+        LatestFrameOverdraw(),
+        SkippedFrameCount(0),
+        QueryIds(),
+        CurrentFrame(),
+        CurrentFrameSkipped(false),
+        PendingFrames(),
+        FreeQueryIds()
+    {}
+
+    /// Destructor that deletes all query objects.  The OpenGL context must still exist.
+    OverdrawMeter::~OverdrawMeter()
+    {
+        bool queries_created = !QueryIds.empty();
+        if (queries_created)
+        {
+            glDeleteQueries(static_cast<GLsizei>(QueryIds.size()), QueryIds.data());
+        }
+    }
+
+    /// Begins counting samples passing the depth test in the depth pre-pass.
+    /// Must be followed by EndDepthPrePass() before any other sample queries begin.
+    void OverdrawMeter::BeginDepthPrePass()
+    {
+        bool frame_measurable = CurrentFrameMeasurable();
+        if (!frame_measurable)
+        {
+            return;
+        }
+
+        CurrentFrame.DepthPrePassQueryId = BeginQuery();
+    }
+
+    /// Ends counting samples for the depth pre-pass.
+    void OverdrawMeter::EndDepthPrePass()
+    {
+        bool depth_pre_pass_measured = (INVALID_ID != CurrentFrame.DepthPrePassQueryId);
+        if (depth_pre_pass_measured)
+        {
+            glEndQuery(GL_SAMPLES_PASSED);
+        }
+    }
+
+    /// Begins counting samples passing the depth test in the color pass.
+    /// Must be followed by EndColorPass() before any other sample queries begin.
+    void OverdrawMeter::BeginColorPass()
+    {
+        bool frame_measurable = CurrentFrameMeasurable();
+        if (!frame_measurable)
+        {
+            return;
+        }
+
+        // RECORD THE SIZE OF THE SCREEN BEING DRAWN TO.
+        const std::size_t VIEWPORT_WIDTH_INDEX = 2;
+        const std::size_t VIEWPORT_HEIGHT_INDEX = 3;
+        GLint viewport[4] = {};
+        glGetIntegerv(GL_VIEWPORT, viewport);
+        CurrentFrame.ScreenPixelCount = static_cast<uint64_t>(viewport[VIEWPORT_WIDTH_INDEX]) * static_cast<uint64_t>(viewport[VIEWPORT_HEIGHT_INDEX]);
+
+        CurrentFrame.ColorPassQueryId = BeginQuery();
+    }
+
+    /// Ends counting samples for the color pass.
+    void OverdrawMeter::EndColorPass()
+    {
+        bool color_pass_measured = (INVALID_ID != CurrentFrame.ColorPassQueryId);
+        if (color_pass_measured)
+        {
+            glEndQuery(GL_SAMPLES_PASSED);
+        }
+    }
+
+    /// Marks the end of a frame, reading results for the oldest earlier frames
+    /// whose results have become available.
+    void OverdrawMeter::EndFrame()
+    {
+        // WAIT FOR RESULTS FOR THE FRAME IF THE COLOR PASS WAS MEASURED.
+        // Without the color pass, there's no overdraw to report, so any lone depth pre-pass query is just recycled.
+        bool color_pass_measured = (INVALID_ID != CurrentFrame.ColorPassQueryId);
+        if (color_pass_measured)
+        {
+            PendingFrames.push_back(CurrentFrame);
+        }
+        else
+        {
+            bool depth_pre_pass_measured = (INVALID_ID != CurrentFrame.DepthPrePassQueryId);
+            if (depth_pre_pass_measured)
+            {
+                FreeQueryIds.push_back(CurrentFrame.DepthPrePassQueryId);
+            }
+        }
+        if (CurrentFrameSkipped)
+        {
+            ++SkippedFrameCount;
+        }
+
+        // START THE NEXT FRAME.
+        CurrentFrame = PendingFrame();
+        CurrentFrameSkipped = false;
+
+        // READ ANY RESULTS THAT HAVE ARRIVED.
+        while (!PendingFrames.empty())
+        {
+            // STOP IF THE OLDEST FRAME'S RESULTS AREN'T AVAILABLE YET.
+            // The color pass query is the last one issued for a frame, so its result arrives last.
+            PendingFrame& oldest_frame = PendingFrames.front();
+            GLint results_available = GL_FALSE;
+            glGetQueryObjectiv(oldest_frame.ColorPassQueryId, GL_QUERY_RESULT_AVAILABLE, &results_available);
+            if (GL_TRUE != results_available)
+            {
+                break;
+            }
+
+            // READ THE SAMPLE COUNTS.
+            FrameOverdraw frame_overdraw;
+            frame_overdraw.DepthPrePassUsed = (INVALID_ID != oldest_frame.DepthPrePassQueryId);
+            if (frame_overdraw.DepthPrePassUsed)
+            {
+                frame_overdraw.DepthPrePassSampleCount = ReadQueryResult(oldest_frame.DepthPrePassQueryId);
+                FreeQueryIds.push_back(oldest_frame.DepthPrePassQueryId);
+            }
+            frame_overdraw.ColorPassSampleCount = ReadQueryResult(oldest_frame.ColorPassQueryId);
+            FreeQueryIds.push_back(oldest_frame.ColorPassQueryId);
+            frame_overdraw.ScreenPixelCount = oldest_frame.ScreenPixelCount;
+            LatestFrameOverdraw = frame_overdraw;
+
+            PendingFrames.pop_front();
+        }
+    }
+
+    /// Determines if passes in the current frame can be measured, marking the frame
+    /// as skipped if too many earlier frames are still waiting for results.
+    /// @return True if the current frame can be measured; false otherwise.
+    bool OverdrawMeter::CurrentFrameMeasurable()
+    {
+        bool too_many_frames_pending = (PendingFrames.size() >= MAX_PENDING_FRAME_COUNT);
+        if (too_many_frames_pending)
+        {
+            CurrentFrameSkipped = true;
+            return false;
+        }
+
+        return true;
+    }
+
+    /// Begins a query counting samples that pass the depth test.
+    /// @return The ID of the query.
+    GLuint OverdrawMeter::BeginQuery()
+    {
+        // CREATE ANOTHER QUERY IF THE POOL IS EMPTY.
+        bool free_query_exists = !FreeQueryIds.empty();
+        if (!free_query_exists)
+        {
+            GLuint new_query_id = INVALID_ID;
+            glGenQueries(1, &new_query_id);
+            QueryIds.push_back(new_query_id);
+            FreeQueryIds.push_back(new_query_id);
+        }
+
+        // BEGIN THE QUERY.
+        GLuint query_id = FreeQueryIds.back();
+        FreeQueryIds.pop_back();
+        glBeginQuery(GL_SAMPLES_PASSED, query_id);
+        return query_id;
+    }
+
+    /// Reads the result of a query whose result is known to be available.
+    /// @param[in]  query_id - The ID of the query.
+    /// @return The number of samples counted by the query.
+    uint64_t OverdrawMeter::ReadQueryResult(const GLuint query_id)
+    {
+        GLuint64 sample_count = 0;
+        glGetQueryObjectui64v(query_id, GL_QUERY_RESULT, &sample_count);
+        return static_cast<uint64_t>(sample_count);
+    }
+}
+}
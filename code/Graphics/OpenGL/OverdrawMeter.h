@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <vector>
+#include "Graphics/OpenGL/OpenGL.h"
+
+namespace GRAPHICS
+{
+namespace OPEN_GL
+{
+    /// Measures overdraw by counting the samples that pass the depth test (via GL_SAMPLES_PASSED
+    /// queries) in the depth pre-pass and color pass of each frame.  Since fragments that fail the
+    /// depth test are normally rejected before being shaded, samples passing in the color pass
+    /// approximate the number of fragments shaded, and dividing by the number of pixels on the
+    /// screen gives the average number of times each pixel was shaded.
+    ///
+    /// As with GpuTimer, results are only read once they're reported as available, so measurements
+    /// arrive a few frames late but never stall the CPU.
+    ///
+    /// Requires OpenGL 3.3 (or ARB_timer_query for 64-bit results).
+    class OverdrawMeter
+    {
+    public:
+        // CONSTANTS.
+        /// The maximum number of frames that may be waiting for results.  Frames beyond
+        /// this are simply not measured so that the number of queries stays bounded.
+        static const unsigned int MAX_PENDING_FRAME_COUNT = 8;
+
+        // PUBLIC TYPES.
+        /// The overdraw measured for a single frame.
+        struct FrameOverdraw
+        {
+            /// True if the frame had a depth pre-pass; false otherwise.
+            bool DepthPrePassUsed = false;
+            /// The number of samples that passed the depth test in the depth pre-pass.
+            uint64_t DepthPrePassSampleCount = 0;
+            /// The number of samples that passed the depth test in the color pass,
+            /// approximating the number of fragments shaded.
+            uint64_t ColorPassSampleCount = 0;
+            /// The number of pixels on the screen when the frame was drawn.
+            uint64_t ScreenPixelCount = 0;
+
+            // METHODS.
+            double ShadedFragmentsPerPixel() const;
+        };
+
+        // CONSTRUCTION.
+        static std::unique_ptr<OverdrawMeter> Create();
+        explicit OverdrawMeter();
+        ~OverdrawMeter();
+
+        // MEASUREMENT.
+        void BeginDepthPrePass();
+        void EndDepthPrePass();
+        void BeginColorPass();
+        void EndColorPass();
+        void EndFrame();
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The overdraw of the most recent frame whose results have arrived.
+        FrameOverdraw LatestFrameOverdraw;
+        /// The number of frames with passes that weren't measured because too many
+        /// earlier frames were still waiting for results.
+        unsigned int SkippedFrameCount;
+
+    private:
+        // PRIVATE TYPES.
+        /// The queries for a frame that has been measured but whose results may not have arrived.
+        struct PendingFrame
+        {
+            /// The query for the depth pre-pass.  Invalid if the frame had no depth pre-pass.
+            GLuint DepthPrePassQueryId = INVALID_ID;
+            /// The query for the color pass.  Invalid if the frame had no color pass.
+            GLuint ColorPassQueryId = INVALID_ID;
+            /// The number of pixels on the screen during the color pass.
+            uint64_t ScreenPixelCount = 0;
+        };
+
+        // HELPER METHODS.
+        bool CurrentFrameMeasurable();
+        GLuint BeginQuery();
+        uint64_t ReadQueryResult(const GLuint query_id);
+
+        // MEMBER VARIABLES.
+        /// All query objects created, for deleting them.
+        std::vector<GLuint> QueryIds;
+        /// The queries for the frame currently being drawn.
+        PendingFrame CurrentFrame;
+        /// True if the frame currently being drawn was skipped because too many frames are pending.
+        bool CurrentFrameSkipped;
+        /// Earlier frames waiting for results, from oldest to newest.
+        std::deque<PendingFrame> PendingFrames;
+        /// Query objects that aren't currently in use.
+        std::vector<GLuint> FreeQueryIds;
+    };
+}
+}
@@ -0,0 +1,71 @@
+#include "Graphics/OpenGL/PipelineState.h"
+
+namespace GRAPHICS
+{
+namespace OPEN_GL
+{
+    /// Equality operator.
+    /// @param[in]  rhs - The description to compare with.
+    /// @return True if this description and the provided description are equal; false otherwise.
+    bool PipelineStateDescription::operator==(const PipelineStateDescription& rhs) const
+    {
+        // Make sure all fields are equal.
+        if (ShaderProgram != rhs.ShaderProgram) return false;
+        if (Blend != rhs.Blend) return false;
+        if (ColorWriteEnabled != rhs.ColorWriteEnabled) return false;
+        if (DepthTestEnabled != rhs.DepthTestEnabled) return false;
+        if (DepthWriteEnabled != rhs.DepthWriteEnabled) return false;
+        if (DepthComparison != rhs.DepthComparison) return false;
+        if (Cull != rhs.Cull) return false;
+
+        // All fields were equal.
+        return true;
+    }
+
+    /// Inequality operator.
+    /// @param[in]  rhs - The description to compare with.
+    /// @return True if this description and the provided description aren't equal; false otherwise.
+    bool PipelineStateDescription::operator!=(const PipelineStateDescription& rhs) const
+    {
+        bool descriptions_equal = ((*this) == rhs);
+        return !descriptions_equal;
+    }
+
+    /// Computes a hash of the description (using 64-bit FNV-1a), such that equal
+    /// descriptions always have equal hashes.
+    /// @return The hash of the description.
+    uint64_t PipelineStateDescription::Hash() const
+    {
+        const uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+        const uint64_t FNV_PRIME = 1099511628211ULL;
+
+        // HASH EACH FIELD ONE BYTE AT A TIME.
+        uint64_t hash = FNV_OFFSET_BASIS;
+        auto hash_field = [&hash](const uint64_t field_value)
+        {
+            const unsigned int BITS_PER_BYTE = 8;
+            for (unsigned int byte_index = 0; byte_index < sizeof(field_value); ++byte_index)
+            {
+                uint8_t field_byte = static_cast<uint8_t>(field_value >> (byte_index * BITS_PER_BYTE));
+                hash ^= field_byte;
+                hash *= FNV_PRIME;
+            }
+        };
+        hash_field(reinterpret_cast<uintptr_t>(ShaderProgram));
+        hash_field(static_cast<uint64_t>(Blend));
+        hash_field(static_cast<uint64_t>(ColorWriteEnabled));
+        hash_field(static_cast<uint64_t>(DepthTestEnabled));
+        hash_field(static_cast<uint64_t>(DepthWriteEnabled));
+        hash_field(static_cast<uint64_t>(DepthComparison));
+        hash_field(static_cast<uint64_t>(Cull));
+        return hash;
+    }
+
+    /// Constructor.
+    /// @param[in]  description - The state to be set by the pipeline state.
+    PipelineState::PipelineState(const PipelineStateDescription& description) :
+        Description(description),
+        Hash(description.Hash())
+    {}
+}
+}
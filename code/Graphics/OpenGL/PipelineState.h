@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstdint>
+#include "Graphics/OpenGL/OpenGL.h"
+#include "Graphics/OpenGL/Shaders/ShaderProgram.h"
+
+namespace GRAPHICS
+{
+namespace OPEN_GL
+{
+    /// The ways that colors output from fragment shaders can be combined with colors already being rendered.
+    enum class BlendMode
+    {
+        /// Output colors replace existing colors.
+        DISABLED = 0,
+        /// Output colors are blended with existing colors based on the alpha of the output colors.
+        ALPHA,
+        /// Output colors (scaled by their alpha) are added to existing colors.
+        ADDITIVE
+    };
+
+    /// The faces of triangles that get culled (not rendered).
+    enum class CullMode
+    {
+        /// No triangles are culled.
+        DISABLED = 0,
+        /// Triangles facing away from the camera are culled.
+        BACK_FACES,
+        /// Triangles facing toward the camera are culled.
+        FRONT_FACES
+    };
+
+    /// A description of all of the state of the graphics device's rendering pipeline
+    /// that affects how vertices get drawn.  Defaults match OpenGL's initial state.
+    struct PipelineStateDescription
+    {
+        // OPERATORS.
+        bool operator==(const PipelineStateDescription& rhs) const;
+        bool operator!=(const PipelineStateDescription& rhs) const;
+
+        // HASHING.
+        uint64_t Hash() const;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The shader program for drawing.  This also determines the vertex layout since
+        /// the formats of vertex inputs are held in the shader program's vertex array.
+        /// Null if no shader program should be set.
+        const SHADERS::ShaderProgram* ShaderProgram = nullptr;
+        /// How output colors are combined with existing colors.
+        BlendMode Blend = BlendMode::DISABLED;
+        /// True if output colors are written to the color buffer; false if only depth is written
+        /// (for example, when testing visibility or laying down depth before shading).
+        bool ColorWriteEnabled = true;
+        /// True if fragments are tested against the depth buffer; false otherwise.
+        bool DepthTestEnabled = false;
+        /// True if the depths of fragments are written to the depth buffer; false otherwise.
+        bool DepthWriteEnabled = true;
+        /// The comparison used for the depth test (for example, GL_LESS).
+        GLenum DepthComparison = GL_LESS;
+        /// The faces of triangles that get culled.
+        CullMode Cull = CullMode::DISABLED;
+    };
+
+    /// An immutable bundle of pipeline state that can be applied to the graphics device
+    /// all at once.  Pipeline states are created by the graphics device, which shares a single
+    /// pipeline state between all identical descriptions, so pipeline states can be
+    /// compared by address to determine if any state would change.
+    class PipelineState
+    {
+    public:
+        // CONSTRUCTION.
+        explicit PipelineState(const PipelineStateDescription& description);
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The state set by this pipeline state.
+        const PipelineStateDescription Description;
+        /// The hash of the description.
+        const uint64_t Hash;
+    };
+}
+}
@@ -1,4 +1,6 @@
+#include <algorithm>
 #include "ErrorHandling/NullChecking.h"
+#include "Graphics/OpenGL/GpuTimer.h"
 #include "Graphics/OpenGL/Renderer.h"
 #include "Graphics/OpenGL/Shaders/PredefinedShaders.h"
 
@@ -19,43 +21,101 @@ namespace OPEN_GL
             return nullptr;
         }
 
-        // CREATE THE DEFAULT SHADER PROGRAMS.
-        std::shared_ptr<SHADERS::ShaderProgram> position_color_shader_program = graphics_device->CreateShaderProgram(
-            SHADERS::VERTEX_POSITION_COLOR_SHADER_DESCRIPTION);
-        bool shader_program_created = (nullptr != position_color_shader_program);
+        // CREATE THE RENDERER.
+        // Only the default shader program is compiled up front.  Other shader programs are
+        // compiled once first needed, and objects needing them are drawn normally until then.
+        std::unique_ptr<Renderer> renderer = std::make_unique<Renderer>(graphics_device);
+        bool shader_program_created = (nullptr != renderer->PositionColorShaderProgram);
         if (!shader_program_created)
         {
             // A renderer cannot be creted without this shader program.
             return nullptr;
         }
-
-        // CREATE THE RENDERER.
-        std::unique_ptr<Renderer> renderer = std::make_unique<Renderer>(
-            graphics_device,
-            position_color_shader_program);
         return renderer;
     }
 
-    /// Constructor.
+    /// Constructor.  Starts compiling the default shader program.
     /// @param[in]  graphics_device - The graphics device to use for rendering.
-    /// @param[in]  position_color_shader_program - The shader program for rendering
-    ///     objects with position and color vertex attributes.
-    /// @throws std::exception - Thrown if a parameter is null.
-    Renderer::Renderer(
-        const std::shared_ptr<OPEN_GL::GraphicsDevice>& graphics_device,
-        const std::shared_ptr<SHADERS::ShaderProgram>& position_color_shader_program) :
+    /// @throws std::exception - Thrown if the graphics device is null.
+    Renderer::Renderer(const std::shared_ptr<OPEN_GL::GraphicsDevice>& graphics_device) :
     GraphicsDevice(graphics_device),
-    PositionColorShaderProgram(position_color_shader_program),
+    PositionColorShaderProgram(),
+    InstancedRenderingSupported((nullptr != glDrawArraysInstanced) && (nullptr != glVertexAttribDivisor)),
+    PositionColorInstancedShaderProgram(),
+    PositionColorPipelineState(),
+    PositionColorInstancedPipelineState(),
     VertexBuffers(),
-    Camera()
+    StreamingVertexBuffers(),
+    InstancedMeshes(),
+    InstancedMeshVertices(),
+    InstancedMeshVertexBuffer(),
+    InstancedMeshVertexBufferOutdated(false),
+    InstancedMeshVertexBufferCapacity(0),
+    UploadedInstancedMeshVertexCount(0),
+    InstanceDataBuffer(),
+    InstanceDrawCommandBuffer(),
+    StaticMeshBatches(),
+    Unorm16PositionColorShaderProgram(),
+    HalfFloatPositionColorShaderProgram(),
+    Unorm16PositionColorPipelineState(),
+    HalfFloatPositionColorPipelineState(),
+    QuantizedMeshBuffers(),
+    DepthOnlyShaderProgram(),
+    DepthOnlyPipelineState(),
+    EqualDepthPipelineState(),
+    PositionOnlyMeshBuffers(),
+    OpaqueObjects(),
+    OccludableObjects(),
+    OccluderPipelineState(),
+    BoundingBoxQueryPipelineState(),
+    UnitCubeVertexBuffer(),
+    GpuCulledObjects(),
+    GpuCulledObjectsOutdated(false),
+    Camera(),
+    ShaderProgramVariants(graphics_device),
+    ResourceManager(graphics_device),
+    MultiDrawIndirectEnabled(true),
+    DepthPrePassEnabled(false),
+    OverdrawMeter(OPEN_GL::OverdrawMeter::Create()),
+    OcclusionCuller(OPEN_GL::OcclusionCuller::Create()),
+    GpuCuller()
     {
         // MAKE SURE REQUIRED PARAMETERS WERE PROVIDED.
         ERROR_HANDLING::ThrowInvalidArgumentExceptionIfNull(
             GraphicsDevice,
             "Graphics device cannot be null for renderer.");
-        ERROR_HANDLING::ThrowInvalidArgumentExceptionIfNull(
-            PositionColorShaderProgram,
-            "Position-color shader program cannot be null for renderer.");
+
+        // START CREATING THE DEFAULT SHADER PROGRAM.
+        PositionColorShaderProgram = ShaderProgramVariants.Get(SHADERS::POSITION_COLOR_SHADER_DESCRIPTION, 0);
+        PositionColorPipelineState = CreatePipelineState(PositionColorShaderProgram);
+
+        // CREATE THE GPU CULLER IF ITS OBJECTS CAN BE DRAWN.
+        // Objects culled on the GPU are drawn with the instanced shader program.
+        if (InstancedRenderingSupported)
+        {
+            GpuCuller = OPEN_GL::GpuCuller::Create();
+        }
+
+        // CREATE THE PIPELINE STATES FOR OCCLUSION CULLING.
+        PipelineStateDescription occluder_pipeline_state_description;
+        occluder_pipeline_state_description.ShaderProgram = PositionColorShaderProgram.get();
+        occluder_pipeline_state_description.DepthTestEnabled = true;
+        OccluderPipelineState = GraphicsDevice->CreatePipelineState(occluder_pipeline_state_description);
+
+        // Bounding boxes only need to be tested against depth, and they pass if they're at the same depth as
+        // existing fragments so that boxes of objects lying against visible surfaces are conservatively visible.
+        PipelineStateDescription bounding_box_query_pipeline_state_description = occluder_pipeline_state_description;
+        bounding_box_query_pipeline_state_description.ColorWriteEnabled = false;
+        bounding_box_query_pipeline_state_description.DepthWriteEnabled = false;
+        bounding_box_query_pipeline_state_description.DepthComparison = GL_LEQUAL;
+        BoundingBoxQueryPipelineState = GraphicsDevice->CreatePipelineState(bounding_box_query_pipeline_state_description);
+
+        // CREATE THE PIPELINE STATE FOR COLOR PASSES AFTER DEPTH PRE-PASSES.
+        // The depth buffer already holds the nearest depths, so writing depth again is unnecessary.
+        PipelineStateDescription equal_depth_pipeline_state_description = occluder_pipeline_state_description;
+        equal_depth_pipeline_state_description.DepthWriteEnabled = false;
+        equal_depth_pipeline_state_description.DepthComparison = GL_EQUAL;
+        EqualDepthPipelineState = GraphicsDevice->CreatePipelineState(equal_depth_pipeline_state_description);
     }
 
     /// Clears the screen to the specified color.
@@ -70,57 +130,1253 @@ namespace OPEN_GL
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
     }
 
-    /// Draws a 3D object.
+    /// Draws a 3D object.  Any changes to the object's vertices since it was last drawn
+    /// are uploaded, with only the changed ranges of vertices (as recorded in the
+    /// object's VertexChanges) being uploaded.
     /// @param[in]  object_3D - The 3D object to draw.
     void Renderer::Draw(const GRAPHICS::Object3D& object_3D)
     {
-        // CHECK IF A VERTEX BUFFER ALREADY EXISTS FOR THIS OBJECT.
-        auto previously_allocated_vertex_buffer = VertexBuffers.find(&object_3D);
-        bool vertex_buffer_already_exists = (VertexBuffers.cend() != previously_allocated_vertex_buffer);
-        if (!vertex_buffer_already_exists)
+        GpuResourceHandle& vertex_buffer_handle = UploadVertices(object_3D);
+        DrawFromVertexBuffer(object_3D, vertex_buffer_handle, *PositionColorPipelineState);
+    }
+
+    /// Makes sure a vertex buffer managed by the resource manager holds an object's current vertices.
+    /// Only ranges of vertices that changed since the object was last drawn are uploaded.
+    /// @param[in]  object_3D - The 3D object whose vertices to upload.
+    /// @return The handle of the vertex buffer holding the object's vertices.
+    GpuResourceHandle& Renderer::UploadVertices(const GRAPHICS::Object3D& object_3D)
+    {
+        // CHECK IF A VERTEX BUFFER STILL EXISTS FOR THIS OBJECT.
+        // The vertex buffer may have been released if the object went unused for long enough.
+        GpuResourceHandle& vertex_buffer_handle = VertexBuffers[&object_3D];
+        bool vertex_buffer_already_exists = ResourceManager.IsValid(vertex_buffer_handle);
+        if (vertex_buffer_already_exists)
+        {
+            // UPDATE ANY OF THE OBJECT'S VERTICES THAT HAVE CHANGED.
+            // Versions are unique across objects, so this also handles a different
+            // object being located at a previously used address.
+            ResourceManager.UpdateVertices(vertex_buffer_handle, object_3D.GetVertices(), object_3D.VertexChanges);
+        }
+        else
         {
             // CREATE NEW VERTEX BUFFER WITH THIS OBJECT'S VERTICES.
-            std::shared_ptr<VertexBuffer> new_vertex_buffer = GraphicsDevice->CreateVertexBuffer();
-            bool vertex_buffer_created = (nullptr != new_vertex_buffer);
-            if (vertex_buffer_created)
+            vertex_buffer_handle = ResourceManager.CreateVertexBuffer(object_3D.GetVertices(), object_3D.VertexChanges.Version);
+        }
+        return vertex_buffer_handle;
+    }
+
+    /// Draws a 3D object using vertices in a vertex buffer managed by the resource manager.
+    /// @param[in]  object_3D - The 3D object being drawn.
+    /// @param[in]  vertex_buffer_handle - The handle of the vertex buffer holding the object's vertices.
+    /// @param[in]  pipeline_state - The pipeline state to draw with.  Must use the position-color shader program.
+    void Renderer::DrawFromVertexBuffer(
+        const GRAPHICS::Object3D& object_3D,
+        const GpuResourceHandle& vertex_buffer_handle,
+        const PipelineState& pipeline_state)
+    {
+        // GET THE VERTEX BUFFER FOR THE OBJECT.
+        // This uploads the vertices if the buffer is not yet resident on the graphics device.
+        // Most objects share a large buffer, so only a range of the buffer holds this object's vertices.
+        VertexBufferRange vertex_buffer_range = ResourceManager.UseVertexBuffer(vertex_buffer_handle);
+        bool vertex_buffer_exists = (nullptr != vertex_buffer_range.Buffer);
+        if (!vertex_buffer_exists)
+        {
+            // The buffer is required for rendering.
+            return;
+        }
+
+        // MAKE SURE THE SHADER PROGRAM HAS FINISHED COMPILING.
+        bool shader_program_ready = GraphicsDevice->IsReady(*PositionColorShaderProgram);
+        if (!shader_program_ready)
+        {
+            return;
+        }
+
+        // SET THE PIPELINE STATE AND VERTEX BUFFER TO BE USED.
+        GraphicsDevice->Apply(pipeline_state);
+        GraphicsDevice->Bind(*vertex_buffer_range.Buffer);
+
+        // DRAW THE 3D OBJECT'S VERTICES.
+        DrawVertices(object_3D, vertex_buffer_range.FirstVertex, vertex_buffer_range.VertexCount);
+    }
+
+    /// Draws a 3D object whose vertices may change every time it is drawn.
+    /// The object's current vertices are streamed to the graphics device on each
+    /// call via a persistently mapped buffer, if supported.  Otherwise, the object
+    /// is drawn from a regular vertex buffer like Draw().  Each object may only be
+    /// drawn this way once per frame since each draw uses up a region of its buffer.
+    /// @param[in]  object_3D - The 3D object to draw.
+    /// @throws std::logic_error - Thrown if the object was already streamed in the current frame.
+    void Renderer::DrawDynamic(const GRAPHICS::Object3D& object_3D)
+    {
+        // MAKE SURE THE OBJECT HAS VERTICES TO DRAW.
+        // Streaming buffers can't be created with no storage.
+        bool object_has_vertices = !object_3D.GetVertices().empty();
+        if (!object_has_vertices)
+        {
+            return;
+        }
+
+        // MAKE SURE A STREAMING VERTEX BUFFER HANDLE EXISTS FOR THIS OBJECT.
+        unsigned int vertex_count = static_cast<unsigned int>(object_3D.GetVertices().size());
+        GpuResourceHandle& streaming_vertex_buffer_handle = StreamingVertexBuffers[&object_3D];
+        bool streaming_vertex_buffer_handle_valid = ResourceManager.IsValid(streaming_vertex_buffer_handle);
+        if (!streaming_vertex_buffer_handle_valid)
+        {
+            streaming_vertex_buffer_handle = ResourceManager.CreateStreamingVertexBuffer(vertex_count);
+        }
+
+        // MAKE SURE THE STREAMING VERTEX BUFFER IS LARGE ENOUGH.
+        StreamingVertexBuffer* streaming_vertex_buffer = ResourceManager.UseStreamingVertexBuffer(streaming_vertex_buffer_handle);
+        bool streaming_vertex_buffer_too_small = (
+            (nullptr != streaming_vertex_buffer) &&
+            (vertex_count > streaming_vertex_buffer->MaxVertexCountPerRegion));
+        if (streaming_vertex_buffer_too_small)
+        {
+            ResourceManager.Destroy(streaming_vertex_buffer_handle);
+            streaming_vertex_buffer_handle = ResourceManager.CreateStreamingVertexBuffer(vertex_count);
+            streaming_vertex_buffer = ResourceManager.UseStreamingVertexBuffer(streaming_vertex_buffer_handle);
+        }
+
+        // FALL BACK TO A REGULAR VERTEX BUFFER IF STREAMING ISN'T POSSIBLE.
+        bool streaming_vertex_buffer_exists = (nullptr != streaming_vertex_buffer);
+        if (!streaming_vertex_buffer_exists)
+        {
+            // Since all changes to an object's vertices are tracked, only the changed ranges get uploaded.
+            Draw(object_3D);
+            return;
+        }
+
+        // MAKE SURE THE SHADER PROGRAM HAS FINISHED COMPILING.
+        // This is checked before writing vertices to avoid using up a region of the buffer.
+        bool shader_program_ready = GraphicsDevice->IsReady(*PositionColorShaderProgram);
+        if (!shader_program_ready)
+        {
+            return;
+        }
+
+        // WRITE THE OBJECT'S CURRENT VERTICES TO THE NEXT REGION OF THE STREAMING BUFFER.
+        uint64_t frame_number = GraphicsDevice->CurrentFrameContext().FrameNumber;
+        streaming_vertex_buffer->Fill(object_3D.GetVertices(), frame_number);
+
+        // DRAW THE VERTICES FROM THE CURRENT REGION.
+        GraphicsDevice->Apply(*PositionColorPipelineState);
+        GraphicsDevice->Bind(*streaming_vertex_buffer);
+        DrawVertices(
+            object_3D,
+            streaming_vertex_buffer->CurrentRegionFirstVertex(),
+            streaming_vertex_buffer->CurrentRegionVertexCount());
+
+        // GUARD THE REGION UNTIL THE GRAPHICS DEVICE FINISHES DRAWING FROM IT.
+        streaming_vertex_buffer->FenceCurrentRegion();
+    }
+
+    /// Draws a 3D object from a quantized copy of its mesh, which takes less than half
+    /// the memory and bandwidth of regular vertices at the cost of some precision.
+    /// The quantized copy is created the first time the object's mesh is drawn this
+    /// way and is shared by all objects with the same mesh.  This is best suited for
+    /// large meshes that rarely change since the entire mesh is re-quantized on changes.
+    /// @param[in]  object_3D - The 3D object to draw.
+    /// @param[in]  position_format - The format in which to encode vertex positions.
+    void Renderer::DrawQuantized(const GRAPHICS::Object3D& object_3D, const GRAPHICS::QuantizedPositionFormat position_format)
+    {
+        // MAKE SURE THE OBJECT HAS A MESH TO DRAW.
+        const std::shared_ptr<const GRAPHICS::Mesh>& mesh = object_3D.GetMesh();
+        bool mesh_exists = (nullptr != mesh);
+        if (!mesh_exists)
+        {
+            return;
+        }
+
+        // START CREATING THE SHADER PROGRAM FOR THE POSITION FORMAT IF IT'S THE FIRST TIME IT'S NEEDED.
+        bool unorm16_positions = (GRAPHICS::QuantizedPositionFormat::UNORM16 == position_format);
+        std::shared_ptr<SHADERS::ShaderProgram>& shader_program = unorm16_positions ?
+            Unorm16PositionColorShaderProgram :
+            HalfFloatPositionColorShaderProgram;
+        std::shared_ptr<const PipelineState>& pipeline_state = unorm16_positions ?
+            Unorm16PositionColorPipelineState :
+            HalfFloatPositionColorPipelineState;
+        bool shader_program_requested = (nullptr != shader_program);
+        if (!shader_program_requested)
+        {
+            const SHADERS::VertexLayout& vertex_layout = unorm16_positions ?
+                SHADERS::UNORM16_POSITION_COLOR_VERTEX_LAYOUT :
+                SHADERS::HALF_FLOAT_POSITION_COLOR_VERTEX_LAYOUT;
+            shader_program = ShaderProgramVariants.Get(
+                SHADERS::POSITION_COLOR_SHADER_DESCRIPTION,
+                SHADERS::QUANTIZED_POSITIONS_FEATURE_BIT,
+                &vertex_layout);
+            pipeline_state = CreatePipelineState(shader_program);
+        }
+
+        // FALL BACK TO DRAWING THE OBJECT NORMALLY IF QUANTIZED VERTICES AREN'T SUPPORTED.
+        // This also covers the shader program still compiling.
+        bool shader_program_ready = (
+            (nullptr != shader_program) &&
+            (nullptr != pipeline_state) &&
+            GraphicsDevice->IsReady(*shader_program));
+        if (!shader_program_ready)
+        {
+            Draw(object_3D);
+            return;
+        }
+
+        // QUANTIZE THE MESH IF IT HASN'T ALREADY BEEN QUANTIZED IN ITS CURRENT STATE AND THE REQUESTED FORMAT.
+        QuantizedMeshBuffer& quantized_mesh_buffer = QuantizedMeshBuffers[mesh.get()];
+        bool quantized_mesh_buffer_current = (
+            (quantized_mesh_buffer.SourceMesh.lock() == mesh) &&
+            (quantized_mesh_buffer.SourceMeshVersion == mesh->Version) &&
+            (position_format == quantized_mesh_buffer.PositionFormat));
+        if (!quantized_mesh_buffer_current)
+        {
+            // MAKE SURE A VERTEX BUFFER EXISTS FOR THE QUANTIZED VERTICES.
+            bool vertex_buffer_exists = (nullptr != quantized_mesh_buffer.Buffer);
+            if (!vertex_buffer_exists)
             {
-                // FILL THE BUFFER WITH THIS OBJECT'S VERTICES.
-                new_vertex_buffer->Fill(object_3D.Vertices);
+                quantized_mesh_buffer.Buffer = GraphicsDevice->CreateVertexBuffer();
+                vertex_buffer_exists = (nullptr != quantized_mesh_buffer.Buffer);
+                if (!vertex_buffer_exists)
+                {
+                    QuantizedMeshBuffers.erase(mesh.get());
+                    Draw(object_3D);
+                    return;
+                }
+            }
+
+            // FILL THE VERTEX BUFFER WITH THE QUANTIZED VERTICES.
+            GRAPHICS::QuantizedMesh quantized_mesh = GRAPHICS::QuantizedMesh::Encode(mesh->Vertices, position_format);
+            quantized_mesh_buffer.Buffer->Fill(quantized_mesh.Vertices);
+            quantized_mesh_buffer.SourceMesh = mesh;
+            quantized_mesh_buffer.SourceMeshVersion = mesh->Version;
+            quantized_mesh_buffer.PositionFormat = position_format;
+            quantized_mesh_buffer.DequantizationTransform = quantized_mesh.DequantizationTransform;
+            quantized_mesh_buffer.VertexCount = static_cast<GLsizei>(quantized_mesh.Vertices.size());
+        }
+
+        quantized_mesh_buffer.LastUsedFrameNumber = GraphicsDevice->CurrentFrameContext().FrameNumber;
+
+        // SET THE PIPELINE STATE AND THE QUANTIZED VERTICES TO BE USED.
+        GraphicsDevice->Apply(*pipeline_state);
+        GraphicsDevice->Bind(*quantized_mesh_buffer.Buffer);
+
+        // SET THE TRANSFORMATION MATRICES.
+        shader_program->SetUniformMatrix("dequantization_transform", quantized_mesh_buffer.DequantizationTransform);
+        MATH::Matrix4x4f world_transform = object_3D.WorldTransform();
+        shader_program->SetUniformMatrix("world_transform", world_transform);
+        SetCameraTransforms(*shader_program);
 
-                // STORE THE VERTEX BUFFER FOR THIS 3D OBJECT.
-                VertexBuffers[&object_3D] = new_vertex_buffer;
+        // DRAW THE QUANTIZED VERTICES.
+        const GLint FIRST_VERTEX = 0;
+        glDrawArrays(GL_TRIANGLES, FIRST_VERTEX, quantized_mesh_buffer.VertexCount);
+    }
+
+    /// Queues a 3D object to be drawn via instanced rendering.  All queued objects
+    /// with identical vertices are grouped together as instances of a single mesh,
+    /// and instances of all meshes are drawn together when DrawQueuedInstances()
+    /// is called (which DisplayScreen() does automatically).  If instanced rendering
+    /// isn't supported, the object is immediately drawn individually.
+    /// @param[in]  object_3D - The 3D object to draw.  Only its vertices and current world
+    ///     transform are used, so the object may be modified after this call.
+    /// @param[in]  instance_color - The color to multiply with the colors of the object's vertices.
+    void Renderer::DrawInstanced(const GRAPHICS::Object3D& object_3D, const GRAPHICS::Color& instance_color)
+    {
+        // FALL BACK TO DRAWING THE OBJECT INDIVIDUALLY IF INSTANCING ISN'T SUPPORTED.
+        // This also covers the instanced shader program still compiling.
+        bool instanced_rendering_supported = InstancedShaderProgramReady();
+        if (!instanced_rendering_supported)
+        {
+            Draw(object_3D);
+            return;
+        }
+
+        // QUEUE THE INSTANCE'S WORLD TRANSFORM.
+        // It is stored in row-major order to match the layout expected by the shader.
+        InstancedMesh& instanced_mesh = FindOrAddInstancedMesh(object_3D);
+        MATH::Matrix4x4f world_transform = object_3D.WorldTransform();
+        const float* world_transform_elements = world_transform.ElementsInRowMajorOrder();
+        const unsigned int MATRIX_ELEMENT_COUNT = MATH::Matrix4x4f::ROW_COUNT * MATH::Matrix4x4f::COLUMN_COUNT;
+        instanced_mesh.QueuedInstanceData.insert(
+            instanced_mesh.QueuedInstanceData.end(),
+            world_transform_elements,
+            world_transform_elements + MATRIX_ELEMENT_COUNT);
+
+        // QUEUE THE INSTANCE'S COLOR.
+        instanced_mesh.QueuedInstanceData.push_back(instance_color.Red);
+        instanced_mesh.QueuedInstanceData.push_back(instance_color.Green);
+        instanced_mesh.QueuedInstanceData.push_back(instance_color.Blue);
+        instanced_mesh.QueuedInstanceData.push_back(instance_color.Alpha);
+    }
+
+    /// Finds the instanced mesh with the same vertices as an object, adding a new
+    /// instanced mesh for the object's vertices if none exists.
+    /// @param[in]  object_3D - The object whose instanced mesh to find.
+    /// @return The instanced mesh for the object's vertices.  Only valid until more
+    ///     instanced meshes are added.
+    Renderer::InstancedMesh& Renderer::FindOrAddInstancedMesh(const GRAPHICS::Object3D& object_3D)
+    {
+        // FIND ANY EXISTING INSTANCED MESH WITH THE SAME VERTICES AS THIS OBJECT.
+        // A linear search is used since the number of unique meshes is expected to be small.
+        InstancedMesh* instanced_mesh = nullptr;
+        const std::shared_ptr<const GRAPHICS::Mesh>& object_mesh = object_3D.GetMesh();
+        GLuint object_vertex_count = static_cast<GLuint>(object_3D.GetVertices().size());
+        for (auto& existing_instanced_mesh : InstancedMeshes)
+        {
+            // Objects sharing the mesh the instanced mesh was created from can skip comparing vertices,
+            // provided the mesh hasn't been changed in place since its vertices were copied.
+            bool object_shares_source_mesh = (nullptr != object_mesh) && (existing_instanced_mesh.SourceMesh.lock() == object_mesh);
+            if (object_shares_source_mesh)
+            {
+                bool source_mesh_unchanged = (existing_instanced_mesh.SourceMeshVersion == object_mesh->Version);
+                if (source_mesh_unchanged)
+                {
+                    instanced_mesh = &existing_instanced_mesh;
+                    break;
+                }
+
+                // The instanced mesh's old vertices stay valid for any other objects with the same vertices,
+                // so the changed mesh is compared like any other (and appended as a new instanced mesh if needed).
+                existing_instanced_mesh.SourceMesh.reset();
+            }
+
+            bool vertex_counts_match = (existing_instanced_mesh.VertexCount == object_vertex_count);
+            if (!vertex_counts_match)
+            {
+                continue;
+            }
+
+            auto existing_instanced_mesh_vertices = InstancedMeshVertices.cbegin() + existing_instanced_mesh.FirstVertex;
+            bool mesh_matches_object = std::equal(
+                object_3D.GetVertices().cbegin(),
+                object_3D.GetVertices().cend(),
+                existing_instanced_mesh_vertices);
+            if (mesh_matches_object)
+            {
+                instanced_mesh = &existing_instanced_mesh;
+                break;
             }
         }
-        
-        // GET THE VERTEX BUFFER FOR THE OBJECT.
-        std::shared_ptr<VertexBuffer> vertex_buffer = VertexBuffers[&object_3D];
-        bool vertex_buffer_exists = (nullptr != vertex_buffer);
+
+        // CREATE A NEW INSTANCED MESH IF NEEDED.
+        bool instanced_mesh_exists = (nullptr != instanced_mesh);
+        if (!instanced_mesh_exists)
+        {
+            // ADD THE MESH'S VERTICES AFTER ALL OTHER INSTANCED MESH VERTICES.
+            // Only the new vertices will be uploaded to the vertex buffer before drawing.
+            InstancedMesh new_instanced_mesh;
+            new_instanced_mesh.FirstVertex = static_cast<GLuint>(InstancedMeshVertices.size());
+            new_instanced_mesh.VertexCount = object_vertex_count;
+            new_instanced_mesh.SourceMesh = object_mesh;
+            new_instanced_mesh.SourceMeshVersion = (nullptr != object_mesh) ? object_mesh->Version : 0;
+            InstancedMeshVertices.insert(InstancedMeshVertices.end(), object_3D.GetVertices().cbegin(), object_3D.GetVertices().cend());
+
+            // STORE THE NEW INSTANCED MESH.
+            InstancedMeshes.push_back(new_instanced_mesh);
+            instanced_mesh = &InstancedMeshes.back();
+        }
+
+        instanced_mesh->LastUsedFrameNumber = GraphicsDevice->CurrentFrameContext().FrameNumber;
+        return *instanced_mesh;
+    }
+
+    /// Draws all objects queued via DrawInstanced().  If multi-draw indirect rendering
+    /// is supported, instances of all meshes are drawn with a single call.  Otherwise,
+    /// one instanced draw call is made per unique mesh.
+    void Renderer::DrawQueuedInstances()
+    {
+        GpuTimerScope gpu_timer_scope(GraphicsDevice->GpuTimer.get(), "Instances");
+
+        // MAKE SURE THE INSTANCED SHADER PROGRAM EXISTS.
+        // It's only created once instanced rendering is first used.
+        bool instanced_shader_program_exists = (nullptr != PositionColorInstancedShaderProgram);
+        if (!instanced_shader_program_exists)
+        {
+            // Any objects would have already been drawn individually.
+            return;
+        }
+
+        // GATHER THE INSTANCE DATA AND A DRAW COMMAND FOR EACH MESH WITH QUEUED INSTANCES.
+        // Instance data for all meshes is placed in a single buffer, with each draw command
+        // referencing its mesh's instances via the base instance.
+        std::vector<float> instance_data;
+        std::vector<DrawArraysIndirectCommand> draw_commands;
+        for (auto& instanced_mesh : InstancedMeshes)
+        {
+            // SKIP MESHES WITHOUT ANY INSTANCES TO DRAW.
+            bool instances_queued = !instanced_mesh.QueuedInstanceData.empty();
+            if (!instances_queued)
+            {
+                continue;
+            }
+
+            // CREATE THE DRAW COMMAND FOR THE MESH.
+            DrawArraysIndirectCommand draw_command;
+            draw_command.VertexCount = instanced_mesh.VertexCount;
+            draw_command.InstanceCount = static_cast<GLuint>(instanced_mesh.QueuedInstanceData.size() / SHADERS::INSTANCE_FLOAT_COUNT);
+            draw_command.FirstVertex = instanced_mesh.FirstVertex;
+            draw_command.BaseInstance = static_cast<GLuint>(instance_data.size() / SHADERS::INSTANCE_FLOAT_COUNT);
+            draw_commands.push_back(draw_command);
+
+            // MOVE THE MESH'S INSTANCE DATA INTO THE COMBINED INSTANCE DATA.
+            instance_data.insert(
+                instance_data.end(),
+                instanced_mesh.QueuedInstanceData.cbegin(),
+                instanced_mesh.QueuedInstanceData.cend());
+            instanced_mesh.QueuedInstanceData.clear();
+        }
+
+        // CHECK IF ANY INSTANCES NEED TO BE DRAWN.
+        bool instances_exist = !draw_commands.empty();
+        if (!instances_exist)
+        {
+            return;
+        }
+
+        // MAKE SURE THE BUFFERS FOR INSTANCED RENDERING EXIST.
+        bool instanced_mesh_vertex_buffer_updated = UpdateInstancedMeshVertexBuffer();
+        bool instance_data_buffer_exists = (nullptr != InstanceDataBuffer);
+        if (!instance_data_buffer_exists)
+        {
+            InstanceDataBuffer = GraphicsDevice->CreateInstanceBuffer();
+        }
+        bool instanced_buffers_exist = instanced_mesh_vertex_buffer_updated && (nullptr != InstanceDataBuffer);
+        if (!instanced_buffers_exist)
+        {
+            // The buffers are required for rendering.
+            return;
+        }
+
+        // SET THE PIPELINE STATE AND THE MESH VERTICES TO BE USED.
+        GraphicsDevice->Apply(*PositionColorInstancedPipelineState);
+        GraphicsDevice->Bind(*InstancedMeshVertexBuffer);
+        SetCameraTransforms(*PositionColorInstancedShaderProgram);
+
+        // UPLOAD THE INSTANCE DATA.
+        InstanceDataBuffer->Fill(instance_data);
+
+        // DRAW ALL MESHES WITH A SINGLE CALL IF POSSIBLE.
+        bool multi_draw_indirect_supported = (MultiDrawIndirectEnabled && (nullptr != glMultiDrawArraysIndirect));
+        if (multi_draw_indirect_supported)
+        {
+            // MAKE SURE A BUFFER EXISTS FOR THE DRAW COMMANDS.
+            bool draw_command_buffer_exists = (nullptr != InstanceDrawCommandBuffer);
+            if (!draw_command_buffer_exists)
+            {
+                InstanceDrawCommandBuffer = GraphicsDevice->CreateIndirectDrawBuffer();
+                draw_command_buffer_exists = (nullptr != InstanceDrawCommandBuffer);
+            }
+
+            if (draw_command_buffer_exists)
+            {
+                // READ INSTANCE INPUTS RELATIVE TO THE START OF THE INSTANCE DATA.
+                // The base instance of each draw command selects the mesh's instances.
+                GraphicsDevice->Bind(*InstanceDataBuffer);
+
+                // DRAW ALL COMMANDS.
+                InstanceDrawCommandBuffer->Fill(draw_commands);
+                GraphicsDevice->Bind(*InstanceDrawCommandBuffer);
+                const void* const DRAW_COMMANDS_AT_START_OF_BUFFER = nullptr;
+                const GLsizei DRAW_COMMANDS_TIGHTLY_PACKED = 0;
+                glMultiDrawArraysIndirect(
+                    GL_TRIANGLES,
+                    DRAW_COMMANDS_AT_START_OF_BUFFER,
+                    static_cast<GLsizei>(draw_commands.size()),
+                    DRAW_COMMANDS_TIGHTLY_PACKED);
+                return;
+            }
+        }
+
+        // FALL BACK TO ONE INSTANCED DRAW CALL PER MESH.
+        // The base instance is emulated by offsetting the instance inputs for each draw.
+        for (const auto& draw_command : draw_commands)
+        {
+            uint64_t first_instance_byte_offset = static_cast<uint64_t>(draw_command.BaseInstance) * PositionColorInstancedShaderProgram->VertexShader.InstanceSizeInBytes;
+            GraphicsDevice->Bind(*InstanceDataBuffer, first_instance_byte_offset);
+
+            glDrawArraysInstanced(
+                GL_TRIANGLES,
+                static_cast<GLint>(draw_command.FirstVertex),
+                static_cast<GLsizei>(draw_command.VertexCount),
+                static_cast<GLsizei>(draw_command.InstanceCount));
+        }
+    }
+
+    /// Makes sure the vertex buffer for instanced meshes exists and holds the vertices of all instanced meshes.
+    /// Normally only the vertices of meshes added since the last update are uploaded.  The whole buffer is
+    /// only refilled if existing vertices moved or if the buffer must grow, in which case its capacity is
+    /// doubled so that adding meshes one at a time only occasionally copies all vertices.
+    /// @return True if the vertex buffer is ready for drawing; false if it couldn't be created.
+    bool Renderer::UpdateInstancedMeshVertexBuffer()
+    {
+        // MAKE SURE THE VERTEX BUFFER EXISTS.
+        bool instanced_mesh_vertex_buffer_exists = (nullptr != InstancedMeshVertexBuffer);
+        if (!instanced_mesh_vertex_buffer_exists)
+        {
+            InstancedMeshVertexBuffer = GraphicsDevice->CreateVertexBuffer();
+            InstancedMeshVertexBufferOutdated = true;
+            instanced_mesh_vertex_buffer_exists = (nullptr != InstancedMeshVertexBuffer);
+            if (!instanced_mesh_vertex_buffer_exists)
+            {
+                return false;
+            }
+        }
+
+        // GROW THE VERTEX BUFFER IF IT'S TOO SMALL.
+        // Reserving new storage discards the existing vertices, so they must all be uploaded again.
+        GLuint instanced_mesh_vertex_count = static_cast<GLuint>(InstancedMeshVertices.size());
+        bool instanced_mesh_vertex_buffer_too_small = (instanced_mesh_vertex_count > InstancedMeshVertexBufferCapacity);
+        if (instanced_mesh_vertex_buffer_too_small)
+        {
+            const GLuint CAPACITY_GROWTH_FACTOR = 2;
+            InstancedMeshVertexBufferCapacity = std::max(instanced_mesh_vertex_count, CAPACITY_GROWTH_FACTOR * InstancedMeshVertexBufferCapacity);
+            InstancedMeshVertexBuffer->Reserve(InstancedMeshVertexBufferCapacity);
+            InstancedMeshVertexBufferOutdated = true;
+        }
+
+        // REFILL THE VERTEX BUFFER IF ITS EXISTING VERTICES ARE OUTDATED.
+        if (InstancedMeshVertexBufferOutdated)
+        {
+            UploadedInstancedMeshVertexCount = 0;
+            InstancedMeshVertexBufferOutdated = false;
+        }
+
+        // UPLOAD THE VERTICES OF ANY NEWLY ADDED MESHES.
+        bool new_vertices_exist = (instanced_mesh_vertex_count > UploadedInstancedMeshVertexCount);
+        if (new_vertices_exist)
+        {
+            InstancedMeshVertexBuffer->FillRange(
+                UploadedInstancedMeshVertexCount,
+                InstancedMeshVertices.data() + UploadedInstancedMeshVertexCount,
+                instanced_mesh_vertex_count - UploadedInstancedMeshVertexCount);
+            UploadedInstancedMeshVertexCount = instanced_mesh_vertex_count;
+        }
+        return true;
+    }
+
+    /// Adds a static 3D object to the objects culled and drawn on the GPU each frame
+    /// (when DrawGpuCulledObjects() is called, which DisplayScreen() does automatically).
+    /// Unlike other drawing methods, objects are only added once rather than every frame,
+    /// so the CPU work per frame doesn't grow with the number of objects.  If GPU culling
+    /// isn't supported, the objects are drawn via DrawInstanced() each frame instead.
+    /// @param[in]  object_3D - The 3D object to add.  It must remain at the same address until
+    ///     objects are cleared.  Since it's assumed to be static, changes to its vertices or
+    ///     transform after it's first drawn are not detected.
+    /// @param[in]  instance_color - The color to multiply with the colors of the object's vertices.
+    void Renderer::AddGpuCulledObject(const GRAPHICS::Object3D& object_3D, const GRAPHICS::Color& instance_color)
+    {
+        // IGNORE OBJECTS WITHOUT ANYTHING TO DRAW.
+        bool object_has_vertices = !object_3D.GetVertices().empty();
+        if (!object_has_vertices)
+        {
+            return;
+        }
+
+        GpuCulledObject gpu_culled_object;
+        gpu_culled_object.Object = &object_3D;
+        gpu_culled_object.InstanceColor = instance_color;
+        GpuCulledObjects.push_back(gpu_culled_object);
+        GpuCulledObjectsOutdated = true;
+    }
+
+    /// Removes all objects added via AddGpuCulledObject().
+    void Renderer::ClearGpuCulledObjects()
+    {
+        for (InstancedMesh& instanced_mesh : InstancedMeshes)
+        {
+            instanced_mesh.UsedByGpuCulledObjects = false;
+        }
+        GpuCulledObjects.clear();
+        GpuCulledObjectsOutdated = true;
+    }
+
+    /// Culls all objects added via AddGpuCulledObject() against the camera's view frustum on the GPU
+    /// and draws the objects that survive with a single multi-draw indirect call.  Objects are only
+    /// uploaded again when objects have been added or cleared.
+    void Renderer::DrawGpuCulledObjects()
+    {
+        // MAKE SURE THERE ARE OBJECTS TO DRAW.
+        bool gpu_culled_objects_exist = !GpuCulledObjects.empty();
+        if (!gpu_culled_objects_exist && !GpuCulledObjectsOutdated)
+        {
+            return;
+        }
+
+        GpuTimerScope gpu_timer_scope(GraphicsDevice->GpuTimer.get(), "GPU culled objects");
+
+        // FALL BACK TO DRAWING OBJECTS AS INSTANCES IF GPU CULLING ISN'T AVAILABLE.
+        // This also covers the instanced shader program still compiling.
+        bool gpu_culling_available = (
+            (nullptr != GpuCuller) &&
+            InstancedShaderProgramReady());
+        if (!gpu_culling_available)
+        {
+            for (const GpuCulledObject& gpu_culled_object : GpuCulledObjects)
+            {
+                DrawInstanced(*gpu_culled_object.Object, gpu_culled_object.InstanceColor);
+            }
+            return;
+        }
+
+        // UPLOAD THE OBJECTS IF THEY'VE CHANGED.
+        if (GpuCulledObjectsOutdated)
+        {
+            std::vector<SHADERS::PositionColorInstance> object_instances;
+            std::vector<OPEN_GL::GpuCuller::CullingObject> culling_objects;
+            object_instances.reserve(GpuCulledObjects.size());
+            culling_objects.reserve(GpuCulledObjects.size());
+            for (const GpuCulledObject& gpu_culled_object : GpuCulledObjects)
+            {
+                // STORE THE OBJECT'S WORLD TRANSFORM AND COLOR.
+                // The transform is stored in row-major order to match the layout expected by the shaders.
+                MATH::Matrix4x4f world_transform = gpu_culled_object.Object->WorldTransform();
+                const float* world_transform_elements = world_transform.ElementsInRowMajorOrder();
+                SHADERS::PositionColorInstance object_instance;
+                const unsigned int ELEMENT_COUNT_PER_ROW = MATH::Matrix4x4f::COLUMN_COUNT;
+                std::copy_n(world_transform_elements, ELEMENT_COUNT_PER_ROW, object_instance.WorldTransformRow0);
+                std::copy_n(world_transform_elements + ELEMENT_COUNT_PER_ROW, ELEMENT_COUNT_PER_ROW, object_instance.WorldTransformRow1);
+                std::copy_n(world_transform_elements + (2 * ELEMENT_COUNT_PER_ROW), ELEMENT_COUNT_PER_ROW, object_instance.WorldTransformRow2);
+                std::copy_n(world_transform_elements + (3 * ELEMENT_COUNT_PER_ROW), ELEMENT_COUNT_PER_ROW, object_instance.WorldTransformRow3);
+                object_instance.Color = gpu_culled_object.InstanceColor;
+                object_instances.push_back(object_instance);
+
+                // STORE THE OBJECT'S BOUNDS AND MESH.
+                InstancedMesh& instanced_mesh = FindOrAddInstancedMesh(*gpu_culled_object.Object);
+                instanced_mesh.UsedByGpuCulledObjects = true;
+                culling_objects.push_back(CreateCullingObject(*gpu_culled_object.Object, instanced_mesh));
+            }
+            GpuCuller->SetObjects(object_instances, culling_objects);
+            GpuCulledObjectsOutdated = false;
+        }
+
+        // MAKE SURE THE MESH VERTICES ARE ON THE GRAPHICS DEVICE.
+        bool instanced_mesh_vertex_buffer_updated = UpdateInstancedMeshVertexBuffer();
+        if (!instanced_mesh_vertex_buffer_updated)
+        {
+            return;
+        }
+
+        // CULL THE OBJECTS ON THE GPU.
+        MATH::Matrix4x4f view_projection_transform = ProjectionTransform() * Camera.ViewTransform();
+        GpuCuller->Cull(*GraphicsDevice, view_projection_transform);
+
+        // DRAW THE OBJECTS THAT SURVIVED CULLING.
+        GraphicsDevice->Apply(*PositionColorInstancedPipelineState);
+        GraphicsDevice->Bind(*InstancedMeshVertexBuffer);
+        SetCameraTransforms(*PositionColorInstancedShaderProgram);
+        GpuCuller->Draw(*GraphicsDevice);
+    }
+
+    /// Creates the data for culling an object on the GPU, including a sphere bounding its mesh.
+    /// The sphere is centered on the center of the mesh's axis-aligned bounds, which is simple
+    /// to compute and usually close to the smallest bounding sphere.
+    /// @param[in]  object_3D - The object to cull.  It must have vertices.
+    /// @param[in]  instanced_mesh - The instanced mesh holding the object's vertices.
+    /// @return The culling data for the object.
+    OPEN_GL::GpuCuller::CullingObject Renderer::CreateCullingObject(
+        const GRAPHICS::Object3D& object_3D,
+        const InstancedMesh& instanced_mesh)
+    {
+        // FIND THE CENTER OF THE MESH'S BOUNDS.
+        const std::vector<GRAPHICS::Vertex>& vertices = object_3D.GetVertices();
+        MATH::Vector3f min_object_position = vertices.front().ObjectSpacePosition;
+        MATH::Vector3f max_object_position = vertices.front().ObjectSpacePosition;
+        for (const GRAPHICS::Vertex& vertex : vertices)
+        {
+            min_object_position.X = std::min(min_object_position.X, vertex.ObjectSpacePosition.X);
+            min_object_position.Y = std::min(min_object_position.Y, vertex.ObjectSpacePosition.Y);
+            min_object_position.Z = std::min(min_object_position.Z, vertex.ObjectSpacePosition.Z);
+            max_object_position.X = std::max(max_object_position.X, vertex.ObjectSpacePosition.X);
+            max_object_position.Y = std::max(max_object_position.Y, vertex.ObjectSpacePosition.Y);
+            max_object_position.Z = std::max(max_object_position.Z, vertex.ObjectSpacePosition.Z);
+        }
+        MATH::Vector3f center_object_position(
+            (min_object_position.X + max_object_position.X) / 2.0f,
+            (min_object_position.Y + max_object_position.Y) / 2.0f,
+            (min_object_position.Z + max_object_position.Z) / 2.0f);
+
+        // EXTEND THE RADIUS TO THE FURTHEST VERTEX.
+        float radius = 0.0f;
+        for (const GRAPHICS::Vertex& vertex : vertices)
+        {
+            float distance_from_center = (vertex.ObjectSpacePosition - center_object_position).Length();
+            radius = std::max(radius, distance_from_center);
+        }
+
+        // CREATE THE CULLING DATA.
+        OPEN_GL::GpuCuller::CullingObject culling_object = {};
+        culling_object.ObjectSpaceBoundingSphere[0] = center_object_position.X;
+        culling_object.ObjectSpaceBoundingSphere[1] = center_object_position.Y;
+        culling_object.ObjectSpaceBoundingSphere[2] = center_object_position.Z;
+        culling_object.ObjectSpaceBoundingSphere[3] = radius;
+        culling_object.FirstVertex = instanced_mesh.FirstVertex;
+        culling_object.VertexCount = instanced_mesh.VertexCount;
+        return culling_object;
+    }
+
+    /// Queues a static 3D object to be drawn as part of a batch.  Small objects submitted
+    /// each frame are merged into a shared vertex buffer (per shader program) and drawn
+    /// together when DrawStaticBatches() is called (which DisplayScreen() does automatically).
+    /// The merged buffer is only rebuilt when the set of submitted objects changes.
+    /// Objects too large for batching are immediately drawn individually.
+    /// @param[in]  object_3D - The 3D object to draw.  It must remain at the same address,
+    ///     and its vertices and transform must not change while it continues to be drawn
+    ///     via this method.
+    void Renderer::DrawStatic(const GRAPHICS::Object3D& object_3D)
+    {
+        // DRAW LARGE OBJECTS INDIVIDUALLY.
+        bool object_can_be_batched = StaticMeshBatch::CanHold(object_3D);
+        if (!object_can_be_batched)
+        {
+            Draw(object_3D);
+            return;
+        }
+
+        // SUBMIT THE OBJECT TO THE BATCH FOR ITS SHADER PROGRAM.
+        const SHADERS::ShaderProgram* shader_program = PositionColorShaderProgram.get();
+        auto static_mesh_batch = StaticMeshBatches.find(shader_program);
+        bool static_mesh_batch_exists = (StaticMeshBatches.end() != static_mesh_batch);
+        if (!static_mesh_batch_exists)
+        {
+            static_mesh_batch = StaticMeshBatches.emplace(shader_program, StaticMeshBatch(PositionColorShaderProgram)).first;
+        }
+        static_mesh_batch->second.Submit(object_3D);
+    }
+
+    /// Draws all static objects queued via DrawStatic(), using one draw call per batch.
+    void Renderer::DrawStaticBatches()
+    {
+        GpuTimerScope gpu_timer_scope(GraphicsDevice->GpuTimer.get(), "Static batches");
+
+        for (auto& shader_program_and_batch : StaticMeshBatches)
+        {
+            // UPDATE THE BATCH FOR THE CURRENTLY SUBMITTED OBJECTS.
+            StaticMeshBatch& static_mesh_batch = shader_program_and_batch.second;
+            bool batch_drawable = static_mesh_batch.Update(*GraphicsDevice);
+            static_mesh_batch.ClearSubmittedObjects();
+            if (!batch_drawable)
+            {
+                continue;
+            }
+
+            // MAKE SURE THE SHADER PROGRAM HAS FINISHED COMPILING.
+            bool shader_program_ready = GraphicsDevice->IsReady(*static_mesh_batch.ShaderProgram);
+            if (!shader_program_ready)
+            {
+                continue;
+            }
+
+            // SET THE PIPELINE STATE AND THE MERGED VERTICES TO BE USED.
+            // Identical descriptions share a pipeline state, so this just finds the existing state.
+            std::shared_ptr<const PipelineState> pipeline_state = CreatePipelineState(static_mesh_batch.ShaderProgram);
+            GraphicsDevice->Apply(*pipeline_state);
+            GraphicsDevice->Bind(*static_mesh_batch.MergedVertexBuffer);
+
+            // SET THE TRANSFORMATION MATRICES.
+            // Vertices are already in world space, so no additional world transform is needed.
+            MATH::Matrix4x4f world_transform = MATH::Matrix4x4f::Identity();
+            static_mesh_batch.ShaderProgram->SetUniformMatrix("world_transform", world_transform);
+            SetCameraTransforms(*static_mesh_batch.ShaderProgram);
+
+            // DRAW ALL OBJECTS IN THE BATCH IN A SINGLE DRAW CALL.
+            const GLint FIRST_VERTEX = 0;
+            glDrawArrays(GL_TRIANGLES, FIRST_VERTEX, static_mesh_batch.MergedVertexCount);
+        }
+    }
+
+    /// Submits an opaque 3D object to be drawn with depth testing once all opaque objects have been
+    /// submitted, via DrawOpaqueObjects() (which DisplayScreen() does automatically).  If DepthPrePassEnabled,
+    /// the objects are first drawn in a depth pre-pass so that each pixel is only shaded once.
+    /// @param[in]  object_3D - The 3D object to draw.  It must remain at the same address and
+    ///     not be modified until opaque objects are drawn.
+    void Renderer::DrawOpaque(const GRAPHICS::Object3D& object_3D)
+    {
+        bool object_has_vertices = !object_3D.GetVertices().empty();
+        if (object_has_vertices)
+        {
+            OpaqueObjects.push_back(&object_3D);
+        }
+    }
+
+    /// Draws all objects submitted via DrawOpaque(), in the order they were submitted.
+    ///
+    /// Without a depth pre-pass, every fragment nearer than those already drawn is shaded, so objects
+    /// drawn from back to front shade each pixel many times.  With a depth pre-pass, objects are first
+    /// drawn with only their positions (12 bytes per vertex rather than the full 28-byte vertex) and
+    /// a minimal shader to fill the depth buffer.  The color pass then only shades fragments whose
+    /// depths exactly equal the nearest depths, so each pixel is shaded once regardless of draw order,
+    /// at the cost of processing all vertices twice.  Overdraw in both modes is measured by the OverdrawMeter.
+    void Renderer::DrawOpaqueObjects()
+    {
+        // MAKE SURE THERE ARE OBJECTS TO DRAW.
+        bool opaque_objects_exist = !OpaqueObjects.empty();
+        if (!opaque_objects_exist)
+        {
+            return;
+        }
+
+        // MAKE SURE THE SHADER PROGRAM HAS FINISHED COMPILING.
+        bool shader_program_ready = GraphicsDevice->IsReady(*PositionColorShaderProgram);
+        if (!shader_program_ready)
+        {
+            OpaqueObjects.clear();
+            return;
+        }
+
+        bool overdraw_measured = (nullptr != OverdrawMeter);
+
+        // START CREATING THE DEPTH-ONLY SHADER PROGRAM IF IT'S THE FIRST TIME IT'S NEEDED.
+        bool depth_only_shader_program_requested = (nullptr != DepthOnlyShaderProgram);
+        bool depth_only_shader_program_needed = (DepthPrePassEnabled && !depth_only_shader_program_requested);
+        if (depth_only_shader_program_needed)
+        {
+            DepthOnlyShaderProgram = ShaderProgramVariants.Get(SHADERS::VERTEX_POSITION_ONLY_SHADER_DESCRIPTION, 0);
+            bool depth_only_shader_program_created = (nullptr != DepthOnlyShaderProgram);
+            if (depth_only_shader_program_created)
+            {
+                PipelineStateDescription depth_only_pipeline_state_description;
+                depth_only_pipeline_state_description.ShaderProgram = DepthOnlyShaderProgram.get();
+                depth_only_pipeline_state_description.ColorWriteEnabled = false;
+                depth_only_pipeline_state_description.DepthTestEnabled = true;
+                DepthOnlyPipelineState = GraphicsDevice->CreatePipelineState(depth_only_pipeline_state_description);
+            }
+        }
+
+        // DRAW THE DEPTH PRE-PASS IF ENABLED.
+        // This also covers the depth-only shader program still compiling.
+        // Objects whose positions couldn't be drawn in the pre-pass are tracked since they
+        // won't have depths in the depth buffer to exactly match in the color pass.
+        bool depth_pre_pass_possible = (
+            DepthPrePassEnabled &&
+            (nullptr != DepthOnlyShaderProgram) &&
+            (nullptr != DepthOnlyPipelineState) &&
+            GraphicsDevice->IsReady(*DepthOnlyShaderProgram));
+        std::vector<bool> depths_pre_drawn(OpaqueObjects.size(), false);
+        if (depth_pre_pass_possible)
+        {
+            GpuTimerScope gpu_timer_scope(GraphicsDevice->GpuTimer.get(), "Depth pre-pass");
+            if (overdraw_measured)
+            {
+                OverdrawMeter->BeginDepthPrePass();
+            }
+
+            GraphicsDevice->Apply(*DepthOnlyPipelineState);
+            SetCameraTransforms(*DepthOnlyShaderProgram);
+            for (std::size_t object_index = 0; object_index < OpaqueObjects.size(); ++object_index)
+            {
+                // DRAW THE OBJECT'S POSITIONS IF THEY COULD BE UPLOADED.
+                const GRAPHICS::Object3D& object_3D = *OpaqueObjects[object_index];
+                const PositionOnlyMeshBuffer* position_only_mesh_buffer = UploadPositions(object_3D);
+                bool positions_uploaded = (nullptr != position_only_mesh_buffer);
+                if (!positions_uploaded)
+                {
+                    continue;
+                }
+
+                GraphicsDevice->Bind(*position_only_mesh_buffer->Buffer);
+                MATH::Matrix4x4f world_transform = object_3D.WorldTransform();
+                DepthOnlyShaderProgram->SetUniformMatrix("world_transform", world_transform);
+                const GLint FIRST_VERTEX = 0;
+                glDrawArrays(GL_TRIANGLES, FIRST_VERTEX, position_only_mesh_buffer->VertexCount);
+                depths_pre_drawn[object_index] = true;
+            }
+
+            if (overdraw_measured)
+            {
+                OverdrawMeter->EndDepthPrePass();
+            }
+        }
+
+        // DRAW THE COLOR PASS.
+        {
+            GpuTimerScope gpu_timer_scope(GraphicsDevice->GpuTimer.get(), "Color pass");
+            if (overdraw_measured)
+            {
+                OverdrawMeter->BeginColorPass();
+            }
+
+            for (std::size_t object_index = 0; object_index < OpaqueObjects.size(); ++object_index)
+            {
+                const GRAPHICS::Object3D& object_3D = *OpaqueObjects[object_index];
+                const std::shared_ptr<const PipelineState>& pipeline_state = depths_pre_drawn[object_index] ?
+                    EqualDepthPipelineState :
+                    OccluderPipelineState;
+                GpuResourceHandle& vertex_buffer_handle = UploadVertices(object_3D);
+                DrawFromVertexBuffer(object_3D, vertex_buffer_handle, *pipeline_state);
+            }
+
+            if (overdraw_measured)
+            {
+                OverdrawMeter->EndColorPass();
+            }
+        }
+
+        // RESTORE DEPTH WRITES.
+        // Otherwise, the state for the color pass could prevent the depth buffer from being cleared.
+        GraphicsDevice->Apply(*OccluderPipelineState);
+
+        OpaqueObjects.clear();
+    }
+
+    /// Makes sure a position-only copy of an object's mesh exists on the graphics device.
+    /// The copy is created the first time the mesh is drawn in a depth pre-pass and is
+    /// shared by all objects with the same mesh.
+    /// @param[in]  object_3D - The 3D object whose positions to upload.
+    /// @return The position-only copy of the object's mesh; null if it couldn't be created.
+    const Renderer::PositionOnlyMeshBuffer* Renderer::UploadPositions(const GRAPHICS::Object3D& object_3D)
+    {
+        // MAKE SURE THE OBJECT HAS A MESH.
+        const std::shared_ptr<const GRAPHICS::Mesh>& mesh = object_3D.GetMesh();
+        bool mesh_exists = (nullptr != mesh);
+        if (!mesh_exists)
+        {
+            return nullptr;
+        }
+
+        // USE ANY EXISTING COPY OF THE MESH IN ITS CURRENT STATE.
+        PositionOnlyMeshBuffer& position_only_mesh_buffer = PositionOnlyMeshBuffers[mesh.get()];
+        position_only_mesh_buffer.LastUsedFrameNumber = GraphicsDevice->CurrentFrameContext().FrameNumber;
+        bool position_only_mesh_buffer_current = (
+            (position_only_mesh_buffer.SourceMesh.lock() == mesh) &&
+            (position_only_mesh_buffer.SourceMeshVersion == mesh->Version));
+        if (position_only_mesh_buffer_current)
+        {
+            return &position_only_mesh_buffer;
+        }
+
+        // MAKE SURE A VERTEX BUFFER EXISTS FOR THE POSITIONS.
+        bool vertex_buffer_exists = (nullptr != position_only_mesh_buffer.Buffer);
         if (!vertex_buffer_exists)
         {
-            // The buffer is required for rendering.
+            position_only_mesh_buffer.Buffer = GraphicsDevice->CreateVertexBuffer();
+            vertex_buffer_exists = (nullptr != position_only_mesh_buffer.Buffer);
+            if (!vertex_buffer_exists)
+            {
+                PositionOnlyMeshBuffers.erase(mesh.get());
+                return nullptr;
+            }
+        }
+
+        // FILL THE VERTEX BUFFER WITH THE POSITIONS.
+        std::vector<MATH::Vector3f> positions;
+        positions.reserve(mesh->Vertices.size());
+        for (const GRAPHICS::Vertex& vertex : mesh->Vertices)
+        {
+            positions.push_back(vertex.ObjectSpacePosition);
+        }
+        position_only_mesh_buffer.Buffer->Fill(positions);
+        position_only_mesh_buffer.SourceMesh = mesh;
+        position_only_mesh_buffer.SourceMeshVersion = mesh->Version;
+        position_only_mesh_buffer.VertexCount = static_cast<GLsizei>(positions.size());
+        return &position_only_mesh_buffer;
+    }
+
+    /// Submits a 3D object to be drawn with occlusion culling, so that it may be skipped if it's
+    /// hidden behind other objects.  Objects are drawn (with depth testing) once all have been
+    /// submitted, via DrawOccludableObjects().  If occlusion culling isn't supported, the object
+    /// is simply drawn immediately.
+    /// @param[in]  object_3D - The 3D object to draw.  It must remain at the same address and
+    ///     not be modified until occludable objects are drawn.
+    void Renderer::DrawOccludable(const GRAPHICS::Object3D& object_3D)
+    {
+        // DRAW THE OBJECT IMMEDIATELY IF OCCLUSION CULLING ISN'T SUPPORTED.
+        bool occlusion_culling_supported = (nullptr != OcclusionCuller);
+        if (!occlusion_culling_supported)
+        {
+            Draw(object_3D);
+            return;
+        }
+
+        // SUBMIT OBJECTS WITH VERTICES FOR DRAWING LATER.
+        bool object_has_vertices = !object_3D.GetVertices().empty();
+        if (object_has_vertices)
+        {
+            OccludableObjects.push_back(&object_3D);
+        }
+    }
+
+    /// Draws all objects submitted via DrawOccludable(), skipping objects hidden behind others.
+    /// Objects visible in the previous frame are drawn first, from front to back, to fill the depth
+    /// buffer.  Objects hidden in the previous frame then have their bounding boxes tested against
+    /// the depth buffer and are drawn conditionally on the results if conditional rendering is
+    /// supported.  See OcclusionCuller for details.
+    void Renderer::DrawOccludableObjects()
+    {
+        // MAKE SURE THERE ARE OBJECTS TO DRAW.
+        bool occludable_objects_exist = !OccludableObjects.empty();
+        if (!occludable_objects_exist)
+        {
             return;
         }
 
-        // SET THE SHADER PROGRAM TO BE USED.
-        GraphicsDevice->Use(*PositionColorShaderProgram);
-   
-        // BIND THE VERTEX ARRAY BUFFER FOR RENDERING.
-        GraphicsDevice->Bind(*vertex_buffer);
+        // MAKE SURE THE SHADER PROGRAM HAS FINISHED COMPILING.
+        bool shader_program_ready = GraphicsDevice->IsReady(*PositionColorShaderProgram);
+        if (!shader_program_ready)
+        {
+            OccludableObjects.clear();
+            return;
+        }
+
+        GpuTimerScope gpu_timer_scope(GraphicsDevice->GpuTimer.get(), "Occludable objects");
+
+        // SORT OBJECTS FROM FRONT TO BACK.
+        // Drawing nearer objects first fills the depth buffer with the most likely occluders early.
+        const MATH::Vector3f camera_world_position = Camera.WorldPosition;
+        std::sort(
+            OccludableObjects.begin(),
+            OccludableObjects.end(),
+            [&camera_world_position](const GRAPHICS::Object3D* lhs, const GRAPHICS::Object3D* rhs)
+            {
+                float lhs_distance_from_camera = (lhs->WorldPosition - camera_world_position).Length();
+                float rhs_distance_from_camera = (rhs->WorldPosition - camera_world_position).Length();
+                return lhs_distance_from_camera < rhs_distance_from_camera;
+            });
+
+        // DRAW OBJECTS THAT WERE VISIBLE IN THE PREVIOUS FRAME.
+        std::vector<const GRAPHICS::Object3D*> previously_hidden_objects;
+        for (const GRAPHICS::Object3D* object_3D : OccludableObjects)
+        {
+            ++OcclusionCuller->CurrentFrameStatistics.SubmittedObjectCount;
+
+            bool object_visible = OcclusionCuller->IsVisible(*object_3D);
+            if (!object_visible)
+            {
+                previously_hidden_objects.push_back(object_3D);
+                continue;
+            }
+
+            // The object's own draw is occasionally queried to detect when it becomes hidden.
+            GpuResourceHandle& vertex_buffer_handle = UploadVertices(*object_3D);
+            bool object_query_begun = OcclusionCuller->BeginObjectQuery(*object_3D);
+            DrawFromVertexBuffer(*object_3D, vertex_buffer_handle, *OccluderPipelineState);
+            if (object_query_begun)
+            {
+                OcclusionCuller->EndQuery();
+            }
+            ++OcclusionCuller->CurrentFrameStatistics.DrawnObjectCount;
+        }
+
+        // TEST OBJECTS THAT WERE HIDDEN IN THE PREVIOUS FRAME AGAINST THE VISIBLE OBJECTS.
+        bool conditional_rendering_supported = OcclusionCuller->ConditionalRenderingSupported();
+        for (const GRAPHICS::Object3D* object_3D : previously_hidden_objects)
+        {
+            // DRAW OBJECTS WHOSE BOUNDING BOXES CONTAIN THE CAMERA.
+            // Such bounding boxes get clipped by the near plane, so they can't be reliably tested.
+            // The margin covers the distance from the camera to the near plane.
+            BoundingBox bounding_box = WorldBoundingBox(*object_3D);
+            const float NEAR_PLANE_DISTANCE_FROM_CAMERA = 0.5f;
+            bool camera_within_bounding_box = (
+                (camera_world_position.X >= bounding_box.MinWorldPosition.X - NEAR_PLANE_DISTANCE_FROM_CAMERA) &&
+                (camera_world_position.X <= bounding_box.MaxWorldPosition.X + NEAR_PLANE_DISTANCE_FROM_CAMERA) &&
+                (camera_world_position.Y >= bounding_box.MinWorldPosition.Y - NEAR_PLANE_DISTANCE_FROM_CAMERA) &&
+                (camera_world_position.Y <= bounding_box.MaxWorldPosition.Y + NEAR_PLANE_DISTANCE_FROM_CAMERA) &&
+                (camera_world_position.Z >= bounding_box.MinWorldPosition.Z - NEAR_PLANE_DISTANCE_FROM_CAMERA) &&
+                (camera_world_position.Z <= bounding_box.MaxWorldPosition.Z + NEAR_PLANE_DISTANCE_FROM_CAMERA));
+            if (camera_within_bounding_box)
+            {
+                GpuResourceHandle& vertex_buffer_handle = UploadVertices(*object_3D);
+                bool object_query_begun = OcclusionCuller->BeginObjectQuery(*object_3D);
+                DrawFromVertexBuffer(*object_3D, vertex_buffer_handle, *OccluderPipelineState);
+                if (object_query_begun)
+                {
+                    OcclusionCuller->EndQuery();
+                }
+                ++OcclusionCuller->CurrentFrameStatistics.DrawnObjectCount;
+                continue;
+            }
+
+            // QUERY THE OBJECT'S BOUNDING BOX.
+            // If the object's previous query is still pending, it remains culled until the result arrives.
+            GLuint query_id = OcclusionCuller->BeginBoundingBoxQuery(*object_3D);
+            bool query_begun = (INVALID_ID != query_id);
+            if (query_begun)
+            {
+                DrawBoundingBox(bounding_box);
+                OcclusionCuller->EndQuery();
+            }
+
+            // DRAW THE OBJECT IF ITS BOUNDING BOX TURNS OUT TO BE VISIBLE.
+            // The GPU waits for the query result itself, so the CPU never stalls.
+            bool conditional_draw_possible = (query_begun && conditional_rendering_supported);
+            if (conditional_draw_possible)
+            {
+                GpuResourceHandle& vertex_buffer_handle = UploadVertices(*object_3D);
+                glBeginConditionalRender(query_id, GL_QUERY_WAIT);
+                DrawFromVertexBuffer(*object_3D, vertex_buffer_handle, *OccluderPipelineState);
+                glEndConditionalRender();
+                ++OcclusionCuller->CurrentFrameStatistics.ConditionallyDrawnObjectCount;
+            }
+            else
+            {
+                ++OcclusionCuller->CurrentFrameStatistics.CulledObjectCount;
+            }
+        }
+
+        // RESTORE COLOR AND DEPTH WRITES.
+        // Otherwise, the state for bounding boxes could prevent the screen from being fully cleared.
+        GraphicsDevice->Apply(*OccluderPipelineState);
+
+        OccludableObjects.clear();
+    }
+
+    /// Draws a bounding box with the position-color shader program, using the pipeline
+    /// state for occlusion queries.  An occlusion query should be active.
+    /// @param[in]  bounding_box - The bounding box to draw.
+    void Renderer::DrawBoundingBox(const BoundingBox& bounding_box)
+    {
+        // CREATE THE UNIT CUBE IF NEEDED.
+        bool unit_cube_exists = (nullptr != UnitCubeVertexBuffer);
+        if (!unit_cube_exists)
+        {
+            UnitCubeVertexBuffer = GraphicsDevice->CreateVertexBuffer();
+            bool unit_cube_created = (nullptr != UnitCubeVertexBuffer);
+            if (!unit_cube_created)
+            {
+                return;
+            }
+
+            // FILL THE CUBE WITH 2 TRIANGLES FOR EACH OF ITS 6 FACES.
+            const MATH::Vector3f CORNERS[] =
+            {
+                MATH::Vector3f(0.0f, 0.0f, 0.0f),
+                MATH::Vector3f(1.0f, 0.0f, 0.0f),
+                MATH::Vector3f(1.0f, 1.0f, 0.0f),
+                MATH::Vector3f(0.0f, 1.0f, 0.0f),
+                MATH::Vector3f(0.0f, 0.0f, 1.0f),
+                MATH::Vector3f(1.0f, 0.0f, 1.0f),
+                MATH::Vector3f(1.0f, 1.0f, 1.0f),
+                MATH::Vector3f(0.0f, 1.0f, 1.0f)
+            };
+            const unsigned int TRIANGLE_CORNER_INDICES[] =
+            {
+                0, 2, 1,  0, 3, 2,  // Back.
+                4, 5, 6,  4, 6, 7,  // Front.
+                0, 4, 7,  0, 7, 3,  // Left.
+                1, 2, 6,  1, 6, 5,  // Right.
+                0, 1, 5,  0, 5, 4,  // Bottom.
+                3, 7, 6,  3, 6, 2   // Top.
+            };
+            const GRAPHICS::Color UNUSED_COLOR(1.0f, 1.0f, 1.0f);
+            std::vector<GRAPHICS::Vertex> unit_cube_vertices;
+            for (const unsigned int corner_index : TRIANGLE_CORNER_INDICES)
+            {
+                unit_cube_vertices.emplace_back(CORNERS[corner_index], UNUSED_COLOR);
+            }
+            UnitCubeVertexBuffer->Fill(unit_cube_vertices);
+        }
+
+        // SET THE PIPELINE STATE AND VERTEX BUFFER TO BE USED.
+        GraphicsDevice->Apply(*BoundingBoxQueryPipelineState);
+        GraphicsDevice->Bind(*UnitCubeVertexBuffer);
+
+        // STRETCH THE UNIT CUBE OVER THE BOUNDING BOX.
+        MATH::Vector3f bounding_box_size(
+            bounding_box.MaxWorldPosition.X - bounding_box.MinWorldPosition.X,
+            bounding_box.MaxWorldPosition.Y - bounding_box.MinWorldPosition.Y,
+            bounding_box.MaxWorldPosition.Z - bounding_box.MinWorldPosition.Z);
+        MATH::Matrix4x4f world_transform = (
+            MATH::Matrix4x4f::Translation(bounding_box.MinWorldPosition) *
+            MATH::Matrix4x4f::Scale(bounding_box_size));
+        PositionColorShaderProgram->SetUniformMatrix("world_transform", world_transform);
+        SetCameraTransforms(*PositionColorShaderProgram);
+
+        // DRAW THE BOUNDING BOX.
+        const GLint FIRST_VERTEX = 0;
+        const GLsizei CUBE_VERTEX_COUNT = 36;
+        glDrawArrays(GL_TRIANGLES, FIRST_VERTEX, CUBE_VERTEX_COUNT);
+    }
+
+    /// Computes the axis-aligned box bounding an object in world space.
+    /// @param[in]  object_3D - The object to bound.  It must have vertices.
+    /// @return The world-space bounding box of the object.
+    Renderer::BoundingBox Renderer::WorldBoundingBox(const GRAPHICS::Object3D& object_3D)
+    {
+        // FIND THE BOUNDS OF THE OBJECT IN OBJECT SPACE.
+        const std::vector<GRAPHICS::Vertex>& vertices = object_3D.GetVertices();
+        MATH::Vector3f min_object_position = vertices.front().ObjectSpacePosition;
+        MATH::Vector3f max_object_position = vertices.front().ObjectSpacePosition;
+        for (const GRAPHICS::Vertex& vertex : vertices)
+        {
+            min_object_position.X = std::min(min_object_position.X, vertex.ObjectSpacePosition.X);
+            min_object_position.Y = std::min(min_object_position.Y, vertex.ObjectSpacePosition.Y);
+            min_object_position.Z = std::min(min_object_position.Z, vertex.ObjectSpacePosition.Z);
+            max_object_position.X = std::max(max_object_position.X, vertex.ObjectSpacePosition.X);
+            max_object_position.Y = std::max(max_object_position.Y, vertex.ObjectSpacePosition.Y);
+            max_object_position.Z = std::max(max_object_position.Z, vertex.ObjectSpacePosition.Z);
+        }
+
+        // BOUND ALL CORNERS OF THE OBJECT-SPACE BOUNDS IN WORLD SPACE.
+        // This is looser than bounding the transformed vertices but only requires transforming 8 points.
+        MATH::Matrix4x4f world_transform = object_3D.WorldTransform();
+        BoundingBox bounding_box;
+        const unsigned int CORNER_COUNT = 8;
+        for (unsigned int corner_index = 0; corner_index < CORNER_COUNT; ++corner_index)
+        {
+            MATH::Vector3f object_corner(
+                (corner_index & 1) ? max_object_position.X : min_object_position.X,
+                (corner_index & 2) ? max_object_position.Y : min_object_position.Y,
+                (corner_index & 4) ? max_object_position.Z : min_object_position.Z);
+            MATH::Vector3f world_corner = world_transform.TransformPoint(object_corner);
 
+            bool first_corner = (0 == corner_index);
+            if (first_corner)
+            {
+                bounding_box.MinWorldPosition = world_corner;
+                bounding_box.MaxWorldPosition = world_corner;
+                continue;
+            }
+            bounding_box.MinWorldPosition.X = std::min(bounding_box.MinWorldPosition.X, world_corner.X);
+            bounding_box.MinWorldPosition.Y = std::min(bounding_box.MinWorldPosition.Y, world_corner.Y);
+            bounding_box.MinWorldPosition.Z = std::min(bounding_box.MinWorldPosition.Z, world_corner.Z);
+            bounding_box.MaxWorldPosition.X = std::max(bounding_box.MaxWorldPosition.X, world_corner.X);
+            bounding_box.MaxWorldPosition.Y = std::max(bounding_box.MaxWorldPosition.Y, world_corner.Y);
+            bounding_box.MaxWorldPosition.Z = std::max(bounding_box.MaxWorldPosition.Z, world_corner.Z);
+        }
+        return bounding_box;
+    }
+
+    /// Draws vertices for a 3D object from the currently bound vertex buffer.
+    /// The position-color shader program must already be in use.
+    /// @param[in]  object_3D - The 3D object being drawn.
+    /// @param[in]  first_vertex - The index of the object's first vertex in the bound buffer.
+    /// @param[in]  vertex_count - The number of vertices to draw.
+    void Renderer::DrawVertices(const GRAPHICS::Object3D& object_3D, const GLint first_vertex, const GLsizei vertex_count)
+    {
         // SET THE TRANSFORMATION MATRICES.
         MATH::Matrix4x4f world_transform = object_3D.WorldTransform();
         PositionColorShaderProgram->SetUniformMatrix("world_transform", world_transform);
 
+        SetCameraTransforms(*PositionColorShaderProgram);
+
+        // DRAW THE 3D OBJECT'S VERTICES.
+        glDrawArrays(GL_TRIANGLES, first_vertex, vertex_count);
+    }
+
+    /// Sets the camera's view and projection transformation matrices in the provided shader program.
+    /// @param[in]  shader_program - The shader program whose uniform variables should be set.
+    ///     It must be the shader program currently in use.
+    void Renderer::SetCameraTransforms(const SHADERS::ShaderProgram& shader_program) const
+    {
+        // SET THE VIEW TRANSFORM.
         MATH::Matrix4x4f camera_view_transform = Camera.ViewTransform();
-        PositionColorShaderProgram->SetUniformMatrix("view_transform", camera_view_transform);
+        shader_program.SetUniformMatrix("view_transform", camera_view_transform);
+
+        // SET THE PROJECTION TRANSFORM.
+        MATH::Matrix4x4f projection_transform = ProjectionTransform();
+        shader_program.SetUniformMatrix("projection_transform", projection_transform);
+    }
 
+    /// Gets the camera's projection transformation matrix.
+    /// @return The projection transform.
+    MATH::Matrix4x4f Renderer::ProjectionTransform() const
+    {
         /// @todo   Figure out how we want to put projections into camera class.
-        const float LEFT_X_WORLD_BOUNDARY = Camera.WorldPosition.X - 1.0f;
-        const float RIGHT_X_WORLD_BOUNDARY = Camera.WorldPosition.X + 1.0f;
-        const float BOTTOM_Y_WORLD_BOUNDARY = Camera.WorldPosition.Y - 1.0f;
-        const float TOP_Y_WORLD_BOUNDARY = Camera.WorldPosition.Y + 1.0f;
-        const float NEAR_Z_WORLD_BOUNDARY = Camera.WorldPosition.Z - 0.5f;
-        const float FAR_Z_WORLD_BOUNDARY = Camera.WorldPosition.Z - 2.5f;
+        // The projection is applied after the view transform, which has already moved the camera
+        // to the origin looking down the negative z axis, so the boundaries are relative to the camera.
+        const float LEFT_X_WORLD_BOUNDARY = -1.0f;
+        const float RIGHT_X_WORLD_BOUNDARY = 1.0f;
+        const float BOTTOM_Y_WORLD_BOUNDARY = -1.0f;
+        const float TOP_Y_WORLD_BOUNDARY = 1.0f;
+        const float NEAR_Z_WORLD_BOUNDARY = -0.5f;
+        const float FAR_Z_WORLD_BOUNDARY = -2.5f;
         MATH::Matrix4x4f orthographic_projection_transform = Camera::OrthographicProjection(
             LEFT_X_WORLD_BOUNDARY,
             RIGHT_X_WORLD_BOUNDARY,
@@ -128,7 +1384,6 @@ namespace OPEN_GL
             TOP_Y_WORLD_BOUNDARY,
             NEAR_Z_WORLD_BOUNDARY,
             FAR_Z_WORLD_BOUNDARY);
-        PositionColorShaderProgram->SetUniformMatrix("projection_transform", orthographic_projection_transform);
 
         const MATH::Angle<float>::Degrees VERTICAL_FIELD_OF_VIEW_IN_DEGREES(60.0f);
         const float ASPECT_RATIO_WIDTH_OVER_HEIGHT = 1.0f;
@@ -137,19 +1392,191 @@ namespace OPEN_GL
             ASPECT_RATIO_WIDTH_OVER_HEIGHT,
             NEAR_Z_WORLD_BOUNDARY,
             FAR_Z_WORLD_BOUNDARY);
-        //PositionColorShaderProgram->SetUniformMatrix("projection_transform", perspective_projection_transform);
+        //return perspective_projection_transform;
+        return orthographic_projection_transform;
+    }
 
-        // DRAW THE 3D OBJECT'S VERTICES.
-        const unsigned int FIRST_VERTEX = 0;
-        GLsizei vertex_count = static_cast<GLsizei>(object_3D.Vertices.size());
-        glDrawArrays(GL_TRIANGLES, FIRST_VERTEX, vertex_count);
+    /// Determines if the instanced shader program is ready, starting to create it
+    /// if instanced rendering is supported and this is the first time it's needed.
+    /// @return True if the instanced shader program is ready to use; false otherwise.
+    bool Renderer::InstancedShaderProgramReady()
+    {
+        // MAKE SURE INSTANCED RENDERING IS SUPPORTED.
+        if (!InstancedRenderingSupported)
+        {
+            return false;
+        }
+
+        // START CREATING THE SHADER PROGRAM IF IT'S THE FIRST TIME IT'S NEEDED.
+        bool shader_program_requested = (nullptr != PositionColorInstancedShaderProgram);
+        if (!shader_program_requested)
+        {
+            PositionColorInstancedShaderProgram = ShaderProgramVariants.Get(
+                SHADERS::POSITION_COLOR_SHADER_DESCRIPTION,
+                SHADERS::INSTANCED_FEATURE_BIT,
+                &SHADERS::POSITION_COLOR_VERTEX_LAYOUT,
+                &SHADERS::POSITION_COLOR_INSTANCE_LAYOUT);
+            PositionColorInstancedPipelineState = CreatePipelineState(PositionColorInstancedShaderProgram);
+        }
+
+        // CHECK IF THE SHADER PROGRAM IS READY.
+        bool shader_program_ready = (
+            (nullptr != PositionColorInstancedShaderProgram) &&
+            (nullptr != PositionColorInstancedPipelineState) &&
+            GraphicsDevice->IsReady(*PositionColorInstancedShaderProgram));
+        return shader_program_ready;
+    }
+
+    /// Creates a pipeline state for drawing with the provided shader program.
+    /// All other state is left at defaults matching OpenGL's initial state.
+    /// @param[in]  shader_program - The shader program for the pipeline state.
+    /// @return The pipeline state; null if the shader program is null.
+    std::shared_ptr<const PipelineState> Renderer::CreatePipelineState(const std::shared_ptr<SHADERS::ShaderProgram>& shader_program) const
+    {
+        // MAKE SURE A SHADER PROGRAM WAS PROVIDED.
+        bool shader_program_exists = (nullptr != shader_program);
+        if (!shader_program_exists)
+        {
+            return nullptr;
+        }
+
+        // CREATE THE PIPELINE STATE.
+        PipelineStateDescription pipeline_state_description;
+        pipeline_state_description.ShaderProgram = shader_program.get();
+        return GraphicsDevice->CreatePipelineState(pipeline_state_description);
     }
 
     /// Displays the screen to the user by swapping the back buffer
-    /// with the front buffer.
-    void Renderer::DisplayScreen() const
+    /// with the front buffer.  Any queued opaque objects, occludable objects, static batches,
+    /// GPU culled objects, and instances are drawn first.
+    void Renderer::DisplayScreen()
     {
+        DrawOpaqueObjects();
+        DrawOccludableObjects();
+        DrawStaticBatches();
+        DrawGpuCulledObjects();
+        DrawQueuedInstances();
         SwapBuffers(GraphicsDevice->DeviceContext);
+        GraphicsDevice->EndFrame();
+
+        bool occlusion_culling_supported = (nullptr != OcclusionCuller);
+        if (occlusion_culling_supported)
+        {
+            OcclusionCuller->EndFrame();
+        }
+
+        bool overdraw_measured = (nullptr != OverdrawMeter);
+        if (overdraw_measured)
+        {
+            OverdrawMeter->EndFrame();
+        }
+
+        ReleaseUnusedResources();
+        ResourceManager.AdvanceFrame();
+    }
+
+    /// Releases resources for objects that haven't been drawn recently.  This also
+    /// forgets objects that may have been moved or destroyed since they were last drawn.
+    void Renderer::ReleaseUnusedResources()
+    {
+        // REMOVE ANY HANDLES FOR UNUSED RESOURCES.
+        auto release_unused_resources = [this](std::unordered_map< const GRAPHICS::Object3D*, GpuResourceHandle >& handles_by_object)
+        {
+            for (auto object_and_handle = handles_by_object.begin(); object_and_handle != handles_by_object.end();)
+            {
+                // KEEP RESOURCES THAT HAVE BEEN USED RECENTLY.
+                const GpuResourceHandle& handle = object_and_handle->second;
+                bool resource_used_recently = (ResourceManager.FramesSinceLastUse(handle) <= MAX_UNUSED_FRAME_COUNT);
+                if (resource_used_recently)
+                {
+                    ++object_and_handle;
+                    continue;
+                }
+
+                // RELEASE THE RESOURCE.
+                ResourceManager.Destroy(handle);
+                object_and_handle = handles_by_object.erase(object_and_handle);
+            }
+        };
+        release_unused_resources(VertexBuffers);
+        release_unused_resources(StreamingVertexBuffers);
+
+        // REMOVE INSTANCED MESHES THAT HAVEN'T BEEN USED RECENTLY.
+        uint64_t current_frame_number = GraphicsDevice->CurrentFrameContext().FrameNumber;
+        auto instanced_mesh_unused = [current_frame_number](const InstancedMesh& instanced_mesh)
+        {
+            bool instanced_mesh_used_recently = (
+                instanced_mesh.UsedByGpuCulledObjects ||
+                !instanced_mesh.QueuedInstanceData.empty() ||
+                (current_frame_number - instanced_mesh.LastUsedFrameNumber <= MAX_UNUSED_FRAME_COUNT));
+            return !instanced_mesh_used_recently;
+        };
+        bool unused_instanced_meshes_exist = std::any_of(InstancedMeshes.cbegin(), InstancedMeshes.cend(), instanced_mesh_unused);
+        if (unused_instanced_meshes_exist)
+        {
+            // MOVE THE VERTICES OF THE REMAINING MESHES TOGETHER.
+            std::vector<InstancedMesh> used_instanced_meshes;
+            std::vector<GRAPHICS::Vertex> used_instanced_mesh_vertices;
+            for (InstancedMesh& instanced_mesh : InstancedMeshes)
+            {
+                if (instanced_mesh_unused(instanced_mesh))
+                {
+                    continue;
+                }
+
+                auto instanced_mesh_vertices = InstancedMeshVertices.cbegin() + instanced_mesh.FirstVertex;
+                instanced_mesh.FirstVertex = static_cast<GLuint>(used_instanced_mesh_vertices.size());
+                used_instanced_mesh_vertices.insert(
+                    used_instanced_mesh_vertices.end(),
+                    instanced_mesh_vertices,
+                    instanced_mesh_vertices + instanced_mesh.VertexCount);
+                used_instanced_meshes.push_back(std::move(instanced_mesh));
+            }
+            InstancedMeshes.swap(used_instanced_meshes);
+            InstancedMeshVertices.swap(used_instanced_mesh_vertices);
+            InstancedMeshVertexBufferOutdated = true;
+
+            // UPLOAD GPU CULLED OBJECTS AGAIN SINCE THEY REFERENCE VERTICES THAT MAY HAVE MOVED.
+            bool gpu_culled_objects_exist = !GpuCulledObjects.empty();
+            if (gpu_culled_objects_exist)
+            {
+                GpuCulledObjectsOutdated = true;
+            }
+        }
+
+        // REMOVE QUANTIZED COPIES OF MESHES THAT NO LONGER EXIST OR HAVEN'T BEEN DRAWN RECENTLY.
+        for (auto mesh_and_buffer = QuantizedMeshBuffers.begin(); mesh_and_buffer != QuantizedMeshBuffers.end();)
+        {
+            const QuantizedMeshBuffer& quantized_mesh_buffer = mesh_and_buffer->second;
+            bool mesh_still_used = (
+                !quantized_mesh_buffer.SourceMesh.expired() &&
+                (current_frame_number - quantized_mesh_buffer.LastUsedFrameNumber <= MAX_UNUSED_FRAME_COUNT));
+            if (mesh_still_used)
+            {
+                ++mesh_and_buffer;
+                continue;
+            }
+
+            GraphicsDevice->Destroy(quantized_mesh_buffer.Buffer);
+            mesh_and_buffer = QuantizedMeshBuffers.erase(mesh_and_buffer);
+        }
+
+        // REMOVE POSITION-ONLY COPIES OF MESHES THAT NO LONGER EXIST OR HAVEN'T BEEN DRAWN RECENTLY.
+        for (auto mesh_and_buffer = PositionOnlyMeshBuffers.begin(); mesh_and_buffer != PositionOnlyMeshBuffers.end();)
+        {
+            const PositionOnlyMeshBuffer& position_only_mesh_buffer = mesh_and_buffer->second;
+            bool mesh_still_used = (
+                !position_only_mesh_buffer.SourceMesh.expired() &&
+                (current_frame_number - position_only_mesh_buffer.LastUsedFrameNumber <= MAX_UNUSED_FRAME_COUNT));
+            if (mesh_still_used)
+            {
+                ++mesh_and_buffer;
+                continue;
+            }
+
+            GraphicsDevice->Destroy(position_only_mesh_buffer.Buffer);
+            mesh_and_buffer = PositionOnlyMeshBuffers.erase(mesh_and_buffer);
+        }
     }
 }
 }
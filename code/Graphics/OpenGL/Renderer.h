@@ -2,13 +2,26 @@
 
 #include <memory>
 #include <unordered_map>
+#include <vector>
 #include "Graphics/Camera.h"
 #include "Graphics/Color.h"
+#include "Graphics/Mesh.h"
 #include "Graphics/Object3D.h"
+#include "Graphics/QuantizedMesh.h"
+#include "Graphics/OpenGL/GpuCuller.h"
+#include "Graphics/OpenGL/GpuResourceManager.h"
 #include "Graphics/OpenGL/GraphicsDevice.h"
+#include "Graphics/OpenGL/IndirectDrawBuffer.h"
+#include "Graphics/OpenGL/InstanceBuffer.h"
+#include "Graphics/OpenGL/OcclusionCuller.h"
 #include "Graphics/OpenGL/OpenGL.h"
+#include "Graphics/OpenGL/OverdrawMeter.h"
+#include "Graphics/OpenGL/ShaderProgramVariants.h"
 #include "Graphics/OpenGL/Shaders/ShaderProgram.h"
+#include "Graphics/OpenGL/StaticMeshBatch.h"
+#include "Graphics/OpenGL/StreamingVertexBuffer.h"
 #include "Graphics/OpenGL/VertexBuffer.h"
+#include "Math/Vector3.h"
 
 namespace GRAPHICS
 {
@@ -18,30 +31,255 @@ namespace OPEN_GL
     class Renderer
     {
     public:
+        // CONSTANTS.
+        /// The number of frames an object can go without being drawn before its
+        /// resources on the graphics device are released.
+        static const uint64_t MAX_UNUSED_FRAME_COUNT = 600;
+
         // CONSTRUCTION.
         static std::unique_ptr<Renderer> Create(const std::shared_ptr<OPEN_GL::GraphicsDevice>& graphics_device);
-        explicit Renderer(
-            const std::shared_ptr<OPEN_GL::GraphicsDevice>& graphics_device,
-            const std::shared_ptr<SHADERS::ShaderProgram>& position_color_shader_program);
+        explicit Renderer(const std::shared_ptr<OPEN_GL::GraphicsDevice>& graphics_device);
 
         // RENDERING.
         void ClearScreen(const GRAPHICS::Color& color) const;
         void Draw(const GRAPHICS::Object3D& object_3D);
-        void DisplayScreen() const;
+        void DrawDynamic(const GRAPHICS::Object3D& object_3D);
+        void DrawQuantized(
+            const GRAPHICS::Object3D& object_3D,
+            const GRAPHICS::QuantizedPositionFormat position_format = GRAPHICS::QuantizedPositionFormat::UNORM16);
+        void DrawInstanced(
+            const GRAPHICS::Object3D& object_3D,
+            const GRAPHICS::Color& instance_color = GRAPHICS::Color(1.0f, 1.0f, 1.0f));
+        void DrawQueuedInstances();
+        void DrawStatic(const GRAPHICS::Object3D& object_3D);
+        void DrawStaticBatches();
+        void DrawOpaque(const GRAPHICS::Object3D& object_3D);
+        void DrawOpaqueObjects();
+        void DrawOccludable(const GRAPHICS::Object3D& object_3D);
+        void DrawOccludableObjects();
+        void AddGpuCulledObject(
+            const GRAPHICS::Object3D& object_3D,
+            const GRAPHICS::Color& instance_color = GRAPHICS::Color(1.0f, 1.0f, 1.0f));
+        void ClearGpuCulledObjects();
+        void DrawGpuCulledObjects();
+        void DisplayScreen();
 
         // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
         /// The camera for viewing 3D scenes that get rendered.
         GRAPHICS::Camera Camera;
+        /// The variants of shader programs used by the renderer.  Each variant is only
+        /// compiled once it's first needed, so statistics only cover variants actually used.
+        OPEN_GL::ShaderProgramVariants ShaderProgramVariants;
+        /// The manager of resources on the graphics device for objects drawn individually.
+        /// Its memory budget may be configured as needed.
+        GpuResourceManager ResourceManager;
+        /// True if queued instances may be drawn with a single multi-draw indirect call when supported;
+        /// false to always use the fallback of one instanced draw call per mesh.  Disabling this allows
+        /// verifying that both paths draw the same image on a driver supporting multi-draw indirect.
+        bool MultiDrawIndirectEnabled;
+        /// True if objects submitted via DrawOpaque() are first drawn in a depth-only pre-pass so that
+        /// each pixel is only shaded once in the following color pass; false to draw them in a single pass.
+        /// This may be changed between frames (for example, per scene) based on how much objects overlap.
+        bool DepthPrePassEnabled;
+        /// The meter of overdraw for objects submitted via DrawOpaque().
+        /// Null if sample queries aren't supported, in which case overdraw isn't measured.
+        std::unique_ptr<OPEN_GL::OverdrawMeter> OverdrawMeter;
+        /// The occlusion culler for objects drawn via DrawOccludable().
+        /// Null if occlusion queries aren't supported, in which case such objects are always drawn.
+        std::unique_ptr<OPEN_GL::OcclusionCuller> OcclusionCuller;
+        /// The culler for objects added via AddGpuCulledObject().  Null if compute shaders or
+        /// instanced rendering aren't supported, in which case such objects are drawn as instances.
+        std::unique_ptr<OPEN_GL::GpuCuller> GpuCuller;
 
     private:
+        // PRIVATE TYPES.
+        /// An axis-aligned box bounding an object in world space.
+        struct BoundingBox
+        {
+            /// The corner of the box with the smallest coordinates.
+            MATH::Vector3f MinWorldPosition = MATH::Vector3f();
+            /// The corner of the box with the largest coordinates.
+            MATH::Vector3f MaxWorldPosition = MATH::Vector3f();
+        };
+
+        /// A mesh that gets drawn via instanced rendering, along with any instances
+        /// of it that have been submitted for drawing but not yet drawn.
+        struct InstancedMesh
+        {
+            /// The index of the mesh's first vertex in the vertices shared by all instanced meshes.
+            GLuint FirstVertex = 0;
+            /// The number of vertices in the mesh.
+            GLuint VertexCount = 0;
+            /// The mesh of the object the instanced mesh was created from, if it still exists.
+            /// Held weakly so that objects changing their meshes don't need to copy them.
+            std::weak_ptr<const GRAPHICS::Mesh> SourceMesh;
+            /// The version of the source mesh when its vertices were copied into the instanced mesh.
+            /// Since a mesh only referenced by one object is changed in place, the instanced mesh
+            /// only still matches its source mesh while the versions are equal.
+            uint64_t SourceMeshVersion = 0;
+            /// The raw per-instance data for instances that have not yet been drawn,
+            /// in the layout expected by the instanced position-color shader program.
+            std::vector<float> QueuedInstanceData;
+            /// The number of the frame in which an instance of the mesh was last submitted.
+            uint64_t LastUsedFrameNumber = 0;
+            /// True if objects culled on the GPU are drawn with the mesh, in which case it's
+            /// used every frame without being submitted; false otherwise.
+            bool UsedByGpuCulledObjects = false;
+        };
+
+        /// A static object added for culling on the GPU.
+        struct GpuCulledObject
+        {
+            /// The object.
+            const GRAPHICS::Object3D* Object = nullptr;
+            /// The color to multiply with the colors of the object's vertices.
+            GRAPHICS::Color InstanceColor = GRAPHICS::Color(1.0f, 1.0f, 1.0f);
+        };
+
+        /// A quantized copy of a mesh on the graphics device.
+        struct QuantizedMeshBuffer
+        {
+            /// The mesh that was quantized, if it still exists.  Held weakly so that objects
+            /// changing their meshes don't need to copy them and so that the copy can be released
+            /// once no objects use the mesh.  Since a mesh's address may be reused by a different
+            /// mesh, this is checked against the drawn mesh each time.
+            std::weak_ptr<const GRAPHICS::Mesh> SourceMesh;
+            /// The version of the source mesh when it was quantized.  Since a mesh only referenced
+            /// by one object is changed in place, the copy only matches while the versions are equal.
+            uint64_t SourceMeshVersion = 0;
+            /// The number of the frame in which the copy was last drawn.
+            uint64_t LastUsedFrameNumber = 0;
+            /// The format of positions in the buffer.
+            GRAPHICS::QuantizedPositionFormat PositionFormat;
+            /// The transform from decoded positions to object-space positions.
+            MATH::Matrix4x4f DequantizationTransform;
+            /// The vertex buffer holding the quantized vertices.
+            std::shared_ptr<VertexBuffer> Buffer;
+            /// The number of vertices in the buffer.
+            GLsizei VertexCount;
+        };
+
+        /// A copy of only the positions of a mesh's vertices on the graphics device, for depth-only rendering.
+        struct PositionOnlyMeshBuffer
+        {
+            /// The mesh whose positions were copied, if it still exists.  Held weakly and checked
+            /// against the drawn mesh for the same reasons as for quantized copies of meshes.
+            std::weak_ptr<const GRAPHICS::Mesh> SourceMesh;
+            /// The version of the source mesh when its positions were copied.
+            uint64_t SourceMeshVersion = 0;
+            /// The number of the frame in which the copy was last drawn.
+            uint64_t LastUsedFrameNumber = 0;
+            /// The vertex buffer holding the positions.
+            std::shared_ptr<VertexBuffer> Buffer;
+            /// The number of vertices in the buffer.
+            GLsizei VertexCount;
+        };
+
+        // HELPER METHODS.
+        void ReleaseUnusedResources();
+        bool InstancedShaderProgramReady();
+        const PositionOnlyMeshBuffer* UploadPositions(const GRAPHICS::Object3D& object_3D);
+        InstancedMesh& FindOrAddInstancedMesh(const GRAPHICS::Object3D& object_3D);
+        bool UpdateInstancedMeshVertexBuffer();
+        static OPEN_GL::GpuCuller::CullingObject CreateCullingObject(
+            const GRAPHICS::Object3D& object_3D,
+            const InstancedMesh& instanced_mesh);
+        GpuResourceHandle& UploadVertices(const GRAPHICS::Object3D& object_3D);
+        void DrawFromVertexBuffer(
+            const GRAPHICS::Object3D& object_3D,
+            const GpuResourceHandle& vertex_buffer_handle,
+            const PipelineState& pipeline_state);
+        void DrawBoundingBox(const BoundingBox& bounding_box);
+        static BoundingBox WorldBoundingBox(const GRAPHICS::Object3D& object_3D);
+        void DrawVertices(const GRAPHICS::Object3D& object_3D, const GLint first_vertex, const GLsizei vertex_count);
+        void SetCameraTransforms(const SHADERS::ShaderProgram& shader_program) const;
+        MATH::Matrix4x4f ProjectionTransform() const;
+        std::shared_ptr<const PipelineState> CreatePipelineState(const std::shared_ptr<SHADERS::ShaderProgram>& shader_program) const;
+
         // MEMBER VARIABLES.
         /// The graphics device to use for rendering.
         std::shared_ptr<OPEN_GL::GraphicsDevice> GraphicsDevice;
         /// The shader program for rendering objects with position and color vertex attributes.
         std::shared_ptr<SHADERS::ShaderProgram> PositionColorShaderProgram;
-        /// A mapping of 3D objects to their associated vertex buffers.
-        /// @todo   How to free memory when a 3D object is no longer needed?
-        std::unordered_map< const GRAPHICS::Object3D*, std::shared_ptr<VertexBuffer> > VertexBuffers;
+        /// True if the functions needed for instanced rendering are supported; false otherwise.
+        bool InstancedRenderingSupported;
+        /// The shader program for instanced rendering of objects with position and color vertex attributes.
+        /// Null until objects are first drawn via instanced rendering or if it is not supported.
+        std::shared_ptr<SHADERS::ShaderProgram> PositionColorInstancedShaderProgram;
+        /// The pipeline state for rendering objects with the position-color shader program.
+        std::shared_ptr<const PipelineState> PositionColorPipelineState;
+        /// The pipeline state for instanced rendering with the position-color instanced shader program.
+        /// Null whenever the corresponding shader program is.
+        std::shared_ptr<const PipelineState> PositionColorInstancedPipelineState;
+        /// A mapping of 3D objects to handles of their associated vertex buffers.
+        /// Since an object's address may be reused by a different object, the vertices in
+        /// a buffer are checked against the object's vertices each time the object is drawn.
+        std::unordered_map< const GRAPHICS::Object3D*, GpuResourceHandle > VertexBuffers;
+        /// A mapping of dynamic 3D objects to handles of their associated streaming vertex buffers.
+        std::unordered_map< const GRAPHICS::Object3D*, GpuResourceHandle > StreamingVertexBuffers;
+        /// All unique meshes that have been drawn via instanced rendering.
+        std::vector<InstancedMesh> InstancedMeshes;
+        /// The vertices of all instanced meshes, one mesh after another.  Sharing a single
+        /// vertex buffer allows instances of all meshes to be drawn with a single call.
+        std::vector<GRAPHICS::Vertex> InstancedMeshVertices;
+        /// The vertex buffer holding the vertices of all instanced meshes.  Created when first needed.
+        std::shared_ptr<VertexBuffer> InstancedMeshVertexBuffer;
+        /// True if the vertices of existing instanced meshes have moved or changed since the vertex buffer
+        /// was last filled, so it must be entirely refilled; false if only added meshes need to be uploaded.
+        bool InstancedMeshVertexBufferOutdated;
+        /// The number of vertices the vertex buffer for instanced meshes has storage for.
+        GLuint InstancedMeshVertexBufferCapacity;
+        /// The number of leading instanced mesh vertices already uploaded to the vertex buffer.
+        GLuint UploadedInstancedMeshVertexCount;
+        /// The buffer for uploading per-instance data.  Created when first needed.
+        std::shared_ptr<OPEN_GL::InstanceBuffer> InstanceDataBuffer;
+        /// The buffer for uploading draw commands for instanced meshes.  Created when first
+        /// needed and only used if multi-draw indirect rendering is supported.
+        std::shared_ptr<OPEN_GL::IndirectDrawBuffer> InstanceDrawCommandBuffer;
+        /// Batches of small static objects, keyed by the shader program used to draw them.
+        std::unordered_map< const SHADERS::ShaderProgram*, StaticMeshBatch > StaticMeshBatches;
+        /// The shader program for rendering quantized vertices with unorm16 positions.
+        /// Null until first needed or if it couldn't be created, in which case quantized objects are drawn normally.
+        std::shared_ptr<SHADERS::ShaderProgram> Unorm16PositionColorShaderProgram;
+        /// The shader program for rendering quantized vertices with half-float positions.
+        /// Null until first needed or if it couldn't be created, in which case quantized objects are drawn normally.
+        std::shared_ptr<SHADERS::ShaderProgram> HalfFloatPositionColorShaderProgram;
+        /// The pipeline state for rendering quantized vertices with unorm16 positions.
+        /// Null whenever the corresponding shader program is.
+        std::shared_ptr<const PipelineState> Unorm16PositionColorPipelineState;
+        /// The pipeline state for rendering quantized vertices with half-float positions.
+        /// Null whenever the corresponding shader program is.
+        std::shared_ptr<const PipelineState> HalfFloatPositionColorPipelineState;
+        /// Quantized copies of meshes drawn via DrawQuantized(), keyed by the original mesh.
+        std::unordered_map< const GRAPHICS::Mesh*, QuantizedMeshBuffer > QuantizedMeshBuffers;
+        /// The minimal shader program for drawing only the positions of objects in depth pre-passes.
+        /// Null until depth pre-passes are first drawn or if it couldn't be created, in which case
+        /// depth pre-passes are skipped.
+        std::shared_ptr<SHADERS::ShaderProgram> DepthOnlyShaderProgram;
+        /// The pipeline state for depth pre-passes, which tests and writes depth without writing color.
+        /// Null whenever the depth-only shader program is.
+        std::shared_ptr<const PipelineState> DepthOnlyPipelineState;
+        /// The pipeline state for color passes after depth pre-passes, which only draws fragments
+        /// exactly matching the depths from the pre-pass without writing depth again.
+        std::shared_ptr<const PipelineState> EqualDepthPipelineState;
+        /// Position-only copies of meshes drawn in depth pre-passes, keyed by the original mesh.
+        std::unordered_map< const GRAPHICS::Mesh*, PositionOnlyMeshBuffer > PositionOnlyMeshBuffers;
+        /// Objects submitted via DrawOpaque() that haven't been drawn yet.
+        std::vector<const GRAPHICS::Object3D*> OpaqueObjects;
+        /// Objects submitted via DrawOccludable() that haven't been drawn yet.
+        std::vector<const GRAPHICS::Object3D*> OccludableObjects;
+        /// The pipeline state for drawing objects that may hide others, which tests and writes depth.
+        /// Also used for opaque objects when there's no depth pre-pass.
+        std::shared_ptr<const PipelineState> OccluderPipelineState;
+        /// The pipeline state for drawing bounding boxes within occlusion queries,
+        /// which only tests depth without writing depth or color.
+        std::shared_ptr<const PipelineState> BoundingBoxQueryPipelineState;
+        /// A cube spanning from 0 to 1 along each axis, for drawing bounding boxes.  Created when first needed.
+        std::shared_ptr<VertexBuffer> UnitCubeVertexBuffer;
+        /// Objects added via AddGpuCulledObject().
+        std::vector<GpuCulledObject> GpuCulledObjects;
+        /// True if objects have been added or cleared since they were last uploaded for GPU culling.
+        bool GpuCulledObjectsOutdated;
     };
 }
 }
@@ -0,0 +1,134 @@
+#include "Graphics/OpenGL/ResourceDeletionQueue.h"
+
+namespace GRAPHICS
+{
+namespace OPEN_GL
+{
+    /// Constructor for an empty queue.
+    ResourceDeletionQueue::ResourceDeletionQueue() :
+        QueuedCount(0),
+        DeletedCount(0),
+        DeleteCallCount(0),
+        PendingFrameResources()
+    {}
+
+    /// Queues a buffer for deletion once the frame in which it was destroyed is finished.
+    /// @param[in]  buffer_id - The ID of the buffer.  Invalid IDs are ignored.
+    /// @param[in]  frame_number - The number of the frame in which the buffer was destroyed.
+    void ResourceDeletionQueue::QueueBuffer(const GLuint buffer_id, const uint64_t frame_number)
+    {
+        bool buffer_exists = (INVALID_ID != buffer_id);
+        if (!buffer_exists)
+        {
+            return;
+        }
+
+        ResourcesForFrame(frame_number).BufferIds.push_back(buffer_id);
+        ++QueuedCount;
+    }
+
+    /// Queues a vertex array for deletion once the frame in which it was destroyed is finished.
+    /// @param[in]  array_id - The ID of the vertex array.  Invalid IDs are ignored.
+    /// @param[in]  frame_number - The number of the frame in which the vertex array was destroyed.
+    void ResourceDeletionQueue::QueueVertexArray(const GLuint array_id, const uint64_t frame_number)
+    {
+        bool vertex_array_exists = (INVALID_ID != array_id);
+        if (!vertex_array_exists)
+        {
+            return;
+        }
+
+        ResourcesForFrame(frame_number).VertexArrayIds.push_back(array_id);
+        ++QueuedCount;
+    }
+
+    /// Deletes all objects destroyed in frames the GPU has finished.
+    /// @param[in]  completed_frame_number - The number of the latest frame known to be finished by the GPU.
+    ///     All earlier frames must also be finished.
+    void ResourceDeletionQueue::DeleteRetired(const uint64_t completed_frame_number)
+    {
+        while (!PendingFrameResources.empty())
+        {
+            // STOP ONCE REACHING A FRAME THAT MAY STILL BE IN FLIGHT.
+            FrameResources& oldest_frame_resources = PendingFrameResources.front();
+            bool oldest_frame_completed = (oldest_frame_resources.FrameNumber <= completed_frame_number);
+            if (!oldest_frame_completed)
+            {
+                break;
+            }
+
+            // DELETE THE FRAME'S OBJECTS.
+            Delete(oldest_frame_resources);
+            PendingFrameResources.pop_front();
+        }
+    }
+
+    /// Deletes all queued objects regardless of whether the GPU may still be using them.
+    /// Intended for when the graphics device is being destroyed.
+    void ResourceDeletionQueue::DeleteAll()
+    {
+        for (FrameResources& frame_resources : PendingFrameResources)
+        {
+            Delete(frame_resources);
+        }
+        PendingFrameResources.clear();
+    }
+
+    /// Gets the number of objects waiting to be deleted.
+    /// @return The number of objects in the queue.
+    std::size_t ResourceDeletionQueue::PendingCount() const
+    {
+        std::size_t pending_count = 0;
+        for (const FrameResources& frame_resources : PendingFrameResources)
+        {
+            pending_count += frame_resources.BufferIds.size();
+            pending_count += frame_resources.VertexArrayIds.size();
+        }
+        return pending_count;
+    }
+
+    /// Gets the objects destroyed during a frame, adding them to the queue if needed.
+    /// @param[in]  frame_number - The number of the frame.  Must not be earlier than
+    ///     the newest frame already in the queue.
+    /// @return The objects destroyed during the frame.
+    ResourceDeletionQueue::FrameResources& ResourceDeletionQueue::ResourcesForFrame(const uint64_t frame_number)
+    {
+        // Frames are queued in order, so only the newest frame could match.
+        bool frame_already_queued = (!PendingFrameResources.empty() && (frame_number == PendingFrameResources.back().FrameNumber));
+        if (!frame_already_queued)
+        {
+            FrameResources frame_resources;
+            frame_resources.FrameNumber = frame_number;
+            PendingFrameResources.push_back(frame_resources);
+        }
+        return PendingFrameResources.back();
+    }
+
+    /// Deletes all objects destroyed during a frame in as few calls as possible.
+    /// @param[in,out]  frame_resources - The objects to delete.  Emptied after deletion.
+    void ResourceDeletionQueue::Delete(FrameResources& frame_resources)
+    {
+        // DELETE ALL BUFFERS AT ONCE.
+        bool buffers_queued = !frame_resources.BufferIds.empty();
+        if (buffers_queued)
+        {
+            GLsizei buffer_count = static_cast<GLsizei>(frame_resources.BufferIds.size());
+            glDeleteBuffers(buffer_count, frame_resources.BufferIds.data());
+            DeletedCount += frame_resources.BufferIds.size();
+            ++DeleteCallCount;
+            frame_resources.BufferIds.clear();
+        }
+
+        // DELETE ALL VERTEX ARRAYS AT ONCE.
+        bool vertex_arrays_queued = !frame_resources.VertexArrayIds.empty();
+        if (vertex_arrays_queued)
+        {
+            GLsizei vertex_array_count = static_cast<GLsizei>(frame_resources.VertexArrayIds.size());
+            glDeleteVertexArrays(vertex_array_count, frame_resources.VertexArrayIds.data());
+            DeletedCount += frame_resources.VertexArrayIds.size();
+            ++DeleteCallCount;
+            frame_resources.VertexArrayIds.clear();
+        }
+    }
+}
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <vector>
+#include "Graphics/OpenGL/OpenGL.h"
+
+namespace GRAPHICS
+{
+namespace OPEN_GL
+{
+    /// Defers deleting OpenGL objects until the GPU has finished every frame that might use them.
+    ///
+    /// Objects destroyed at run time may still be referenced by commands from frames in flight.
+    /// Rather than deleting them immediately (which may force the driver to stall or to keep
+    /// tracking objects the application considers gone), each object is tagged with the number
+    /// of the frame in which it was destroyed.  Once that frame is known to be finished (via
+    /// its frame fence), all objects from the frame are deleted together, using a single
+    /// glDelete* call per type of object.
+    class ResourceDeletionQueue
+    {
+    public:
+        // CONSTRUCTION.
+        explicit ResourceDeletionQueue();
+
+        // QUEUEING.
+        void QueueBuffer(const GLuint buffer_id, const uint64_t frame_number);
+        void QueueVertexArray(const GLuint array_id, const uint64_t frame_number);
+
+        // DELETION.
+        void DeleteRetired(const uint64_t completed_frame_number);
+        void DeleteAll();
+        std::size_t PendingCount() const;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The total number of objects queued for deletion.
+        uint64_t QueuedCount;
+        /// The total number of queued objects that have been deleted.
+        uint64_t DeletedCount;
+        /// The total number of glDelete* calls made to delete queued objects.
+        uint64_t DeleteCallCount;
+
+    private:
+        // PRIVATE TYPES.
+        /// The objects destroyed during a single frame.
+        struct FrameResources
+        {
+            /// The number of the frame in which the objects were destroyed.
+            uint64_t FrameNumber = 0;
+            /// The IDs of buffers to delete.
+            std::vector<GLuint> BufferIds = {};
+            /// The IDs of vertex arrays to delete.
+            std::vector<GLuint> VertexArrayIds = {};
+        };
+
+        // HELPER METHODS.
+        FrameResources& ResourcesForFrame(const uint64_t frame_number);
+        void Delete(FrameResources& frame_resources);
+
+        // MEMBER VARIABLES.
+        /// The objects waiting to be deleted, ordered from the oldest frame to the newest.
+        std::deque<FrameResources> PendingFrameResources;
+    };
+}
+}
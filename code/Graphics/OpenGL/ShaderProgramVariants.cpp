@@ -0,0 +1,117 @@
+#include <tuple>
+#include "ErrorHandling/NullChecking.h"
+#include "Graphics/OpenGL/ShaderProgramVariants.h"
+
+namespace GRAPHICS
+{
+namespace OPEN_GL
+{
+    /// Orders keys so that they can be used in sorted containers.
+    /// @param[in]  other - The key to compare with.
+    /// @return True if this key comes before the other key; false otherwise.
+    bool ShaderProgramVariants::VariantKey::operator<(const VariantKey& other) const
+    {
+        bool comes_before_other = (
+            std::tie(ShaderProgramDescription, FeatureBits, VertexLayout, InstanceLayout) <
+            std::tie(other.ShaderProgramDescription, other.FeatureBits, other.VertexLayout, other.InstanceLayout));
+        return comes_before_other;
+    }
+
+    /// Constructor.  No variants are compiled until requested.
+    /// @param[in]  graphics_device - The graphics device on which to compile variants.
+    /// @throws std::exception - Thrown if the graphics device is null.
+    ShaderProgramVariants::ShaderProgramVariants(const std::shared_ptr<OPEN_GL::GraphicsDevice>& graphics_device) :
+    GraphicsDevice(graphics_device),
+    Variants()
+    {
+        // MAKE SURE REQUIRED PARAMETERS WERE PROVIDED.
+        ERROR_HANDLING::ThrowInvalidArgumentExceptionIfNull(
+            GraphicsDevice,
+            "Graphics device cannot be null for shader program variants.");
+    }
+
+    /// Gets the variant of a shader program with the specified features enabled,
+    /// starting to compile it if it hasn't been requested before.
+    /// @param[in]  shader_program_description - The description of the shader program, including the
+    ///     names of its optional features.  Must exist for as long as the cache.
+    /// @param[in]  feature_bits - The mask of features to enable.  Bits without features are ignored.
+    /// @param[in]  vertex_layout - The layout of per-vertex inputs for the variant.  Null to use the
+    ///     layout from the description.  Must exist for as long as the cache.
+    /// @param[in]  instance_layout - The layout of per-instance inputs for the variant.  Null if the
+    ///     variant has none.  Only used along with a vertex layout.  Must exist for as long as the cache.
+    /// @return The variant of the shader program, which may still be compiling.
+    std::shared_ptr<SHADERS::ShaderProgram> ShaderProgramVariants::Get(
+        const SHADERS::ShaderProgramDescription& shader_program_description,
+        const uint32_t feature_bits,
+        const SHADERS::VertexLayout* const vertex_layout,
+        const SHADERS::VertexLayout* const instance_layout)
+    {
+        // IDENTIFY THE VARIANT.
+        // Bits without features are ignored so that identical variants aren't compiled for masks
+        // differing only in unused bits.
+        VariantKey variant_key;
+        variant_key.ShaderProgramDescription = &shader_program_description;
+        variant_key.FeatureBits = (feature_bits & shader_program_description.AllFeatureBits());
+        variant_key.VertexLayout = vertex_layout;
+        variant_key.InstanceLayout = (nullptr != vertex_layout) ? instance_layout : nullptr;
+
+        // CHECK FOR AN EXISTING VARIANT.
+        auto existing_variant = Variants.find(variant_key);
+        bool variant_exists = (Variants.end() != existing_variant);
+        if (variant_exists)
+        {
+            return existing_variant->second;
+        }
+
+        // DESCRIBE THE VARIANT.
+        SHADERS::ShaderProgramDescription variant_description = shader_program_description.Permutation(variant_key.FeatureBits);
+        bool layout_overridden = (nullptr != variant_key.VertexLayout);
+        if (layout_overridden)
+        {
+            bool instance_inputs_exist = (nullptr != variant_key.InstanceLayout);
+            variant_description.VertexShader = instance_inputs_exist ?
+                SHADERS::VertexShaderDescription(variant_description.VertexShader.UncompiledCode, *variant_key.VertexLayout, *variant_key.InstanceLayout) :
+                SHADERS::VertexShaderDescription(variant_description.VertexShader.UncompiledCode, *variant_key.VertexLayout);
+        }
+
+        // START COMPILING THE VARIANT.
+        std::shared_ptr<SHADERS::ShaderProgram> variant = GraphicsDevice->CreateShaderProgramAsync(variant_description);
+        Variants[variant_key] = variant;
+        return variant;
+    }
+
+    /// Gets statistics about the variants that have been compiled.
+    /// @return Statistics about compiled variants.
+    ShaderProgramVariants::VariantStatistics ShaderProgramVariants::Statistics() const
+    {
+        VariantStatistics statistics;
+        for (const auto& key_and_variant : Variants)
+        {
+            ++statistics.CompiledVariantCount;
+
+            bool variant_exists = (nullptr != key_and_variant.second);
+            if (!variant_exists)
+            {
+                ++statistics.FailedVariantCount;
+                continue;
+            }
+
+            const SHADERS::ShaderProgram& variant = *key_and_variant.second;
+            switch (variant.Status)
+            {
+                case SHADERS::ShaderProgramStatus::READY:
+                    ++statistics.ReadyVariantCount;
+                    statistics.CompileTimeInSeconds += variant.CompileTimeInSeconds;
+                    break;
+                case SHADERS::ShaderProgramStatus::FAILED:
+                    ++statistics.FailedVariantCount;
+                    break;
+                case SHADERS::ShaderProgramStatus::COMPILING:
+                default:
+                    break;
+            }
+        }
+        return statistics;
+    }
+}
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include "Graphics/OpenGL/GraphicsDevice.h"
+#include "Graphics/OpenGL/Shaders/ShaderProgram.h"
+#include "Graphics/OpenGL/Shaders/ShaderProgramDescription.h"
+#include "Graphics/OpenGL/Shaders/VertexFormat.h"
+
+namespace GRAPHICS
+{
+namespace OPEN_GL
+{
+    /// A cache of variants of shader programs with different combinations of optional features enabled.
+    /// Variants are only compiled the first time they're requested, so combinations of features
+    /// that are never used are never compiled.  Compiled variants are cached by their descriptions
+    /// and feature masks for reuse.  Since variants with different features may read different
+    /// vertex inputs, each variant may also be given its own vertex layouts.
+    ///
+    /// Variants are created asynchronously, so the graphics device must be checked to see
+    /// if a variant is ready before it is used.
+    class ShaderProgramVariants
+    {
+    public:
+        // PUBLIC TYPES.
+        /// Statistics about the variants that have been compiled.
+        struct VariantStatistics
+        {
+            /// The number of variants that have been requested and therefore compiled.
+            unsigned int CompiledVariantCount = 0;
+            /// The number of compiled variants that are ready to use.
+            unsigned int ReadyVariantCount = 0;
+            /// The number of variants that failed to compile.
+            unsigned int FailedVariantCount = 0;
+            /// The total time spent compiling and linking variants that are ready, in seconds.
+            double CompileTimeInSeconds = 0.0;
+        };
+
+        // CONSTRUCTION.
+        explicit ShaderProgramVariants(const std::shared_ptr<OPEN_GL::GraphicsDevice>& graphics_device);
+
+        // VARIANTS.
+        std::shared_ptr<SHADERS::ShaderProgram> Get(
+            const SHADERS::ShaderProgramDescription& shader_program_description,
+            const uint32_t feature_bits,
+            const SHADERS::VertexLayout* const vertex_layout = nullptr,
+            const SHADERS::VertexLayout* const instance_layout = nullptr);
+        VariantStatistics Statistics() const;
+
+    private:
+        // PRIVATE TYPES.
+        /// Identifies a variant.  Descriptions and layouts are identified by their addresses,
+        /// so they must exist for as long as the cache.
+        struct VariantKey
+        {
+            /// The description from which the variant was created.
+            const SHADERS::ShaderProgramDescription* ShaderProgramDescription = nullptr;
+            /// The mask of features enabled in the variant.
+            uint32_t FeatureBits = 0;
+            /// The layout of per-vertex inputs for the variant.  Null if the description's layout is used.
+            const SHADERS::VertexLayout* VertexLayout = nullptr;
+            /// The layout of per-instance inputs for the variant.  Null if there are none.
+            const SHADERS::VertexLayout* InstanceLayout = nullptr;
+
+            bool operator<(const VariantKey& other) const;
+        };
+
+        // MEMBER VARIABLES.
+        /// The graphics device on which variants are compiled.
+        std::shared_ptr<OPEN_GL::GraphicsDevice> GraphicsDevice;
+        /// All variants that have been compiled.
+        std::map< VariantKey, std::shared_ptr<SHADERS::ShaderProgram> > Variants;
+    };
+}
+}
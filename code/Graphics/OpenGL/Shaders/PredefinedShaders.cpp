@@ -1,4 +1,11 @@
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
 #include "Graphics/OpenGL/Shaders/PredefinedShaders.h"
+#include "Graphics/QuantizedMesh.h"
+#include "Graphics/Vertex.h"
+#include "Math/Vector3.h"
 
 namespace GRAPHICS
 {
@@ -6,48 +13,162 @@ namespace OPEN_GL
 {
 namespace SHADERS
 {
-    const ShaderProgramDescription VERTEX_POSITION_COLOR_SHADER_DESCRIPTION(
+    const VertexLayout POSITION_COLOR_VERTEX_LAYOUT = VertexLayout::Of<GRAPHICS::Vertex>(
+        {
+            DescribeVertexAttribute<decltype(GRAPHICS::Vertex::ObjectSpacePosition)>("object_space_position", offsetof(GRAPHICS::Vertex, ObjectSpacePosition)),
+            DescribeVertexAttribute<decltype(GRAPHICS::Vertex::Color)>("vertex_color", offsetof(GRAPHICS::Vertex, Color)),
+        });
+
+    /// The layout of tightly packed positions for shaders reading only positions.
+    const VertexLayout POSITION_ONLY_VERTEX_LAYOUT = VertexLayout::Of<MATH::Vector3f>(
+        {
+            DescribeVertexAttribute<MATH::Vector3f>("object_space_position", 0),
+        });
+
+    const VertexLayout POSITION_COLOR_INSTANCE_LAYOUT = VertexLayout::Of<PositionColorInstance>(
+        {
+            DescribeVertexAttribute<decltype(PositionColorInstance::WorldTransformRow0)>("instance_world_transform_row_0", offsetof(PositionColorInstance, WorldTransformRow0)),
+            DescribeVertexAttribute<decltype(PositionColorInstance::WorldTransformRow1)>("instance_world_transform_row_1", offsetof(PositionColorInstance, WorldTransformRow1)),
+            DescribeVertexAttribute<decltype(PositionColorInstance::WorldTransformRow2)>("instance_world_transform_row_2", offsetof(PositionColorInstance, WorldTransformRow2)),
+            DescribeVertexAttribute<decltype(PositionColorInstance::WorldTransformRow3)>("instance_world_transform_row_3", offsetof(PositionColorInstance, WorldTransformRow3)),
+            DescribeVertexAttribute<decltype(PositionColorInstance::Color)>("instance_color", offsetof(PositionColorInstance, Color)),
+        });
+
+    const VertexLayout UNORM16_POSITION_COLOR_VERTEX_LAYOUT = VertexLayout::Of<GRAPHICS::QuantizedVertex>(
+        {
+            DescribeVertexAttribute<decltype(GRAPHICS::QuantizedVertex::Position)>("quantized_position", offsetof(GRAPHICS::QuantizedVertex, Position)),
+            DescribeVertexAttribute<decltype(GRAPHICS::QuantizedVertex::Color)>("vertex_color", offsetof(GRAPHICS::QuantizedVertex, Color)),
+        });
+
+    const VertexLayout HALF_FLOAT_POSITION_COLOR_VERTEX_LAYOUT = VertexLayout::Of<GRAPHICS::QuantizedVertex>(
+        {
+            DescribeVertexAttribute<
+                decltype(GRAPHICS::QuantizedVertex::Position),
+                HalfFloatVertexAttributeFormat<decltype(GRAPHICS::QuantizedVertex::Position)>>(
+                "quantized_position",
+                offsetof(GRAPHICS::QuantizedVertex, Position)),
+            DescribeVertexAttribute<decltype(GRAPHICS::QuantizedVertex::Color)>("vertex_color", offsetof(GRAPHICS::QuantizedVertex, Color)),
+        });
+
+    /// The vertex shader code for all position-color shader programs.  Optional features select
+    /// how positions and world transforms are provided:
+    /// - INSTANCED - World transforms and colors are read per instance rather than via uniforms.
+    /// - QUANTIZED_POSITIONS - Positions are read from quantized vertices and returned to
+    ///     object space via a "dequantization_transform" uniform.  The same code works for all
+    ///     quantized position formats since positions are decoded to floats before reaching the shader.
+    const char* const POSITION_COLOR_VERTEX_SHADER_CODE = R"(
+        // GLSL 1.50.
+        #version 150
+
+    #ifdef QUANTIZED_POSITIONS
+        in vec3 quantized_position;
+        uniform mat4 dequantization_transform;
+    #else
+        in vec3 object_space_position;
+    #endif
+        in vec4 vertex_color;
+
+    #ifdef INSTANCED
+        // The world transform is passed per instance as its 4 rows.
+        in vec4 instance_world_transform_row_0;
+        in vec4 instance_world_transform_row_1;
+        in vec4 instance_world_transform_row_2;
+        in vec4 instance_world_transform_row_3;
+        in vec4 instance_color;
+    #else
+        uniform mat4 world_transform;
+    #endif
+        uniform mat4 view_transform;
+        uniform mat4 projection_transform;
+
+        out vec4 output_vertex_color;
+
+        // Depths must exactly match those from the position-only shader for depth pre-passes.
+        invariant gl_Position;
+
+        void main()
+        {
+        #ifdef QUANTIZED_POSITIONS
+            vec4 object_space_position_4d = dequantization_transform * vec4(quantized_position, 1.0);
+        #else
+            vec4 object_space_position_4d = vec4(object_space_position, 1.0);
+        #endif
+
+        #ifdef INSTANCED
+            // GLSL matrix constructors take columns, so the rows must be transposed.
+            mat4 world_transform = transpose(mat4(
+                instance_world_transform_row_0,
+                instance_world_transform_row_1,
+                instance_world_transform_row_2,
+                instance_world_transform_row_3));
+
+            output_vertex_color = vertex_color * instance_color;
+        #else
+            output_vertex_color = vertex_color;
+        #endif
+            output_vertex_color.a = 1.0;
+            gl_Position = projection_transform * view_transform * world_transform * object_space_position_4d;
+        }
+    )";
+
+    /// The fragment shader code for all position-color shader programs.
+    const char* const POSITION_COLOR_FRAGMENT_SHADER_CODE = R"(
+        // GLSL 1.50.
+        #version 150
+
+        // The input color from the vertex shader.
+        in vec4 output_vertex_color;
+
+        // The final output color.
+        out vec4 output_color;
+
+        void main()
+        {
+            output_color = output_vertex_color;
+            output_color.a = 1.0;
+        }
+    )";
+
+    /// The names of the optional features of the position-color shader code, in order of their feature bits.
+    const std::vector<std::string> POSITION_COLOR_FEATURE_DEFINE_NAMES = { "INSTANCED", "QUANTIZED_POSITIONS" };
+
+    const ShaderProgramDescription POSITION_COLOR_SHADER_DESCRIPTION(
+        VertexShaderDescription(POSITION_COLOR_VERTEX_SHADER_CODE, POSITION_COLOR_VERTEX_LAYOUT),
+        FragmentShaderDescription(POSITION_COLOR_FRAGMENT_SHADER_CODE, "output_color"),
+        POSITION_COLOR_FEATURE_DEFINE_NAMES);
+
+    const ShaderProgramDescription VERTEX_POSITION_ONLY_SHADER_DESCRIPTION(
         VertexShaderDescription(
             R"(
                 // GLSL 1.50.
                 #version 150
 
                 in vec3 object_space_position;
-                in vec4 vertex_color;
-        
+
                 uniform mat4 world_transform;
                 uniform mat4 view_transform;
                 uniform mat4 projection_transform;
 
-                out vec4 output_vertex_color;
+                // Depths must exactly match those from the position-color shader for depth pre-passes.
+                invariant gl_Position;
 
                 void main()
                 {
-                    output_vertex_color = vertex_color;
-                    output_vertex_color.a = 1.0;
                     gl_Position = projection_transform * view_transform * world_transform * vec4(object_space_position, 1.0);
                 }
             )",
-            VertexSizeInBytesFromTypeAndComponentCount<float>(7),
-            {
-                VertexShaderInputVariable("object_space_position", VertexShaderInputVariableComponentCount(3), VertexShaderInputVariableByteOffsetToFirstComponent(0)),
-                VertexShaderInputVariable("vertex_color", VertexShaderInputVariableComponentCount(4), VertexShaderInputVariableByteOffsetToFirstComponent(3 * sizeof(float))),
-            }),
+            POSITION_ONLY_VERTEX_LAYOUT),
         FragmentShaderDescription(
             R"(
                 // GLSL 1.50.
                 #version 150
 
-                // The input color from the vertex shader.
-                in vec4 output_vertex_color;
-
-                // The final output color.
+                // The final output color, which is never written to the color buffer.
                 out vec4 output_color;
 
                 void main()
                 {
-                    output_color = output_vertex_color;
-                    output_color.a = 1.0;
+                    output_color = vec4(0.0);
                 }
             )",
             "output_color")
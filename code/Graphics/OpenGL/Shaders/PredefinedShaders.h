@@ -1,6 +1,9 @@
 #pragma once
 
+#include <cstdint>
+#include "Graphics/Color.h"
 #include "Graphics/OpenGL/Shaders/ShaderProgramDescription.h"
+#include "Graphics/OpenGL/Shaders/VertexFormat.h"
 
 namespace GRAPHICS
 {
@@ -8,28 +11,49 @@ namespace OPEN_GL
 {
 namespace SHADERS
 {
-    /// Calculates a vertex size (for use in shader vertex attributes).
-    /// @tparam VertexComponentType - The type of each vertex component (for example, float).
-    /// @param[in]  vertex_component_count - The number of components per vertex.
-    ///     For example, if a vertex only has x, y, and z positional coordinates,
-    ///     this value would be 3.
-    /// @return The size (in bytes) of 1 vertex with the specified parameters.
-    /// @todo   Upgrade to Visual Studio 2015 so that this can be made constexpr.
-    template <typename VertexComponentType>
-    unsigned int VertexSizeInBytesFromTypeAndComponentCount(const unsigned int vertex_component_count)
-    {
-        unsigned int vertex_component_size_in_bytes = sizeof(VertexComponentType);
-        unsigned int vertex_size_in_bytes = vertex_component_count * vertex_component_size_in_bytes;
-        return vertex_size_in_bytes;
-    }
+    /// A description of a shader program that accepts vertices with position and color attributes
+    /// (see GRAPHICS::Vertex).  Variants with optional features enabled via the feature bits below
+    /// read vertices in other layouts, which must be provided when creating the variants.
+    extern const ShaderProgramDescription POSITION_COLOR_SHADER_DESCRIPTION;
+    /// The feature bit for the position-color shader program to read world transforms and colors
+    /// per instance (see POSITION_COLOR_INSTANCE_LAYOUT) for instanced rendering.  The final color of
+    /// each vertex is its color multiplied by the color of the instance.
+    const uint32_t INSTANCED_FEATURE_BIT = (1u << 0);
+    /// The feature bit for the position-color shader program to read quantized vertices
+    /// (see GRAPHICS::QuantizedVertex) in one of the quantized layouts below.  Positions
+    /// are returned to object space via a per-mesh "dequantization_transform" uniform.
+    const uint32_t QUANTIZED_POSITIONS_FEATURE_BIT = (1u << 1);
+    /// A description of a minimal shader program that accepts tightly packed vertex positions
+    /// (see MATH::Vector3f) for depth-only rendering.  Positions are transformed exactly as by the
+    /// position-color shader program, so depths from the two programs can be compared for equality.
+    extern const ShaderProgramDescription VERTEX_POSITION_ONLY_SHADER_DESCRIPTION;
 
-    /// A type alias to make specification of a vertex shader input variable's component count clearer.
-    using VertexShaderInputVariableComponentCount = int;
-    /// A type alias to make specification of a vertex shader input variable's byte offset to the first component clearer.
-    using VertexShaderInputVariableByteOffsetToFirstComponent = unsigned int;
+    /// The per-instance data for the instanced position-color shader program.
+    struct PositionColorInstance
+    {
+        /// The rows of the instance's world transform.
+        float WorldTransformRow0[4];
+        float WorldTransformRow1[4];
+        float WorldTransformRow2[4];
+        float WorldTransformRow3[4];
+        /// The color of the instance.
+        GRAPHICS::Color Color;
+    };
+    /// The number of floats of per-instance data for the instanced position-color shader program:
+    /// 16 for the world transform (4 rows of 4 elements) followed by 4 for the instance color.
+    const unsigned int INSTANCE_FLOAT_COUNT = static_cast<unsigned int>(sizeof(PositionColorInstance) / sizeof(float));
+    static_assert(20 == INSTANCE_FLOAT_COUNT, "Instance data must be tightly packed floats.");
 
-    /// A description of a shader program that accepts vertices with position and color attributes.
-    extern const ShaderProgramDescription VERTEX_POSITION_COLOR_SHADER_DESCRIPTION;
+    /// The layout of GRAPHICS::Vertex for the position-color shader program.
+    extern const VertexLayout POSITION_COLOR_VERTEX_LAYOUT;
+    /// The layout of per-instance data for the position-color shader program with instancing enabled.
+    extern const VertexLayout POSITION_COLOR_INSTANCE_LAYOUT;
+    /// The layout of GRAPHICS::QuantizedVertex with 16-bit unsigned normalized positions and
+    /// 8-bit unsigned normalized colors, for the position-color shader program with quantized positions.
+    extern const VertexLayout UNORM16_POSITION_COLOR_VERTEX_LAYOUT;
+    /// The layout of GRAPHICS::QuantizedVertex with 16-bit half-float positions and
+    /// 8-bit unsigned normalized colors, for the position-color shader program with quantized positions.
+    extern const VertexLayout HALF_FLOAT_POSITION_COLOR_VERTEX_LAYOUT;
 }
 }
 }
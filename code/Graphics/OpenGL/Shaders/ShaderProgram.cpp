@@ -8,15 +8,29 @@ namespace SHADERS
 {
     /// Constructor.  The shaders are attached to this program.
     /// @param[in]  id - The ID of the shader program.
-    /// @param[in]  vertex_shader - The vertex shader.
-    /// @param[in]  fragment_shader - The fragment shader.
+    /// @param[in]  vertex_shader - The vertex shader.  Its ID may be invalid for programs
+    ///     loaded from binaries, in which case it is not attached.
+    /// @param[in]  fragment_shader - The fragment shader.  Its ID may be invalid for programs
+    ///     loaded from binaries, in which case it is not attached.
     ShaderProgram::ShaderProgram(const GLuint id, const SHADERS::VertexShader& vertex_shader, const SHADERS::FragmentShader& fragment_shader) :
         Id(id),
         VertexShader(vertex_shader),
-        FragmentShader(fragment_shader)
+        FragmentShader(fragment_shader),
+        VertexArrayId(INVALID_ID),
+        Status(ShaderProgramStatus::COMPILING),
+        CompileTimeInSeconds(0.0)
     {
-        glAttachShader(Id, vertex_shader.Id);
-        glAttachShader(Id, fragment_shader.Id);
+        bool vertex_shader_compiled = (INVALID_ID != vertex_shader.Id);
+        if (vertex_shader_compiled)
+        {
+            glAttachShader(Id, vertex_shader.Id);
+        }
+
+        bool fragment_shader_compiled = (INVALID_ID != fragment_shader.Id);
+        if (fragment_shader_compiled)
+        {
+            glAttachShader(Id, fragment_shader.Id);
+        }
     }
 
     /// Sets the fragment shader output color variable.
@@ -30,39 +44,93 @@ namespace SHADERS
             FragmentShader.OutputColorVariableName.c_str());
     }
 
-    /// Sets all vertex shader input variables to the program.
-    /// Should be called each time before rendering.
+    /// Assigns fixed locations to all vertex shader input variables, in the order they
+    /// appear in the vertex shader's layouts (per-vertex inputs followed by per-instance inputs).
+    /// This avoids needing to look up locations by name when rendering.  Should be called before linking.
+    void ShaderProgram::SetVertexInputLocations() const
+    {
+        for (std::size_t input_variable_index = 0; input_variable_index < VertexShader.InputVariables.size(); ++input_variable_index)
+        {
+            const VertexShaderInputVariable& input_variable = VertexShader.InputVariables[input_variable_index];
+            glBindAttribLocation(Id, static_cast<GLuint>(input_variable_index), input_variable.Name.c_str());
+        }
+
+        for (std::size_t instance_input_variable_index = 0; instance_input_variable_index < VertexShader.InstanceInputVariables.size(); ++instance_input_variable_index)
+        {
+            const VertexShaderInputVariable& instance_input_variable = VertexShader.InstanceInputVariables[instance_input_variable_index];
+            glBindAttribLocation(Id, InstanceInputLocation(instance_input_variable_index), instance_input_variable.Name.c_str());
+        }
+    }
+
+    /// Sets all vertex shader input variables to the program, relative to the currently
+    /// bound array buffer.  Only needed if separate vertex attribute formats aren't supported.
     void ShaderProgram::SetVertexInputs() const
     {
-        for (const auto& input_variable : VertexShader.InputVariables)
+        for (std::size_t input_variable_index = 0; input_variable_index < VertexShader.InputVariables.size(); ++input_variable_index)
         {
             SetVertexInput(
-                input_variable,
+                static_cast<GLuint>(input_variable_index),
+                VertexShader.InputVariables[input_variable_index],
                 VertexShader.VertexSizeInBytes);
         }
     }
 
+    /// Sets all per-instance vertex shader input variables to the program.
+    /// The buffer holding per-instance data must be bound as the current array
+    /// buffer before calling this method.  Requires instanced rendering support.
+    /// @param[in]  first_instance_byte_offset - The number of bytes from the start of the
+    ///     bound buffer to the data for the first instance to be drawn.
+    void ShaderProgram::SetInstanceInputs(const uint64_t first_instance_byte_offset) const
+    {
+        for (std::size_t instance_input_variable_index = 0; instance_input_variable_index < VertexShader.InstanceInputVariables.size(); ++instance_input_variable_index)
+        {
+            // SET THE INPUT VARIABLE.
+            GLuint instance_input_variable_location = InstanceInputLocation(instance_input_variable_index);
+            SetVertexInput(
+                instance_input_variable_location,
+                VertexShader.InstanceInputVariables[instance_input_variable_index],
+                VertexShader.InstanceSizeInBytes,
+                first_instance_byte_offset);
+
+            // ADVANCE THE INPUT VARIABLE ONCE PER INSTANCE RATHER THAN ONCE PER VERTEX.
+            const GLuint ADVANCE_ONCE_PER_INSTANCE = 1;
+            glVertexAttribDivisor(instance_input_variable_location, ADVANCE_ONCE_PER_INSTANCE);
+        }
+    }
+
     /// Sets the specified vertex shader input variable to the program.
+    /// @param[in]  input_variable_location - The location of the input variable in the program.
     /// @param[in]  input_variable - The input variable to set.
     /// @param[in]  vertex_size_in_bytes - The size of 1 vertex to the program, in bytes.
+    /// @param[in]  first_vertex_byte_offset - The number of bytes from the start of the
+    ///     bound buffer to the first vertex.
     void ShaderProgram::SetVertexInput(
+        const GLuint input_variable_location,
         const VertexShaderInputVariable& input_variable,
-        const unsigned int vertex_size_in_bytes) const
+        const unsigned int vertex_size_in_bytes,
+        const uint64_t first_vertex_byte_offset) const
     {
-        // GET THE ID OF THE INPUT VARIABLE IN THE PROGRAM.
-        GLint vertex_input_variable_id = glGetAttribLocation(Id, input_variable.Name.c_str());
-
         // DEFINE THE SPECIFICATION OF THE INPUT VARIABLE.
         glVertexAttribPointer(
-            vertex_input_variable_id,
+            input_variable_location,
             input_variable.ComponentCount,
-            GL_FLOAT,
-            GL_FALSE,
+            input_variable.ComponentType,
+            input_variable.Normalized,
             vertex_size_in_bytes,
-            (void*)input_variable.ByteOffsetToFirstComponent);
+            (void*)(first_vertex_byte_offset + input_variable.ByteOffsetToFirstComponent));
 
         // ENABLE THE VERTEX INPUT VARIABLE.
-        glEnableVertexAttribArray(vertex_input_variable_id);
+        glEnableVertexAttribArray(input_variable_location);
+    }
+
+    /// Gets the location of a per-instance input variable in the program.
+    /// Per-instance input variables are located after all per-vertex input variables.
+    /// @param[in]  instance_input_variable_index - The index of the variable in the vertex shader's instance inputs.
+    /// @return The location of the input variable.
+    GLuint ShaderProgram::InstanceInputLocation(const std::size_t instance_input_variable_index) const
+    {
+        GLuint instance_input_variable_location = static_cast<GLuint>(VertexShader.InputVariables.size() + instance_input_variable_index);
+        return instance_input_variable_location;
     }
 
     /// Sets the values for the specified uniform matrix variable.
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <gl/GL.h>
 #include "Graphics/OpenGL/Shaders/FragmentShader.h"
@@ -13,6 +14,17 @@ namespace OPEN_GL
 /// Holds code related to OpenGL shaders.
 namespace SHADERS
 {
+    /// The stages of creating a shader program.
+    enum class ShaderProgramStatus
+    {
+        /// The shader program is still being compiled and linked and can't yet be used.
+        COMPILING = 0,
+        /// The shader program was successfully compiled and linked and can be used.
+        READY,
+        /// Compiling or linking the shader program failed, so it can never be used.
+        FAILED
+    };
+
     /// A shader program consisting of 1 vertex shader and 1 fragment shader.
     /// Only shader programs with 1 vertex and 1 fragment shader are supported
     /// since more advanced kinds of shader programs are not yet needed.
@@ -24,7 +36,10 @@ namespace SHADERS
 
         // OTHER PUBLIC METHODS.
         void SetFragmentShaderOutputColorVariable() const;
+        void SetVertexInputLocations() const;
         void SetVertexInputs() const;
+        void SetInstanceInputs(const uint64_t first_instance_byte_offset = 0) const;
+        GLuint InstanceInputLocation(const std::size_t instance_input_variable_index) const;
         void SetUniformMatrix(
             const std::string& uniform_matrix_variable_name, 
             const MATH::Matrix4x4f& matrix) const;
@@ -36,12 +51,25 @@ namespace SHADERS
         class VertexShader VertexShader;
         /// The fragment shader.
         class FragmentShader FragmentShader;
+        /// The ID of the vertex array holding the formats of the vertex shader's inputs.
+        /// Shared by all shader programs with the same input formats.  INVALID_ID if
+        /// separate vertex attribute formats aren't supported, in which case inputs
+        /// are set relative to each vertex buffer as it is bound.
+        GLuint VertexArrayId;
+        /// Whether the shader program has finished compiling and linking.
+        /// Updated by the graphics device that created the shader program.
+        ShaderProgramStatus Status;
+        /// The time it took to compile and link the shader program, in seconds.
+        /// 0 if it is still compiling or was loaded from a binary instead.
+        double CompileTimeInSeconds;
 
     private:
         // PRIVATE METHODS.
         void SetVertexInput(
+            const GLuint input_variable_location,
             const VertexShaderInputVariable& input_variable,
-            const unsigned int vertex_size_in_bytes) const;
+            const unsigned int vertex_size_in_bytes,
+            const uint64_t first_vertex_byte_offset = 0) const;
     };
 }
 }
@@ -0,0 +1,290 @@
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+#include <Windows.h>
+#include "Graphics/OpenGL/Shaders/ShaderProgramBinaryCache.h"
+
+namespace GRAPHICS
+{
+namespace OPEN_GL
+{
+namespace SHADERS
+{
+    /// Attempts to create a shader program binary cache, creating its directory if needed.
+    /// @param[in]  directory_path - The path of the directory in which to store cached binaries.
+    /// @return The cache, if program binaries are supported; null otherwise.
+    std::unique_ptr<ShaderProgramBinaryCache> ShaderProgramBinaryCache::Create(const std::string& directory_path)
+    {
+        // MAKE SURE PROGRAM BINARIES ARE SUPPORTED.
+        bool program_binary_functions_loaded = (
+            (nullptr != glGetProgramBinary) &&
+            (nullptr != glProgramBinary) &&
+            (nullptr != glProgramParameteri));
+        if (!program_binary_functions_loaded)
+        {
+            return nullptr;
+        }
+
+        // Drivers may support the functions without supporting any binary formats.
+        GLint program_binary_format_count = 0;
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &program_binary_format_count);
+        bool program_binary_formats_supported = (program_binary_format_count > 0);
+        if (!program_binary_formats_supported)
+        {
+            return nullptr;
+        }
+
+        // MAKE SURE THE CACHE DIRECTORY EXISTS.
+        const LPSECURITY_ATTRIBUTES DEFAULT_SECURITY = NULL;
+        BOOL directory_created = CreateDirectoryA(directory_path.c_str(), DEFAULT_SECURITY);
+        bool directory_exists = directory_created || (ERROR_ALREADY_EXISTS == GetLastError());
+        if (!directory_exists)
+        {
+            return nullptr;
+        }
+
+        // IDENTIFY THE GRAPHICS DRIVER FROM THE CURRENT OPENGL CONTEXT.
+        std::string driver_identifier;
+        const GLenum DRIVER_STRING_NAMES[] = { GL_VENDOR, GL_RENDERER, GL_VERSION };
+        for (const GLenum driver_string_name : DRIVER_STRING_NAMES)
+        {
+            const GLubyte* driver_string = glGetString(driver_string_name);
+            bool driver_string_exists = (nullptr != driver_string);
+            if (driver_string_exists)
+            {
+                driver_identifier += reinterpret_cast<const char*>(driver_string);
+            }
+            driver_identifier += '\n';
+        }
+
+        // CREATE THE CACHE.
+        std::unique_ptr<ShaderProgramBinaryCache> cache = std::make_unique<ShaderProgramBinaryCache>(directory_path, driver_identifier);
+        return cache;
+    }
+
+    /// Constructor.
+    /// @param[in]  directory_path - The path of an existing directory in which to store cached binaries.
+    /// @param[in]  driver_identifier - Identifies the graphics driver and version that binaries are for.
+    ShaderProgramBinaryCache::ShaderProgramBinaryCache(const std::string& directory_path, const std::string& driver_identifier) :
+        HitCount(0),
+        MissCount(0),
+        RejectedCount(0),
+        CompileTimeInSeconds(0.0),
+        LoadTimeInSeconds(0.0),
+        TimeSavedInSeconds(0.0),
+        DirectoryPath(directory_path),
+        DriverIdentifier(driver_identifier)
+    {}
+
+    /// Computes the key identifying a shader program in the cache.  The key's hashes (using 64-bit
+    /// FNV-1a and sdbm) cover everything that affects the linked binary: the source code of both
+    /// shaders, the bound locations of inputs and outputs, the graphics driver and version, and
+    /// the file format.
+    /// @param[in]  shader_program_description - The description of the shader program.
+    /// @return The key for the shader program.
+    ShaderProgramBinaryCache::ProgramKey ShaderProgramBinaryCache::Key(const ShaderProgramDescription& shader_program_description) const
+    {
+        const uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+        const uint64_t FNV_PRIME = 1099511628211ULL;
+
+        // HASH EACH STRING ONE BYTE AT A TIME.
+        // Strings are terminated in the hashes so that adjacent strings can't run together.
+        ProgramKey key;
+        key.Hash = FNV_OFFSET_BASIS;
+        key.CheckHash = 0;
+        auto hash_byte = [&key](const uint8_t byte)
+        {
+            key.Hash ^= byte;
+            key.Hash *= FNV_PRIME;
+
+            const unsigned int SDBM_FIRST_SHIFT = 6;
+            const unsigned int SDBM_SECOND_SHIFT = 16;
+            key.CheckHash = byte + (key.CheckHash << SDBM_FIRST_SHIFT) + (key.CheckHash << SDBM_SECOND_SHIFT) - key.CheckHash;
+        };
+        auto hash_string = [&hash_byte](const std::string& text)
+        {
+            for (const char character : text)
+            {
+                hash_byte(static_cast<uint8_t>(character));
+            }
+            const uint8_t STRING_TERMINATOR = 0;
+            hash_byte(STRING_TERMINATOR);
+        };
+        hash_string(std::to_string(FILE_FORMAT_VERSION));
+        hash_string(DriverIdentifier);
+        hash_string(shader_program_description.VertexShader.UncompiledCode);
+        hash_string(shader_program_description.FragmentShader.UncompiledCode);
+        hash_string(shader_program_description.FragmentShader.OutputColorVariableName);
+
+        // Input locations are bound in the order of input variables, so their names determine the bindings.
+        for (const VertexShaderInputVariable& input_variable : shader_program_description.VertexShader.InputVariables)
+        {
+            hash_string(input_variable.Name);
+        }
+        hash_string("instance");
+        for (const VertexShaderInputVariable& instance_input_variable : shader_program_description.VertexShader.InstanceInputVariables)
+        {
+            hash_string(instance_input_variable.Name);
+        }
+
+        // RECORD THE SOURCE LENGTHS.
+        key.VertexShaderSourceLength = static_cast<uint32_t>(shader_program_description.VertexShader.UncompiledCode.size());
+        key.FragmentShaderSourceLength = static_cast<uint32_t>(shader_program_description.FragmentShader.UncompiledCode.size());
+        return key;
+    }
+
+    /// Attempts to load a cached binary into a shader program.
+    /// @param[in]  shader_program_id - The ID of a newly created shader program with no shaders attached.
+    /// @param[in]  key - The key of the shader program in the cache.
+    /// @return True if the shader program was loaded and linked; false if it must be compiled from source.
+    ///     The shader program can still be compiled and linked normally if loading fails.
+    bool ShaderProgramBinaryCache::Load(const GLuint shader_program_id, const ProgramKey& key)
+    {
+        auto load_start_time = std::chrono::high_resolution_clock::now();
+
+        // OPEN THE CACHED BINARY FILE.
+        std::ifstream binary_file(FilePath(key.Hash), std::ios::binary);
+        bool binary_file_opened = binary_file.is_open();
+        if (!binary_file_opened)
+        {
+            ++MissCount;
+            return false;
+        }
+
+        // READ THE HEADER.
+        // The file name only covers the main hash, so everything else in the key is checked
+        // too in case of a collision or a stale file, since a driver could accept the binary
+        // of a different program and link it without any error.
+        FileHeader header = {};
+        binary_file.read(reinterpret_cast<char*>(&header), sizeof(header));
+        bool header_valid = (
+            binary_file.good() &&
+            (FILE_FORMAT_VERSION == header.FileFormatVersion) &&
+            (key.Hash == header.Key.Hash) &&
+            (key.CheckHash == header.Key.CheckHash) &&
+            (key.VertexShaderSourceLength == header.Key.VertexShaderSourceLength) &&
+            (key.FragmentShaderSourceLength == header.Key.FragmentShaderSourceLength) &&
+            (DriverIdentifier.size() == header.DriverIdentifierSizeInBytes) &&
+            (header.BinarySizeInBytes > 0));
+        if (!header_valid)
+        {
+            ++MissCount;
+            return false;
+        }
+
+        // MAKE SURE THE BINARY WAS STORED BY THE SAME DRIVER.
+        std::string stored_driver_identifier(header.DriverIdentifierSizeInBytes, '\0');
+        binary_file.read(&stored_driver_identifier[0], stored_driver_identifier.size());
+        bool driver_matches = (binary_file.good() && (DriverIdentifier == stored_driver_identifier));
+        if (!driver_matches)
+        {
+            ++MissCount;
+            return false;
+        }
+
+        // READ THE BINARY.
+        std::vector<char> binary(header.BinarySizeInBytes);
+        binary_file.read(binary.data(), binary.size());
+        bool binary_read = binary_file.good();
+        if (!binary_read)
+        {
+            ++MissCount;
+            return false;
+        }
+
+        // LOAD THE BINARY INTO THE SHADER PROGRAM.
+        glProgramBinary(
+            shader_program_id,
+            static_cast<GLenum>(header.BinaryFormat),
+            binary.data(),
+            static_cast<GLsizei>(binary.size()));
+
+        // CHECK IF THE DRIVER ACCEPTED THE BINARY.
+        GLint link_status = GL_FALSE;
+        glGetProgramiv(shader_program_id, GL_LINK_STATUS, &link_status);
+        bool binary_accepted = (GL_TRUE == link_status);
+        if (!binary_accepted)
+        {
+            ++RejectedCount;
+            ++MissCount;
+            return false;
+        }
+
+        // RECORD THE TIME SAVED.
+        auto load_end_time = std::chrono::high_resolution_clock::now();
+        double load_time_in_seconds = std::chrono::duration_cast<std::chrono::duration<double>>(load_end_time - load_start_time).count();
+        const double MICROSECONDS_PER_SECOND = 1000000.0;
+        double compile_time_in_seconds = static_cast<double>(header.CompileTimeInMicroseconds) / MICROSECONDS_PER_SECOND;
+        ++HitCount;
+        LoadTimeInSeconds += load_time_in_seconds;
+        TimeSavedInSeconds += (compile_time_in_seconds - load_time_in_seconds);
+        return true;
+    }
+
+    /// Stores the binary of a linked shader program in the cache.  The program should have been
+    /// linked with GL_PROGRAM_BINARY_RETRIEVABLE_HINT set.  Failures are ignored since the
+    /// program will simply be compiled from source again on the next run.
+    /// @param[in]  shader_program_id - The ID of the successfully linked shader program.
+    /// @param[in]  key - The key of the shader program in the cache.
+    /// @param[in]  compile_time_in_seconds - The time it took to compile and link the shader program.
+    void ShaderProgramBinaryCache::Store(const GLuint shader_program_id, const ProgramKey& key, const double compile_time_in_seconds)
+    {
+        CompileTimeInSeconds += compile_time_in_seconds;
+
+        // GET THE BINARY FROM THE DRIVER.
+        GLint binary_size_in_bytes = 0;
+        glGetProgramiv(shader_program_id, GL_PROGRAM_BINARY_LENGTH, &binary_size_in_bytes);
+        bool binary_available = (binary_size_in_bytes > 0);
+        if (!binary_available)
+        {
+            return;
+        }
+
+        std::vector<char> binary(static_cast<std::size_t>(binary_size_in_bytes));
+        GLsizei retrieved_binary_size_in_bytes = 0;
+        GLenum binary_format = 0;
+        glGetProgramBinary(
+            shader_program_id,
+            binary_size_in_bytes,
+            &retrieved_binary_size_in_bytes,
+            &binary_format,
+            binary.data());
+        bool binary_retrieved = (retrieved_binary_size_in_bytes > 0);
+        if (!binary_retrieved)
+        {
+            return;
+        }
+
+        // WRITE THE BINARY FILE.
+        const double MICROSECONDS_PER_SECOND = 1000000.0;
+        FileHeader header = {};
+        header.FileFormatVersion = FILE_FORMAT_VERSION;
+        header.BinaryFormat = static_cast<uint32_t>(binary_format);
+        header.BinarySizeInBytes = static_cast<uint32_t>(retrieved_binary_size_in_bytes);
+        header.DriverIdentifierSizeInBytes = static_cast<uint32_t>(DriverIdentifier.size());
+        header.Key = key;
+        header.CompileTimeInMicroseconds = static_cast<uint64_t>(compile_time_in_seconds * MICROSECONDS_PER_SECOND);
+
+        std::ofstream binary_file(FilePath(key.Hash), std::ios::binary | std::ios::trunc);
+        binary_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        binary_file.write(DriverIdentifier.data(), DriverIdentifier.size());
+        binary_file.write(binary.data(), retrieved_binary_size_in_bytes);
+    }
+
+    /// Gets the path of the file for a key in the cache.
+    /// @param[in]  key_hash - The main hash of the shader program's key in the cache.
+    /// @return The path of the cached binary file.
+    std::string ShaderProgramBinaryCache::FilePath(const uint64_t key_hash) const
+    {
+        const int HEX_DIGITS_PER_KEY = 16;
+        std::ostringstream file_path;
+        file_path << DirectoryPath << '\\';
+        file_path << std::hex << std::setw(HEX_DIGITS_PER_KEY) << std::setfill('0') << key_hash;
+        file_path << ".bin";
+        return file_path.str();
+    }
+}
+}
+}
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "Graphics/OpenGL/OpenGL.h"
+#include "Graphics/OpenGL/Shaders/ShaderProgramDescription.h"
+
+namespace GRAPHICS
+{
+namespace OPEN_GL
+{
+namespace SHADERS
+{
+    /// Caches linked shader programs as driver-specific binaries on disk so that
+    /// later runs can load them instead of compiling and linking from source.
+    ///
+    /// Each binary is stored in its own file named after a key that hashes the program's
+    /// source code, its input bindings, and the graphics driver and version, so changes
+    /// to any of these simply result in a cache miss.  Since a driver may accept a binary
+    /// for a different program without error, each file also records the driver identifier,
+    /// a second independent hash, and the source lengths, and any mismatch is treated as a
+    /// miss rather than trusting the file name alone.  Drivers may still reject a cached
+    /// binary (for example, after a driver update that didn't change its version string),
+    /// in which case the program must be compiled from source and stored again.
+    ///
+    /// Requires OpenGL 4.1 or ARB_get_program_binary with at least one binary format.
+    class ShaderProgramBinaryCache
+    {
+    public:
+        // PUBLIC TYPES.
+        /// Identifies a shader program in the cache.
+        struct ProgramKey
+        {
+            /// A 64-bit FNV-1a hash of everything affecting the binary, which names its file.
+            uint64_t Hash = 0;
+            /// A 64-bit sdbm hash of the same data, for detecting collisions of the main hash.
+            uint64_t CheckHash = 0;
+            /// The length of the vertex shader's source code, in characters.
+            uint32_t VertexShaderSourceLength = 0;
+            /// The length of the fragment shader's source code, in characters.
+            uint32_t FragmentShaderSourceLength = 0;
+        };
+
+        // CONSTRUCTION.
+        static std::unique_ptr<ShaderProgramBinaryCache> Create(const std::string& directory_path);
+        explicit ShaderProgramBinaryCache(const std::string& directory_path, const std::string& driver_identifier);
+
+        // CACHING.
+        ProgramKey Key(const ShaderProgramDescription& shader_program_description) const;
+        bool Load(const GLuint shader_program_id, const ProgramKey& key);
+        void Store(const GLuint shader_program_id, const ProgramKey& key, const double compile_time_in_seconds);
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The number of shader programs successfully loaded from the cache.
+        unsigned int HitCount;
+        /// The number of shader programs that had to be compiled from source,
+        /// including any whose cached binaries were rejected.
+        unsigned int MissCount;
+        /// The number of cached binaries that were rejected by the driver.
+        unsigned int RejectedCount;
+        /// The total time spent compiling and linking shader programs for cache misses, in seconds.
+        double CompileTimeInSeconds;
+        /// The total time spent loading shader programs for cache hits, in seconds.
+        double LoadTimeInSeconds;
+        /// The total compile time avoided by cache hits (the compile time recorded when each
+        /// binary was stored, minus the time to load it), in seconds.
+        double TimeSavedInSeconds;
+
+    private:
+        // PRIVATE TYPES.
+        /// The header at the start of each cached binary file.  The driver identifier follows
+        /// the header, and the binary follows the driver identifier.
+        struct FileHeader
+        {
+            /// The version of the file format, for rejecting files from older versions of this code.
+            uint32_t FileFormatVersion;
+            /// The driver-specific format of the binary.
+            uint32_t BinaryFormat;
+            /// The size of the binary following the driver identifier, in bytes.
+            uint32_t BinarySizeInBytes;
+            /// The size of the driver identifier following the header, in bytes.
+            uint32_t DriverIdentifierSizeInBytes;
+            /// The key under which the binary was stored, for detecting mismatched files.
+            ProgramKey Key;
+            /// The time it took to compile and link the program from source, in microseconds.
+            uint64_t CompileTimeInMicroseconds;
+        };
+
+        // CONSTANTS.
+        /// The current version of the cached binary file format.
+        static const uint32_t FILE_FORMAT_VERSION = 2;
+
+        // HELPER METHODS.
+        std::string FilePath(const uint64_t key_hash) const;
+
+        // MEMBER VARIABLES.
+        /// The path of the directory holding cached binary files.
+        std::string DirectoryPath;
+        /// Identifies the graphics driver and version, since binaries are only valid for a single driver.
+        std::string DriverIdentifier;
+    };
+}
+}
+}
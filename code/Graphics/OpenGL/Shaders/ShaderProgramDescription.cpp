@@ -1,3 +1,4 @@
+#include <algorithm>
 #include "Graphics/OpenGL/Shaders/ShaderProgramDescription.h"
 
 namespace GRAPHICS
@@ -6,15 +7,101 @@ namespace OPEN_GL
 {
 namespace SHADERS
 {
-    /// Constructor.
+    // Defined here since std::min() takes it by reference, which requires a definition
+    // outside the class until inline variables are available.
+    const std::size_t ShaderProgramDescription::MAX_FEATURE_COUNT;
+
+    /// Constructor for a shader program without optional features.
     /// @param[in]  vertex_shader - The description of the vertex shader.
     /// @param[in]  fragment_shader - The description of the fragment shader.
     ShaderProgramDescription::ShaderProgramDescription(
         const VertexShaderDescription& vertex_shader,
         const FragmentShaderDescription& fragment_shader) :
     VertexShader(vertex_shader),
-    FragmentShader(fragment_shader)
+    FragmentShader(fragment_shader),
+    FeatureDefineNames()
+    {}
+
+    /// Constructor for a shader program with optional features.
+    /// @param[in]  vertex_shader - The description of the vertex shader.
+    /// @param[in]  fragment_shader - The description of the fragment shader.
+    /// @param[in]  feature_define_names - The names of preprocessor defines for optional features,
+    ///     in order of their bits in feature masks.  Only the first MAX_FEATURE_COUNT are used.
+    ShaderProgramDescription::ShaderProgramDescription(
+        const VertexShaderDescription& vertex_shader,
+        const FragmentShaderDescription& fragment_shader,
+        const std::vector<std::string>& feature_define_names) :
+    VertexShader(vertex_shader),
+    FragmentShader(fragment_shader),
+    FeatureDefineNames(feature_define_names)
     {}
+
+    /// Gets a feature mask with bits set for all optional features of the shader program.
+    /// @return The feature mask for all features.
+    uint32_t ShaderProgramDescription::AllFeatureBits() const
+    {
+        uint32_t all_feature_bits = 0;
+        std::size_t feature_count = std::min(FeatureDefineNames.size(), MAX_FEATURE_COUNT);
+        for (std::size_t feature_index = 0; feature_index < feature_count; ++feature_index)
+        {
+            all_feature_bits |= (1u << feature_index);
+        }
+        return all_feature_bits;
+    }
+
+    /// Creates a permutation of the shader program with the specified optional features
+    /// enabled by defining their preprocessor defines in both shaders.
+    /// @param[in]  feature_bits - The mask of features to enable.  Bits without features are ignored.
+    /// @return The description of the shader program with the features enabled.
+    ShaderProgramDescription ShaderProgramDescription::Permutation(const uint32_t feature_bits) const
+    {
+        // BUILD THE DEFINES FOR ENABLED FEATURES.
+        std::string feature_defines;
+        std::size_t feature_count = std::min(FeatureDefineNames.size(), MAX_FEATURE_COUNT);
+        for (std::size_t feature_index = 0; feature_index < feature_count; ++feature_index)
+        {
+            bool feature_enabled = (0 != (feature_bits & (1u << feature_index)));
+            if (feature_enabled)
+            {
+                feature_defines += "#define " + FeatureDefineNames[feature_index] + " 1\n";
+            }
+        }
+
+        // ADD THE DEFINES TO BOTH SHADERS.
+        ShaderProgramDescription permutation = *this;
+        permutation.VertexShader.UncompiledCode = InsertAfterVersionDirective(feature_defines, VertexShader.UncompiledCode);
+        permutation.FragmentShader.UncompiledCode = InsertAfterVersionDirective(feature_defines, FragmentShader.UncompiledCode);
+        return permutation;
+    }
+
+    /// Inserts lines of code into shader source code.  Since the #version directive must
+    /// come before anything other than comments, the lines are inserted right after it.
+    /// @param[in]  lines - The lines of code to insert, each ending with a newline.
+    /// @param[in]  source_code - The source code in which to insert the lines.
+    /// @return The source code with the lines inserted.
+    std::string ShaderProgramDescription::InsertAfterVersionDirective(const std::string& lines, const std::string& source_code)
+    {
+        // FIND THE END OF THE VERSION DIRECTIVE.
+        // Shaders without a version directive can have the lines inserted at the start.
+        std::size_t version_directive_start_index = source_code.find("#version");
+        bool version_directive_exists = (std::string::npos != version_directive_start_index);
+        if (!version_directive_exists)
+        {
+            return lines + source_code;
+        }
+
+        std::size_t version_directive_end_index = source_code.find('\n', version_directive_start_index);
+        bool version_directive_ends_source_code = (std::string::npos == version_directive_end_index);
+        if (version_directive_ends_source_code)
+        {
+            return source_code + '\n' + lines;
+        }
+
+        // INSERT THE LINES AFTER THE VERSION DIRECTIVE.
+        std::string modified_source_code = source_code;
+        modified_source_code.insert(version_directive_end_index + 1, lines);
+        return modified_source_code;
+    }
 }
 }
 }
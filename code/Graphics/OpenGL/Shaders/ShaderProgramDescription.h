@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cstdint>
+#include <string>
+#include <vector>
 #include "Graphics/OpenGL/Shaders/FragmentShaderDescription.h"
 #include "Graphics/OpenGL/Shaders/VertexShaderDescription.h"
 
@@ -12,13 +15,25 @@ namespace SHADERS
     /// A description of a shader program.
     /// Only shader programs with 1 vertex and 1 fragment shader are supported
     /// since more advanced kinds of shader programs are not yet needed.
+    ///
+    /// A description may list optional features that its source code enables via
+    /// preprocessor defines (for example, "#ifdef VERTEX_ALPHA").  Permutations of the
+    /// description with different features enabled can then be created from the same
+    /// source code rather than duplicating code for each combination of features.
     struct ShaderProgramDescription
     {
+        // CONSTANTS.
+        /// The maximum number of optional features, limited by the bits in a feature mask.
+        static const std::size_t MAX_FEATURE_COUNT = 32;
+
         // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
         /// The description of the vertex shader.
         VertexShaderDescription VertexShader;
         /// The description of the fragment shader.
         FragmentShaderDescription FragmentShader;
+        /// The names of preprocessor defines for optional features.  Bit N of a feature mask
+        /// enables the feature named by element N.  Empty if there are no optional features.
+        std::vector<std::string> FeatureDefineNames;
 
         // CONSTRUCTION.
         // A constructor requiring all member variables is defined to make
@@ -28,6 +43,18 @@ namespace SHADERS
         explicit ShaderProgramDescription(
             const VertexShaderDescription& vertex_shader,
             const FragmentShaderDescription& fragment_shader);
+        explicit ShaderProgramDescription(
+            const VertexShaderDescription& vertex_shader,
+            const FragmentShaderDescription& fragment_shader,
+            const std::vector<std::string>& feature_define_names);
+
+        // PERMUTATIONS.
+        uint32_t AllFeatureBits() const;
+        ShaderProgramDescription Permutation(const uint32_t feature_bits) const;
+
+    private:
+        // HELPER METHODS.
+        static std::string InsertAfterVersionDirective(const std::string& lines, const std::string& source_code);
     };
 }
 }
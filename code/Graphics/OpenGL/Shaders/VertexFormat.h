@@ -0,0 +1,159 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "Graphics/Color.h"
+#include "Graphics/OpenGL/OpenGL.h"
+#include "Graphics/OpenGL/Shaders/VertexShaderInputVariable.h"
+#include "Math/Vector2.h"
+#include "Math/Vector3.h"
+
+namespace GRAPHICS
+{
+namespace OPEN_GL
+{
+namespace SHADERS
+{
+    /// Describes how a graphics device reads a vertex attribute of a given C++ type.
+    /// The description is determined at compile time from the type, so attributes never
+    /// need hand-computed component counts or types.  Specializations exist for each
+    /// supported attribute type; using any other type is a compile error.
+    /// @tparam AttributeType - The type of the attribute's member in a vertex struct.
+    template <typename AttributeType>
+    struct VertexAttributeFormat;
+
+    /// The format of a vertex attribute with the specified number of float components.
+    /// @tparam ComponentCount - The number of float components in the attribute.
+    template <GLint ComponentCount>
+    struct FloatVertexAttributeFormat
+    {
+        /// The number of components in the attribute.
+        static const GLint COMPONENT_COUNT = ComponentCount;
+        /// The type of each component.
+        static const GLenum COMPONENT_TYPE = GL_FLOAT;
+        /// The size of each component, in bytes.
+        static const std::size_t COMPONENT_SIZE_IN_BYTES = sizeof(float);
+        /// Whether or not components are normalized when read.
+        static const GLboolean NORMALIZED = GL_FALSE;
+    };
+
+    /// The format of 2D vectors, such as texture coordinates.
+    template <>
+    struct VertexAttributeFormat<MATH::Vector2f> : public FloatVertexAttributeFormat<2>
+    {};
+
+    /// The format of 3D vectors, such as positions or normals.
+    template <>
+    struct VertexAttributeFormat<MATH::Vector3f> : public FloatVertexAttributeFormat<3>
+    {};
+
+    /// The format of colors.
+    template <>
+    struct VertexAttributeFormat<GRAPHICS::Color> : public FloatVertexAttributeFormat<4>
+    {};
+
+    /// The format of arrays of 4 floats, such as rows of matrices.
+    template <>
+    struct VertexAttributeFormat<float[4]> : public FloatVertexAttributeFormat<4>
+    {};
+
+    /// The format of arrays of 4 16-bit unsigned normalized integers.
+    template <>
+    struct VertexAttributeFormat<uint16_t[4]>
+    {
+        /// The number of components in the attribute.
+        static const GLint COMPONENT_COUNT = 4;
+        /// The type of each component.
+        static const GLenum COMPONENT_TYPE = GL_UNSIGNED_SHORT;
+        /// The size of each component, in bytes.
+        static const std::size_t COMPONENT_SIZE_IN_BYTES = sizeof(uint16_t);
+        /// Whether or not components are normalized when read.
+        static const GLboolean NORMALIZED = GL_TRUE;
+    };
+
+    /// The format of arrays of 4 8-bit unsigned normalized integers.
+    template <>
+    struct VertexAttributeFormat<uint8_t[4]>
+    {
+        /// The number of components in the attribute.
+        static const GLint COMPONENT_COUNT = 4;
+        /// The type of each component.
+        static const GLenum COMPONENT_TYPE = GL_UNSIGNED_BYTE;
+        /// The size of each component, in bytes.
+        static const std::size_t COMPONENT_SIZE_IN_BYTES = sizeof(uint8_t);
+        /// Whether or not components are normalized when read.
+        static const GLboolean NORMALIZED = GL_TRUE;
+    };
+
+    /// The format of an attribute whose 16-bit components hold half-precision floats
+    /// rather than the integers normally implied by the attribute's type.
+    /// @tparam AttributeType - The type of the attribute's member in a vertex struct.
+    template <typename AttributeType>
+    struct HalfFloatVertexAttributeFormat
+    {
+        /// The number of components in the attribute.
+        static const GLint COMPONENT_COUNT = VertexAttributeFormat<AttributeType>::COMPONENT_COUNT;
+        /// The type of each component.
+        static const GLenum COMPONENT_TYPE = GL_HALF_FLOAT;
+        /// The size of each component, in bytes.
+        static const std::size_t COMPONENT_SIZE_IN_BYTES = sizeof(uint16_t);
+        /// Whether or not components are normalized when read.
+        static const GLboolean NORMALIZED = GL_FALSE;
+    };
+
+    /// Describes a vertex attribute as an input variable to a vertex shader,
+    /// with its format derived from the type of the attribute.
+    /// @tparam AttributeType - The type of the attribute's member in a vertex struct.
+    /// @tparam AttributeFormat - The format of the attribute.  Defaults to the format for the attribute's type.
+    /// @param[in]  name - The name of the input variable in the vertex shader.
+    /// @param[in]  byte_offset - The offset of the attribute's member in the vertex struct (from offsetof).
+    /// @return The description of the input variable.
+    template <typename AttributeType, typename AttributeFormat = VertexAttributeFormat<AttributeType>>
+    VertexShaderInputVariable DescribeVertexAttribute(const std::string& name, const std::size_t byte_offset)
+    {
+        static_assert(
+            sizeof(AttributeType) == AttributeFormat::COMPONENT_COUNT * AttributeFormat::COMPONENT_SIZE_IN_BYTES,
+            "Vertex attribute type must be tightly packed components of its format.");
+
+        VertexShaderInputVariable input_variable(
+            name,
+            AttributeFormat::COMPONENT_COUNT,
+            byte_offset,
+            AttributeFormat::COMPONENT_TYPE,
+            AttributeFormat::NORMALIZED);
+        return input_variable;
+    }
+
+    /// The layout of vertices (or per-instance data) in a buffer read by a vertex shader.
+    struct VertexLayout
+    {
+        // CONSTRUCTION.
+        /// Creates the layout for a vertex struct from descriptions of its attributes.
+        /// @tparam VertexType - The type of vertex struct.  Must be copyable directly into buffers.
+        /// @param[in]  input_variables - Descriptions of the attributes in the struct.
+        /// @return The layout of the vertex struct.
+        template <typename VertexType>
+        static VertexLayout Of(const std::initializer_list<VertexShaderInputVariable>& input_variables)
+        {
+            static_assert(std::is_trivially_copyable<VertexType>::value, "Vertex types must be trivially copyable to be copied directly into buffers.");
+            static_assert(std::is_standard_layout<VertexType>::value, "Vertex types must have a standard layout for their member offsets to be well-defined.");
+
+            VertexLayout layout;
+            layout.SizeInBytes = static_cast<unsigned int>(sizeof(VertexType));
+            layout.InputVariables = input_variables;
+            return layout;
+        }
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The size of each vertex, in bytes.
+        unsigned int SizeInBytes = 0;
+        /// The input variables for each attribute of the vertex.
+        std::vector<VertexShaderInputVariable> InputVariables = {};
+    };
+}
+}
+}
@@ -9,14 +9,21 @@ namespace SHADERS
     /// Constructor.
     /// @param[in]  id - The ID of the vertex shader.
     /// @param[in]  vertex_size_in_bytes - The size of each vertex, in bytes.
-    /// @param[in]  input_variables - All of the input variables to the vertex shader.
+    /// @param[in]  input_variables - All of the per-vertex input variables to the vertex shader.
+    /// @param[in]  instance_size_in_bytes - The size of the data for each instance, in bytes
+    ///     (0 if the shader is not used for instanced rendering).
+    /// @param[in]  instance_input_variables - All of the per-instance input variables to the vertex shader.
     VertexShader::VertexShader(
         const GLuint id,
         const unsigned int vertex_size_in_bytes,
-        const std::vector<VertexShaderInputVariable>& input_variables) :
+        const std::vector<VertexShaderInputVariable>& input_variables,
+        const unsigned int instance_size_in_bytes,
+        const std::vector<VertexShaderInputVariable>& instance_input_variables) :
     Id(id),
     VertexSizeInBytes(vertex_size_in_bytes),
-    InputVariables(input_variables)
+    InputVariables(input_variables),
+    InstanceSizeInBytes(instance_size_in_bytes),
+    InstanceInputVariables(instance_input_variables)
     {}
 }
 }
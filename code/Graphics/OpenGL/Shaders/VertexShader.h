@@ -18,7 +18,9 @@ namespace SHADERS
         explicit VertexShader(
             const GLuint id,
             const unsigned int vertex_size_in_bytes,
-            const std::vector<VertexShaderInputVariable>& input_variables);
+            const std::vector<VertexShaderInputVariable>& input_variables,
+            const unsigned int instance_size_in_bytes,
+            const std::vector<VertexShaderInputVariable>& instance_input_variables);
 
         // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
         /// The ID of the vertex shader.
@@ -27,6 +29,10 @@ namespace SHADERS
         unsigned int VertexSizeInBytes;
         /// All of the input variables to the vertex shader.
         std::vector<VertexShaderInputVariable> InputVariables;
+        /// The size of the data for each instance, in bytes (0 if not used for instancing).
+        unsigned int InstanceSizeInBytes;
+        /// All of the per-instance input variables to the vertex shader.
+        std::vector<VertexShaderInputVariable> InstanceInputVariables;
     };
 }
 }
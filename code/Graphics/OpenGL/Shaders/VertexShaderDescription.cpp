@@ -8,15 +8,30 @@ namespace SHADERS
 {
     /// Constructor.
     /// @param[in]  uncompiled_code - The uncompiled source code of the vertex shader.
-    /// @param[in]  vertex_size_in_bytes - The size of each vertex, in bytes.
-    /// @param[in]  input_variables - All of the input variables to the vertex shader.
+    /// @param[in]  vertex_layout - The layout of vertices input to the vertex shader.
     VertexShaderDescription::VertexShaderDescription(
         const std::string& uncompiled_code,
-        const unsigned int vertex_size_in_bytes,
-        const std::initializer_list<VertexShaderInputVariable>& input_variables) :
+        const VertexLayout& vertex_layout) :
     UncompiledCode(uncompiled_code),
-    VertexSizeInBytes(vertex_size_in_bytes),
-    InputVariables(input_variables)
+    VertexSizeInBytes(vertex_layout.SizeInBytes),
+    InputVariables(vertex_layout.InputVariables),
+    InstanceSizeInBytes(0),
+    InstanceInputVariables()
+    {}
+
+    /// Constructor for a vertex shader used for instanced rendering.
+    /// @param[in]  uncompiled_code - The uncompiled source code of the vertex shader.
+    /// @param[in]  vertex_layout - The layout of vertices input to the vertex shader.
+    /// @param[in]  instance_layout - The layout of per-instance data input to the vertex shader.
+    VertexShaderDescription::VertexShaderDescription(
+        const std::string& uncompiled_code,
+        const VertexLayout& vertex_layout,
+        const VertexLayout& instance_layout) :
+    UncompiledCode(uncompiled_code),
+    VertexSizeInBytes(vertex_layout.SizeInBytes),
+    InputVariables(vertex_layout.InputVariables),
+    InstanceSizeInBytes(instance_layout.SizeInBytes),
+    InstanceInputVariables(instance_layout.InputVariables)
     {}
 }
 }
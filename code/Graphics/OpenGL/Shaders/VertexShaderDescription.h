@@ -1,8 +1,8 @@
 #pragma once
 
-#include <initializer_list>
 #include <string>
 #include <vector>
+#include "Graphics/OpenGL/Shaders/VertexFormat.h"
 #include "Graphics/OpenGL/Shaders/VertexShaderInputVariable.h"
 
 namespace GRAPHICS
@@ -21,6 +21,12 @@ namespace SHADERS
         unsigned int VertexSizeInBytes;
         /// All of the input variables to the vertex shader.
         std::vector<VertexShaderInputVariable> InputVariables;
+        /// The size of the data for each instance, in bytes.
+        /// Only relevant for shaders used for instanced rendering (0 otherwise).
+        unsigned int InstanceSizeInBytes;
+        /// All of the input variables to the vertex shader that advance per instance
+        /// rather than per vertex.  Empty for shaders not used for instanced rendering.
+        std::vector<VertexShaderInputVariable> InstanceInputVariables;
 
         // CONSTRUCTION.
         // A constructor requiring all member variables is defined to make
@@ -29,8 +35,11 @@ namespace SHADERS
         // separate lines).
         explicit VertexShaderDescription(
             const std::string& uncompiled_code,
-            const unsigned int vertex_size_in_bytes,
-            const std::initializer_list<VertexShaderInputVariable>& input_variables);
+            const VertexLayout& vertex_layout);
+        explicit VertexShaderDescription(
+            const std::string& uncompiled_code,
+            const VertexLayout& vertex_layout,
+            const VertexLayout& instance_layout);
     };
 }
 }
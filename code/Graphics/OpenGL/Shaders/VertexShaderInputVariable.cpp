@@ -6,7 +6,7 @@ namespace OPEN_GL
 {
 namespace SHADERS
 {
-    /// Constructor.
+    /// Constructor for a variable whose components are stored as floats.
     /// @param[in]  name - The name of the variable.
     /// @param[in]  component_count - The number of components that the variable can hold.
     /// @param[in]  byte_offset_to_first_component - The number of bytes from the start of
@@ -17,7 +17,29 @@ namespace SHADERS
         const uint64_t byte_offset_to_first_component) :
     Name(name),
     ComponentCount(component_count),
-    ByteOffsetToFirstComponent(byte_offset_to_first_component)
+    ByteOffsetToFirstComponent(byte_offset_to_first_component),
+    ComponentType(GL_FLOAT),
+    Normalized(GL_FALSE)
+    {}
+
+    /// Constructor for a variable whose components may be stored in a compressed type.
+    /// @param[in]  name - The name of the variable.
+    /// @param[in]  component_count - The number of components that the variable can hold.
+    /// @param[in]  byte_offset_to_first_component - The number of bytes from the start of
+    ///     the vertex data to the first component of this variable.
+    /// @param[in]  component_type - The type of each component in the vertex data.
+    /// @param[in]  normalized - True if integer components should be normalized when read by the shader.
+    VertexShaderInputVariable::VertexShaderInputVariable(
+        const std::string& name,
+        const int component_count,
+        const uint64_t byte_offset_to_first_component,
+        const GLenum component_type,
+        const GLboolean normalized) :
+    Name(name),
+    ComponentCount(component_count),
+    ByteOffsetToFirstComponent(byte_offset_to_first_component),
+    ComponentType(component_type),
+    Normalized(normalized)
     {}
 }
 }
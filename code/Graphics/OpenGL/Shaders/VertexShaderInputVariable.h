@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <string>
+#include "Graphics/OpenGL/OpenGL.h"
 
 namespace GRAPHICS
 {
@@ -24,6 +25,11 @@ namespace SHADERS
         /// to a vertex shader that is a floating-point vec3, this offset
         /// should be 3 * sizeof(float).
         uint64_t ByteOffsetToFirstComponent;
+        /// The type of each component in the vertex data (for example, GL_FLOAT).
+        GLenum ComponentType;
+        /// True if integer components are normalized to [0, 1] (or [-1, 1] for signed types)
+        /// when read by the shader; false if converted directly to floating-point values.
+        GLboolean Normalized;
 
         // CONSTRUCTION.
         // A constructor requiring all member variables is defined to make
@@ -34,6 +40,12 @@ namespace SHADERS
             const std::string& name,
             const int component_count,
             const uint64_t byte_offset_to_first_component);
+        explicit VertexShaderInputVariable(
+            const std::string& name,
+            const int component_count,
+            const uint64_t byte_offset_to_first_component,
+            const GLenum component_type,
+            const GLboolean normalized);
     };
 }
 }
@@ -0,0 +1,112 @@
+#include <algorithm>
+#include "ErrorHandling/NullChecking.h"
+#include "Graphics/OpenGL/StaticMeshBatch.h"
+
+namespace GRAPHICS
+{
+namespace OPEN_GL
+{
+    /// Constructor for an initially empty batch.
+    /// @param[in]  shader_program - The shader program used to draw the batch.
+    /// @throws std::exception - Thrown if the shader program is null.
+    StaticMeshBatch::StaticMeshBatch(const std::shared_ptr<SHADERS::ShaderProgram>& shader_program) :
+    ShaderProgram(shader_program),
+    MergedVertexBuffer(),
+    MergedVertexCount(0),
+    RebuildCount(0),
+    Members(),
+    SubmittedObjects()
+    {
+        // MAKE SURE REQUIRED PARAMETERS WERE PROVIDED.
+        ERROR_HANDLING::ThrowInvalidArgumentExceptionIfNull(
+            ShaderProgram,
+            "Shader program cannot be null for static mesh batch.");
+    }
+
+    /// Determines if the provided object is small enough to be held in a batch.
+    /// @param[in]  object_3D - The object to check.
+    /// @return True if the object can be batched; false otherwise.
+    bool StaticMeshBatch::CanHold(const GRAPHICS::Object3D& object_3D)
+    {
+        bool object_small_enough = (object_3D.GetVertices().size() <= MAX_VERTEX_COUNT_PER_OBJECT);
+        return object_small_enough;
+    }
+
+    /// Submits an object for drawing as part of this batch.
+    /// @param[in]  object_3D - The object to submit.  It must remain at the same
+    ///     address and not be modified while in the batch.
+    void StaticMeshBatch::Submit(const GRAPHICS::Object3D& object_3D)
+    {
+        SubmittedObjects.push_back(&object_3D);
+    }
+
+    /// Updates the batch for drawing the currently submitted objects.  The merged
+    /// vertex buffer is only rebuilt if the submitted objects differ from the
+    /// objects already in the batch.
+    /// @param[in]  graphics_device - The graphics device on which to create the merged vertex buffer.
+    /// @return True if the batch has vertices that are ready to be drawn; false otherwise.
+    bool StaticMeshBatch::Update(OPEN_GL::GraphicsDevice& graphics_device)
+    {
+        // CHECK IF THE MEMBERSHIP OF THE BATCH HAS CHANGED.
+        // Submitted objects are sorted so that the order of submissions doesn't matter.
+        std::sort(SubmittedObjects.begin(), SubmittedObjects.end());
+        bool membership_changed = (SubmittedObjects != Members);
+        if (membership_changed)
+        {
+            Rebuild(graphics_device);
+        }
+
+        // CHECK IF THE BATCH CAN BE DRAWN.
+        bool merged_vertex_buffer_exists = (nullptr != MergedVertexBuffer);
+        bool vertices_exist = (MergedVertexCount > 0);
+        bool batch_drawable = (merged_vertex_buffer_exists && vertices_exist);
+        return batch_drawable;
+    }
+
+    /// Clears all submitted objects.  Should be called after drawing the batch
+    /// each frame so that the next frame's submissions start empty.
+    void StaticMeshBatch::ClearSubmittedObjects()
+    {
+        SubmittedObjects.clear();
+    }
+
+    /// Rebuilds the merged vertex buffer from the submitted objects.
+    /// @param[in]  graphics_device - The graphics device on which to create the merged vertex buffer.
+    void StaticMeshBatch::Rebuild(OPEN_GL::GraphicsDevice& graphics_device)
+    {
+        // UPDATE THE MEMBERS OF THE BATCH.
+        Members = SubmittedObjects;
+
+        // PRE-TRANSFORM ALL OBJECT VERTICES INTO WORLD SPACE.
+        std::vector<GRAPHICS::Vertex> merged_vertices;
+        for (const GRAPHICS::Object3D* object_3D : Members)
+        {
+            MATH::Matrix4x4f world_transform = object_3D->WorldTransform();
+            for (const auto& vertex : object_3D->GetVertices())
+            {
+                MATH::Vector3f world_space_position = world_transform.TransformPoint(vertex.ObjectSpacePosition);
+                merged_vertices.emplace_back(world_space_position, vertex.Color);
+            }
+        }
+
+        // MAKE SURE A MERGED VERTEX BUFFER EXISTS.
+        // The same buffer is reused across rebuilds.
+        bool merged_vertex_buffer_exists = (nullptr != MergedVertexBuffer);
+        if (!merged_vertex_buffer_exists)
+        {
+            MergedVertexBuffer = graphics_device.CreateVertexBuffer();
+            merged_vertex_buffer_exists = (nullptr != MergedVertexBuffer);
+            if (!merged_vertex_buffer_exists)
+            {
+                MergedVertexCount = 0;
+                return;
+            }
+        }
+
+        // FILL THE MERGED VERTEX BUFFER.
+        MergedVertexBuffer->Fill(merged_vertices);
+        MergedVertexCount = static_cast<GLsizei>(merged_vertices.size());
+        ++RebuildCount;
+    }
+}
+}
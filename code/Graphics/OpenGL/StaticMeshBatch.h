@@ -0,0 +1,65 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include "Graphics/Object3D.h"
+#include "Graphics/OpenGL/GraphicsDevice.h"
+#include "Graphics/OpenGL/OpenGL.h"
+#include "Graphics/OpenGL/Shaders/ShaderProgram.h"
+#include "Graphics/OpenGL/VertexBuffer.h"
+
+namespace GRAPHICS
+{
+namespace OPEN_GL
+{
+    /// A batch of small, static 3D objects that all get drawn with the same shader program.
+    /// The vertices of all objects in the batch are pre-transformed into world space and
+    /// merged into a single large vertex buffer, so the entire batch can be drawn with
+    /// a single draw call.
+    ///
+    /// Objects are submitted to the batch each frame, and the merged vertex buffer is only
+    /// rebuilt when the set of submitted objects changes.  Since objects are assumed to be
+    /// static, changes to the vertices or transforms of objects already in the batch are
+    /// not detected.
+    class StaticMeshBatch
+    {
+    public:
+        // CONSTANTS.
+        /// The maximum number of vertices an object may have to be considered small enough
+        /// for batching.  Larger objects gain little from batching and would make rebuilds
+        /// more expensive.
+        static const std::size_t MAX_VERTEX_COUNT_PER_OBJECT = 64;
+
+        // CONSTRUCTION.
+        explicit StaticMeshBatch(const std::shared_ptr<SHADERS::ShaderProgram>& shader_program);
+
+        // BATCHING.
+        static bool CanHold(const GRAPHICS::Object3D& object_3D);
+        void Submit(const GRAPHICS::Object3D& object_3D);
+        bool Update(OPEN_GL::GraphicsDevice& graphics_device);
+        void ClearSubmittedObjects();
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The shader program used to draw the batch.
+        std::shared_ptr<SHADERS::ShaderProgram> ShaderProgram;
+        /// The vertex buffer holding the merged, world-space vertices of all objects in the batch.
+        /// Null until the batch is first built.
+        std::shared_ptr<VertexBuffer> MergedVertexBuffer;
+        /// The number of vertices in the merged vertex buffer.
+        GLsizei MergedVertexCount;
+        /// The number of times the merged vertex buffer has been rebuilt.
+        unsigned int RebuildCount;
+
+    private:
+        // HELPER METHODS.
+        void Rebuild(OPEN_GL::GraphicsDevice& graphics_device);
+
+        // MEMBER VARIABLES.
+        /// The objects whose vertices are currently in the merged vertex buffer,
+        /// sorted by address.
+        std::vector<const GRAPHICS::Object3D*> Members;
+        /// The objects submitted for drawing since submissions were last cleared.
+        std::vector<const GRAPHICS::Object3D*> SubmittedObjects;
+    };
+}
+}
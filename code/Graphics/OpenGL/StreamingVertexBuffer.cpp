@@ -0,0 +1,167 @@
+#include <cstring>
+#include <stdexcept>
+#include "Graphics/OpenGL/StreamingVertexBuffer.h"
+
+namespace GRAPHICS
+{
+namespace OPEN_GL
+{
+    /// Constructor.
+    /// @param[in]  array_id - The ID of the vertex array associated with this buffer.
+    /// @param[in]  buffer_id - The ID of the vertex buffer.
+    /// @param[in]  mapped_vertex_data - The persistently mapped memory for the entire buffer.
+    /// @param[in]  max_vertex_count_per_region - The maximum number of vertices that
+    ///     can be held in a single region of the buffer.
+    StreamingVertexBuffer::StreamingVertexBuffer(
+        const GLuint array_id,
+        const GLuint buffer_id,
+        float* const mapped_vertex_data,
+        const unsigned int max_vertex_count_per_region) :
+    ArrayId(array_id),
+    BufferId(buffer_id),
+    MappedVertexData(mapped_vertex_data),
+    MaxVertexCountPerRegion(max_vertex_count_per_region),
+    RegionFences(),
+    // The last region is initially current so that the first write goes to the first region.
+    CurrentRegionIndex(REGION_COUNT - 1),
+    CurrentRegionWrittenVertexCount(0),
+    LastWrittenFrameNumber(UINT64_MAX)
+    {}
+
+    /// Begins writing vertices to the next region of the buffer.  If the graphics
+    /// device may still be reading from that region, this method waits until the
+    /// device has finished.
+    /// @param[in]  frame_number - The number of the frame in which the region will be drawn.
+    /// @return A pointer to the start of the region's mapped memory.  Up to
+    ///     MaxVertexCountPerRegion vertices (in FLOAT_COUNT_PER_VERTEX floats each)
+    ///     may be written before calling EndWrite().
+    /// @throws std::logic_error - Thrown if a region was already written in the same frame.
+    float* StreamingVertexBuffer::BeginWrite(const uint64_t frame_number)
+    {
+        // MAKE SURE ONLY ONE REGION IS WRITTEN PER FRAME.
+        // Writing more would cycle through the ring faster than frames complete,
+        // eventually waiting on a region that a frame in flight is still reading.
+        bool region_already_written_this_frame = (LastWrittenFrameNumber == frame_number);
+        if (region_already_written_this_frame)
+        {
+            throw std::logic_error("Streaming vertex buffer written more than once in a frame.");
+        }
+        LastWrittenFrameNumber = frame_number;
+
+        // MOVE TO THE NEXT REGION IN THE RING.
+        CurrentRegionIndex = (CurrentRegionIndex + 1) % REGION_COUNT;
+        CurrentRegionWrittenVertexCount = 0;
+
+        // WAIT FOR THE GRAPHICS DEVICE TO FINISH READING FROM THE REGION.
+        WaitForRegion(CurrentRegionIndex);
+
+        // RETURN THE START OF THE REGION'S MEMORY.
+        std::size_t region_float_count = static_cast<std::size_t>(MaxVertexCountPerRegion) * FLOAT_COUNT_PER_VERTEX;
+        float* region_vertex_data = MappedVertexData + (CurrentRegionIndex * region_float_count);
+        return region_vertex_data;
+    }
+
+    /// Finishes writing vertices to the current region of the buffer.
+    /// Since the buffer is coherently mapped, no explicit flushing is needed.
+    /// @param[in]  vertex_count - The number of vertices that were written to the region.
+    /// @throws std::out_of_range - Thrown if the vertex count exceeds the capacity of a region.
+    void StreamingVertexBuffer::EndWrite(const unsigned int vertex_count)
+    {
+        bool vertex_count_fits_in_region = (vertex_count <= MaxVertexCountPerRegion);
+        if (!vertex_count_fits_in_region)
+        {
+            throw std::out_of_range("Too many vertices written to streaming vertex buffer region.");
+        }
+
+        CurrentRegionWrittenVertexCount = vertex_count;
+    }
+
+    /// Fills the next region of this buffer with the provided vertices.
+    /// Vertices are copied directly into the mapped buffer memory since
+    /// their layout matches the buffer's layout.
+    /// @param[in]  vertices - The vertices to place in the buffer.
+    /// @param[in]  frame_number - The number of the frame in which the vertices will be drawn.
+    /// @throws std::out_of_range - Thrown if there are too many vertices to fit in a region.
+    /// @throws std::logic_error - Thrown if a region was already written in the same frame.
+    void StreamingVertexBuffer::Fill(const std::vector<GRAPHICS::Vertex>& vertices, const uint64_t frame_number)
+    {
+        // MAKE SURE THE VERTICES WILL FIT IN A REGION.
+        // This is checked before writing to avoid writing past the end of the mapped memory.
+        bool vertices_fit_in_region = (vertices.size() <= MaxVertexCountPerRegion);
+        if (!vertices_fit_in_region)
+        {
+            throw std::out_of_range("Too many vertices for streaming vertex buffer region.");
+        }
+
+        // COPY THE VERTICES DIRECTLY INTO THE MAPPED MEMORY.
+        float* vertex_data = BeginWrite(frame_number);
+        std::memcpy(vertex_data, vertices.data(), vertices.size() * sizeof(GRAPHICS::Vertex));
+
+        unsigned int vertex_count = static_cast<unsigned int>(vertices.size());
+        EndWrite(vertex_count);
+    }
+
+    /// Gets the index of the first vertex in the current region, relative to the start
+    /// of the entire buffer.  This is the first vertex that should be used when drawing.
+    /// @return The index of the first vertex in the current region.
+    GLint StreamingVertexBuffer::CurrentRegionFirstVertex() const
+    {
+        GLint first_vertex = static_cast<GLint>(CurrentRegionIndex * MaxVertexCountPerRegion);
+        return first_vertex;
+    }
+
+    /// Gets the number of vertices written to the current region.
+    /// @return The number of vertices in the current region.
+    GLsizei StreamingVertexBuffer::CurrentRegionVertexCount() const
+    {
+        return static_cast<GLsizei>(CurrentRegionWrittenVertexCount);
+    }
+
+    /// Inserts a fence to guard the current region.  Should be called after issuing
+    /// all draw commands that read from the current region so that the region is
+    /// not overwritten until those commands complete.
+    void StreamingVertexBuffer::FenceCurrentRegion()
+    {
+        // REPLACE ANY PREVIOUS FENCE FOR THE REGION.
+        // Only the most recent fence matters since it is signaled after any earlier ones.
+        GLsync& region_fence = RegionFences[CurrentRegionIndex];
+        bool previous_fence_exists = (nullptr != region_fence);
+        if (previous_fence_exists)
+        {
+            glDeleteSync(region_fence);
+        }
+
+        const GLbitfield NO_FLAGS = 0;
+        region_fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, NO_FLAGS);
+    }
+
+    /// Waits for the graphics device to finish all commands guarded by the specified region's fence.
+    /// @param[in]  region_index - The index of the region to wait for.
+    void StreamingVertexBuffer::WaitForRegion(const unsigned int region_index)
+    {
+        // CHECK IF THE REGION IS GUARDED BY A FENCE.
+        GLsync& region_fence = RegionFences[region_index];
+        bool region_fenced = (nullptr != region_fence);
+        if (!region_fenced)
+        {
+            // The graphics device isn't using the region, so no waiting is needed.
+            return;
+        }
+
+        // WAIT FOR THE FENCE TO BE SIGNALED.
+        // Commands are flushed on the first wait to guarantee that the fence eventually gets signaled.
+        // Waiting is done in a loop with a timeout to avoid potentially blocking forever in the driver.
+        const GLuint64 ONE_SECOND_IN_NANOSECONDS = 1000000000;
+        GLenum wait_result = glClientWaitSync(region_fence, GL_SYNC_FLUSH_COMMANDS_BIT, ONE_SECOND_IN_NANOSECONDS);
+        while (GL_TIMEOUT_EXPIRED == wait_result)
+        {
+            const GLbitfield NO_FLAGS = 0;
+            wait_result = glClientWaitSync(region_fence, NO_FLAGS, ONE_SECOND_IN_NANOSECONDS);
+        }
+
+        // DELETE THE FENCE SINCE IT IS NO LONGER NEEDED.
+        glDeleteSync(region_fence);
+        region_fence = nullptr;
+    }
+}
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+#include "Graphics/OpenGL/OpenGL.h"
+#include "Graphics/Vertex.h"
+
+namespace GRAPHICS
+{
+namespace OPEN_GL
+{
+    /// A buffer on a graphics device for holding vertices that change frequently
+    /// (potentially every frame).  Unlike a regular VertexBuffer, the storage for
+    /// this buffer is allocated only once and remains persistently mapped, so
+    /// vertices can be written directly into memory visible to the graphics device
+    /// without any intermediate copies or reallocations of driver memory.
+    ///
+    /// To avoid overwriting vertices that the graphics device may still be reading,
+    /// the buffer is split into multiple regions that are cycled through as a ring.
+    /// Each region is guarded by a fence that gets signaled once all draw commands
+    /// reading from that region have completed.  Only one region may be written
+    /// per frame so that a region is never reused while a frame in flight may
+    /// still be reading it (which would force waiting on the graphics device).
+    class StreamingVertexBuffer
+    {
+    public:
+        // CONSTANTS.
+        /// The number of regions in the buffer.  3 regions (triple-buffering) allow
+        /// one region to be written while the graphics device may still be reading
+        /// from the 2 regions written previously.
+        static const unsigned int REGION_COUNT = 3;
+        /// The number of floating-point components per vertex in the buffer
+        /// (3 for position and 4 for color).
+        static const unsigned int FLOAT_COUNT_PER_VERTEX = 7;
+
+        // CONSTRUCTION.
+        explicit StreamingVertexBuffer(
+            const GLuint array_id,
+            const GLuint buffer_id,
+            float* const mapped_vertex_data,
+            const unsigned int max_vertex_count_per_region);
+
+        // WRITING.
+        float* BeginWrite(const uint64_t frame_number);
+        void EndWrite(const unsigned int vertex_count);
+        void Fill(const std::vector<GRAPHICS::Vertex>& vertices, const uint64_t frame_number);
+
+        // DRAWING.
+        GLint CurrentRegionFirstVertex() const;
+        GLsizei CurrentRegionVertexCount() const;
+        void FenceCurrentRegion();
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The ID of the vertex array associated with this buffer.
+        GLuint ArrayId;
+        /// The ID of the vertex buffer.
+        GLuint BufferId;
+        /// The persistently mapped memory for the entire buffer (all regions).
+        float* MappedVertexData;
+        /// The maximum number of vertices that can be held in a single region.
+        unsigned int MaxVertexCountPerRegion;
+        /// The fences guarding each region.  Null if the graphics device is not
+        /// known to be using a region.
+        std::array<GLsync, REGION_COUNT> RegionFences;
+
+    private:
+        // HELPER METHODS.
+        void WaitForRegion(const unsigned int region_index);
+
+        // MEMBER VARIABLES.
+        /// The index of the region currently being written or drawn.
+        unsigned int CurrentRegionIndex;
+        /// The number of vertices written to the current region.
+        unsigned int CurrentRegionWrittenVertexCount;
+        /// The number of the frame in which a region was last written.
+        /// UINT64_MAX if no region has been written yet.
+        uint64_t LastWrittenFrameNumber;
+    };
+}
+}
@@ -13,26 +13,87 @@ namespace OPEN_GL
     {};
 
     /// Fills this vertex buffer with the data in the provided vertices.
+    /// Vertices are uploaded directly since their layout matches the buffer's layout.
     /// @param[in]  vertices - The vertices to place in the buffer.
     void VertexBuffer::Fill(const std::vector<GRAPHICS::Vertex>& vertices) const
     {
-        // CONVERT THE VERTICES TO A RAW DATA FORMAT THAT CAN BE PLACED IN THE BUFFER.
-        std::vector<float> vertex_data;
-        for (const auto& vertex : vertices)
+        GLsizeiptr vertex_data_size_in_bytes = static_cast<GLsizeiptr>(vertices.size() * VERTEX_SIZE_IN_BYTES);
+        SetData(vertex_data_size_in_bytes, vertices.data());
+    }
+
+    /// Fills this vertex buffer with the data in the provided quantized vertices.
+    /// Other methods assume regular vertices, so they should not be used on this buffer afterward.
+    /// @param[in]  quantized_vertices - The quantized vertices to place in the buffer.
+    void VertexBuffer::Fill(const std::vector<GRAPHICS::QuantizedVertex>& quantized_vertices) const
+    {
+        GLsizeiptr vertex_data_size_in_bytes = static_cast<GLsizeiptr>(quantized_vertices.size() * sizeof(GRAPHICS::QuantizedVertex));
+        SetData(vertex_data_size_in_bytes, quantized_vertices.data());
+    }
+
+    /// Fills this vertex buffer with only the provided vertex positions.
+    /// Other methods assume regular vertices, so they should not be used on this buffer afterward.
+    /// @param[in]  positions - The vertex positions to place in the buffer.
+    void VertexBuffer::Fill(const std::vector<MATH::Vector3f>& positions) const
+    {
+        GLsizeiptr vertex_data_size_in_bytes = static_cast<GLsizeiptr>(positions.size() * sizeof(MATH::Vector3f));
+        SetData(vertex_data_size_in_bytes, positions.data());
+    }
+
+    /// Allocates storage in this vertex buffer for the specified number of vertices,
+    /// without filling it.  Any previous contents are discarded.
+    /// @param[in]  vertex_count - The number of vertices to allocate storage for.
+    void VertexBuffer::Reserve(const unsigned int vertex_count) const
+    {
+        GLsizeiptr vertex_data_size_in_bytes = static_cast<GLsizeiptr>(vertex_count * VERTEX_SIZE_IN_BYTES);
+        const void* const NO_INITIAL_DATA = nullptr;
+        SetData(vertex_data_size_in_bytes, NO_INITIAL_DATA);
+    }
+
+    /// Fills part of this vertex buffer with the data in the provided vertices.
+    /// Storage for the range must have already been allocated via Fill() or Reserve().
+    /// @param[in]  first_vertex - The index of the first vertex in the buffer to fill.
+    /// @param[in]  vertices - The vertices to place in the buffer.
+    void VertexBuffer::FillRange(const unsigned int first_vertex, const std::vector<GRAPHICS::Vertex>& vertices) const
+    {
+        FillRange(first_vertex, vertices.data(), vertices.size());
+    }
+
+    /// Fills part of this vertex buffer with the data in the provided vertices.
+    /// Storage for the range must have already been allocated via Fill() or Reserve().
+    /// Vertices are uploaded directly since their layout matches the buffer's layout.
+    /// @param[in]  first_vertex - The index of the first vertex in the buffer to fill.
+    /// @param[in]  vertices - The vertices to place in the buffer.
+    /// @param[in]  vertex_count - The number of vertices to place in the buffer.
+    void VertexBuffer::FillRange(const unsigned int first_vertex, const GRAPHICS::Vertex* const vertices, const std::size_t vertex_count) const
+    {
+        GLintptr first_vertex_byte_offset = static_cast<GLintptr>(first_vertex * VERTEX_SIZE_IN_BYTES);
+        GLsizeiptr vertex_data_size_in_bytes = static_cast<GLsizeiptr>(vertex_count * VERTEX_SIZE_IN_BYTES);
+        if (DirectStateAccessSupported())
+        {
+            glNamedBufferSubData(BufferId, first_vertex_byte_offset, vertex_data_size_in_bytes, vertices);
+        }
+        else
         {
-            vertex_data.push_back(vertex.ObjectSpacePosition.X);
-            vertex_data.push_back(vertex.ObjectSpacePosition.Y);
-            vertex_data.push_back(vertex.ObjectSpacePosition.Z);
-            vertex_data.push_back(vertex.Color.Red);
-            vertex_data.push_back(vertex.Color.Green);
-            vertex_data.push_back(vertex.Color.Blue);
-            vertex_data.push_back(vertex.Color.Alpha);
+            glBindBuffer(GL_ARRAY_BUFFER, BufferId);
+            glBufferSubData(GL_ARRAY_BUFFER, first_vertex_byte_offset, vertex_data_size_in_bytes, vertices);
         }
+    }
 
-        // FILL THE BUFFER WITH THE VERTEX DATA.
-        GLsizeiptr vertex_data_size_in_bytes = sizeof(float) * vertex_data.size();
-        glBindBuffer(GL_ARRAY_BUFFER, BufferId);
-        glBufferData(GL_ARRAY_BUFFER, vertex_data_size_in_bytes, vertex_data.data(), GL_STATIC_DRAW);
+    /// Replaces the storage of this vertex buffer.  With direct state access, this is done
+    /// without binding the buffer so that bindings used for drawing are undisturbed.
+    /// @param[in]  size_in_bytes - The size of the new storage, in bytes.
+    /// @param[in]  data - The data to place in the storage.  May be null to leave it uninitialized.
+    void VertexBuffer::SetData(const GLsizeiptr size_in_bytes, const void* const data) const
+    {
+        if (DirectStateAccessSupported())
+        {
+            glNamedBufferData(BufferId, size_in_bytes, data, GL_STATIC_DRAW);
+        }
+        else
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, BufferId);
+            glBufferData(GL_ARRAY_BUFFER, size_in_bytes, data, GL_STATIC_DRAW);
+        }
     }
 }
 }
@@ -1,14 +1,19 @@
 #pragma once
 
+#include <cstddef>
 #include <vector>
 #include "Graphics/OpenGL/OpenGL.h"
+#include "Graphics/QuantizedMesh.h"
 #include "Graphics/Vertex.h"
+#include "Math/Vector3.h"
 
 namespace GRAPHICS
 {
 namespace OPEN_GL
 {
     /// A buffer on a graphics device for holding vertices.
+    /// Buffers normally hold regular vertices, but they may instead hold
+    /// quantized vertices or only positions to be drawn with matching shader programs.
     /// This class holds both OpenGL vertex array and buffer IDs
     /// since it's easier to think of them together when thinking
     /// about how vertices get passed to graphics hardware,
@@ -20,14 +25,35 @@ namespace OPEN_GL
         // CONSTRUCTION.
         explicit VertexBuffer(const GLuint array_id, const GLuint buffer_id);
 
+        // CONSTANTS.
+        /// The number of floating-point components per vertex in the buffer
+        /// (3 for position and 4 for color).
+        static const unsigned int FLOAT_COUNT_PER_VERTEX = 7;
+        /// The size of a single vertex in the buffer.  Vertices are stored in
+        /// the buffer with exactly the same layout as GRAPHICS::Vertex.
+        static const std::size_t VERTEX_SIZE_IN_BYTES = sizeof(GRAPHICS::Vertex);
+
         // PUBLIC METHODS.
         void Fill(const std::vector<GRAPHICS::Vertex>& vertices) const;
+        void Fill(const std::vector<GRAPHICS::QuantizedVertex>& quantized_vertices) const;
+        void Fill(const std::vector<MATH::Vector3f>& positions) const;
+        void Reserve(const unsigned int vertex_count) const;
+        void FillRange(const unsigned int first_vertex, const std::vector<GRAPHICS::Vertex>& vertices) const;
+        void FillRange(const unsigned int first_vertex, const GRAPHICS::Vertex* const vertices, const std::size_t vertex_count) const;
 
         // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
         /// The ID of the vertex array associated with this buffer.
         GLuint ArrayId;
         /// The ID of the vertex buffer.
         GLuint BufferId;
+
+    private:
+        // HELPER METHODS.
+        void SetData(const GLsizeiptr size_in_bytes, const void* const data) const;
     };
+
+    static_assert(
+        VertexBuffer::FLOAT_COUNT_PER_VERTEX * sizeof(float) == VertexBuffer::VERTEX_SIZE_IN_BYTES,
+        "Vertex buffer vertex size must match the floats per vertex.");
 }
 }
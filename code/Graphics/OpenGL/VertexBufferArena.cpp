@@ -0,0 +1,301 @@
+#include <algorithm>
+#include "ErrorHandling/NullChecking.h"
+#include "Graphics/OpenGL/VertexBufferArena.h"
+
+namespace GRAPHICS
+{
+namespace OPEN_GL
+{
+    /// Constructor.  No pages are allocated until needed.
+    /// @param[in]  graphics_device - The graphics device on which to allocate pages.
+    /// @throws std::exception - Thrown if the graphics device is null.
+    VertexBufferArena::VertexBufferArena(const std::shared_ptr<OPEN_GL::GraphicsDevice>& graphics_device) :
+        MovedAllocationCount(0),
+        GraphicsDevice(graphics_device),
+        Pages(),
+        Allocations(),
+        FreeAllocationIds(),
+        NextDefragmentationAllocationId(0)
+    {
+        ERROR_HANDLING::ThrowInvalidArgumentExceptionIfNull(
+            GraphicsDevice,
+            "Graphics device cannot be null for vertex buffer arena.");
+    }
+
+    /// Destructor that frees all pages on the graphics device.
+    VertexBufferArena::~VertexBufferArena()
+    {
+        for (const auto& page : Pages)
+        {
+            bool page_exists = (nullptr != page);
+            if (page_exists)
+            {
+                GraphicsDevice->Destroy(page->Buffer);
+            }
+        }
+    }
+
+    /// Allocates a range in the arena and fills it with the provided vertices.
+    /// @param[in]  vertices - The vertices to place in the arena.
+    /// @return The ID of the allocation, if successful; INVALID_ALLOCATION_ID otherwise
+    ///     (including if there are no vertices or too many to fit in a single page).
+    uint32_t VertexBufferArena::Allocate(const std::vector<GRAPHICS::Vertex>& vertices)
+    {
+        // MAKE SURE THE VERTICES CAN FIT IN A PAGE.
+        bool vertices_fit_in_page = !vertices.empty() && (vertices.size() <= PAGE_VERTEX_COUNT);
+        if (!vertices_fit_in_page)
+        {
+            return INVALID_ALLOCATION_ID;
+        }
+
+        // ALLOCATE A RANGE OF THE ARENA, ADDING A NEW PAGE IF NEEDED.
+        unsigned int vertex_count = static_cast<unsigned int>(vertices.size());
+        std::size_t page_index = 0;
+        uint64_t first_vertex = 0;
+        bool range_allocated = AllocateFromPages(vertex_count, page_index, first_vertex);
+        if (!range_allocated)
+        {
+            // CREATE A NEW PAGE.
+            std::shared_ptr<OPEN_GL::VertexBuffer> page_buffer = GraphicsDevice->CreateVertexBuffer();
+            bool page_buffer_created = (nullptr != page_buffer);
+            if (!page_buffer_created)
+            {
+                return INVALID_ALLOCATION_ID;
+            }
+            page_buffer->Reserve(PAGE_VERTEX_COUNT);
+            std::unique_ptr<Page> new_page(new Page { page_buffer, BuddyAllocator(PAGE_VERTEX_COUNT, MIN_BLOCK_VERTEX_COUNT) });
+
+            // STORE THE PAGE, REUSING THE SLOT OF ANY PREVIOUSLY FREED PAGE.
+            auto free_page_slot = std::find(Pages.begin(), Pages.end(), nullptr);
+            page_index = static_cast<std::size_t>(free_page_slot - Pages.begin());
+            bool free_page_slot_exists = (Pages.end() != free_page_slot);
+            if (free_page_slot_exists)
+            {
+                *free_page_slot = std::move(new_page);
+            }
+            else
+            {
+                Pages.push_back(std::move(new_page));
+            }
+
+            // ALLOCATE FROM THE NEW PAGE.
+            Pages[page_index]->Allocator.Allocate(vertex_count, first_vertex);
+        }
+
+        // FILL THE RANGE WITH THE VERTICES.
+        Pages[page_index]->Buffer->FillRange(static_cast<unsigned int>(first_vertex), vertices);
+
+        // TRACK THE ALLOCATION.
+        uint32_t allocation_id = 0;
+        bool free_allocation_id_exists = !FreeAllocationIds.empty();
+        if (free_allocation_id_exists)
+        {
+            allocation_id = FreeAllocationIds.back();
+            FreeAllocationIds.pop_back();
+        }
+        else
+        {
+            allocation_id = static_cast<uint32_t>(Allocations.size());
+            Allocations.push_back(Allocation());
+        }
+
+        Allocation& allocation = Allocations[allocation_id];
+        allocation.InUse = true;
+        allocation.PageIndex = page_index;
+        allocation.FirstVertex = first_vertex;
+        allocation.VertexCount = vertex_count;
+        return allocation_id;
+    }
+
+    /// Frees a range in the arena.  Any pages that become empty are freed too.
+    /// @param[in]  allocation_id - The ID of the allocation to free.  Nothing happens if not allocated.
+    void VertexBufferArena::Free(const uint32_t allocation_id)
+    {
+        // MAKE SURE THE ALLOCATION EXISTS.
+        bool allocation_exists = (allocation_id < Allocations.size()) && Allocations[allocation_id].InUse;
+        if (!allocation_exists)
+        {
+            return;
+        }
+
+        // FREE THE RANGE.
+        Allocation& allocation = Allocations[allocation_id];
+        Pages[allocation.PageIndex]->Allocator.Free(allocation.FirstVertex);
+        allocation = Allocation();
+        FreeAllocationIds.push_back(allocation_id);
+
+        FreeEmptyPages();
+    }
+
+    /// Gets the current range of vertices for an allocation.
+    /// @param[in]  allocation_id - The ID of the allocation.
+    /// @return The range of the allocation; an invalid range with a null buffer if not allocated.
+    VertexBufferRange VertexBufferArena::Range(const uint32_t allocation_id) const
+    {
+        VertexBufferRange range;
+
+        bool allocation_exists = (allocation_id < Allocations.size()) && Allocations[allocation_id].InUse;
+        if (allocation_exists)
+        {
+            const Allocation& allocation = Allocations[allocation_id];
+            range.Buffer = Pages[allocation.PageIndex]->Buffer.get();
+            range.FirstVertex = static_cast<GLint>(allocation.FirstVertex);
+            range.VertexCount = static_cast<GLsizei>(allocation.VertexCount);
+        }
+
+        return range;
+    }
+
+    /// Gets the number of bytes an allocation takes up in the arena, including
+    /// space lost to rounding up to a block size.
+    /// @param[in]  allocation_id - The ID of the allocation.
+    /// @return The size of the allocation in bytes; 0 if not allocated.
+    uint64_t VertexBufferArena::AllocatedSizeInBytes(const uint32_t allocation_id) const
+    {
+        bool allocation_exists = (allocation_id < Allocations.size()) && Allocations[allocation_id].InUse;
+        if (!allocation_exists)
+        {
+            return 0;
+        }
+
+        const Allocation& allocation = Allocations[allocation_id];
+        uint64_t block_vertex_count = Pages[allocation.PageIndex]->Allocator.BlockSize(allocation.FirstVertex);
+        uint64_t allocated_size_in_bytes = block_vertex_count * VertexBuffer::VERTEX_SIZE_IN_BYTES;
+        return allocated_size_in_bytes;
+    }
+
+    /// Incrementally defragments the arena by moving allocations toward the start of
+    /// earlier pages, so that later pages can eventually be freed.  Only a limited number
+    /// of allocations are moved per call so that this can run a little each frame without
+    /// a noticeable cost.  Moves are done entirely on the graphics device, and since they
+    /// are ordered with other commands, draws already issued from old ranges are unaffected.
+    /// @param[in]  max_moved_allocation_count - The maximum number of allocations to move.
+    /// @return The number of allocations moved.
+    unsigned int VertexBufferArena::Defragment(const unsigned int max_moved_allocation_count)
+    {
+        // CHECK EACH ALLOCATION ONCE, RESUMING FROM WHERE THE LAST PASS ENDED.
+        unsigned int moved_allocation_count = 0;
+        std::size_t checked_allocation_count = 0;
+        while ((moved_allocation_count < max_moved_allocation_count) && (checked_allocation_count < Allocations.size()))
+        {
+            // GET THE NEXT ALLOCATION TO CHECK.
+            uint32_t allocation_id = NextDefragmentationAllocationId % static_cast<uint32_t>(Allocations.size());
+            NextDefragmentationAllocationId = allocation_id + 1;
+            ++checked_allocation_count;
+
+            Allocation& allocation = Allocations[allocation_id];
+            if (!allocation.InUse)
+            {
+                continue;
+            }
+
+            // TRY ALLOCATING A NEW RANGE FOR THE ALLOCATION FROM EXISTING PAGES.
+            std::size_t new_page_index = 0;
+            uint64_t new_first_vertex = 0;
+            bool new_range_allocated = AllocateFromPages(allocation.VertexCount, new_page_index, new_first_vertex);
+            if (!new_range_allocated)
+            {
+                continue;
+            }
+
+            // ONLY MOVE THE ALLOCATION IF IT WOULD END UP EARLIER IN THE ARENA.
+            bool new_range_earlier = (
+                (new_page_index < allocation.PageIndex) ||
+                ((new_page_index == allocation.PageIndex) && (new_first_vertex < allocation.FirstVertex)));
+            if (!new_range_earlier)
+            {
+                Pages[new_page_index]->Allocator.Free(new_first_vertex);
+                continue;
+            }
+
+            // COPY THE VERTICES TO THE NEW RANGE.
+            const VertexBuffer& old_buffer = *Pages[allocation.PageIndex]->Buffer;
+            const VertexBuffer& new_buffer = *Pages[new_page_index]->Buffer;
+            GLintptr old_byte_offset = static_cast<GLintptr>(allocation.FirstVertex * VertexBuffer::VERTEX_SIZE_IN_BYTES);
+            GLintptr new_byte_offset = static_cast<GLintptr>(new_first_vertex * VertexBuffer::VERTEX_SIZE_IN_BYTES);
+            GLsizeiptr size_in_bytes = static_cast<GLsizeiptr>(allocation.VertexCount * VertexBuffer::VERTEX_SIZE_IN_BYTES);
+            if (DirectStateAccessSupported())
+            {
+                glCopyNamedBufferSubData(old_buffer.BufferId, new_buffer.BufferId, old_byte_offset, new_byte_offset, size_in_bytes);
+            }
+            else
+            {
+                glBindBuffer(GL_COPY_READ_BUFFER, old_buffer.BufferId);
+                glBindBuffer(GL_COPY_WRITE_BUFFER, new_buffer.BufferId);
+                glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, old_byte_offset, new_byte_offset, size_in_bytes);
+            }
+
+            // FREE THE OLD RANGE.
+            Pages[allocation.PageIndex]->Allocator.Free(allocation.FirstVertex);
+            allocation.PageIndex = new_page_index;
+            allocation.FirstVertex = new_first_vertex;
+            ++moved_allocation_count;
+        }
+
+        // FREE ANY PAGES EMPTIED BY MOVING ALLOCATIONS.
+        FreeEmptyPages();
+        MovedAllocationCount += moved_allocation_count;
+        return moved_allocation_count;
+    }
+
+    /// Allocates a range from existing pages, preferring earlier pages.
+    /// @param[in]  vertex_count - The number of vertices to allocate.
+    /// @param[out] page_index - The index of the page the range was allocated from, if successful.
+    /// @param[out] first_vertex - The index of the first vertex of the range in the page, if successful.
+    /// @return True if a range was allocated; false if no existing page has enough free space.
+    bool VertexBufferArena::AllocateFromPages(const unsigned int vertex_count, std::size_t& page_index, uint64_t& first_vertex)
+    {
+        for (std::size_t current_page_index = 0; current_page_index < Pages.size(); ++current_page_index)
+        {
+            // SKIP FREED PAGES.
+            const std::unique_ptr<Page>& page = Pages[current_page_index];
+            bool page_exists = (nullptr != page);
+            if (!page_exists)
+            {
+                continue;
+            }
+
+            // TRY ALLOCATING FROM THE PAGE.
+            bool range_allocated = page->Allocator.Allocate(vertex_count, first_vertex);
+            if (range_allocated)
+            {
+                page_index = current_page_index;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /// Frees pages that no longer hold any allocations.  The first existing page is
+    /// always kept to avoid repeatedly freeing and recreating a page.
+    void VertexBufferArena::FreeEmptyPages()
+    {
+        bool first_existing_page_found = false;
+        for (auto& page : Pages)
+        {
+            // SKIP FREED PAGES.
+            bool page_exists = (nullptr != page);
+            if (!page_exists)
+            {
+                continue;
+            }
+
+            // KEEP THE FIRST EXISTING PAGE.
+            if (!first_existing_page_found)
+            {
+                first_existing_page_found = true;
+                continue;
+            }
+
+            // FREE THE PAGE IF IT IS EMPTY.
+            bool page_empty = page->Allocator.Empty();
+            if (page_empty)
+            {
+                GraphicsDevice->Destroy(page->Buffer);
+                page = nullptr;
+            }
+        }
+    }
+}
+}
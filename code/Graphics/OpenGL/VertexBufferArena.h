@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "Graphics/OpenGL/BuddyAllocator.h"
+#include "Graphics/OpenGL/GraphicsDevice.h"
+#include "Graphics/OpenGL/OpenGL.h"
+#include "Graphics/OpenGL/VertexBuffer.h"
+#include "Graphics/Vertex.h"
+
+namespace GRAPHICS
+{
+namespace OPEN_GL
+{
+    /// A range of vertices within a vertex buffer.
+    struct VertexBufferRange
+    {
+        /// The vertex buffer holding the vertices.  Null if the range is invalid.
+        const VertexBuffer* Buffer = nullptr;
+        /// The index of the first vertex of the range in the buffer.
+        GLint FirstVertex = 0;
+        /// The number of vertices in the range.
+        GLsizei VertexCount = 0;
+    };
+
+    /// Holds vertices for many objects in a few large vertex buffers ("pages") rather than
+    /// one small buffer per object.  This avoids many tiny allocations in the graphics driver,
+    /// and since all objects in a page share the page's vertex array, switching between
+    /// objects in the same page only requires changing the range of vertices drawn.
+    ///
+    /// Ranges within each page are sub-allocated with a buddy allocator.  Since allocations
+    /// may be moved by Defragment(), callers refer to them via IDs and must get the current
+    /// range of an allocation each time it is drawn.
+    class VertexBufferArena
+    {
+    public:
+        // CONSTANTS.
+        /// The number of vertices held by each page.
+        static const unsigned int PAGE_VERTEX_COUNT = 64 * 1024;
+        /// The smallest number of vertices that can be allocated.
+        static const unsigned int MIN_BLOCK_VERTEX_COUNT = 16;
+        /// The ID for an invalid allocation.
+        static const uint32_t INVALID_ALLOCATION_ID = UINT32_MAX;
+
+        // CONSTRUCTION.
+        explicit VertexBufferArena(const std::shared_ptr<OPEN_GL::GraphicsDevice>& graphics_device);
+        ~VertexBufferArena();
+
+        // ALLOCATION.
+        uint32_t Allocate(const std::vector<GRAPHICS::Vertex>& vertices);
+        void Free(const uint32_t allocation_id);
+        VertexBufferRange Range(const uint32_t allocation_id) const;
+        uint64_t AllocatedSizeInBytes(const uint32_t allocation_id) const;
+
+        // DEFRAGMENTATION.
+        unsigned int Defragment(const unsigned int max_moved_allocation_count);
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The total number of allocations that have been moved by defragmentation.
+        uint64_t MovedAllocationCount;
+
+    private:
+        // PRIVATE TYPES.
+        /// A single large vertex buffer from which ranges are sub-allocated.
+        struct Page
+        {
+            /// The vertex buffer for the page.
+            std::shared_ptr<OPEN_GL::VertexBuffer> Buffer;
+            /// The allocator for vertex ranges within the page.
+            BuddyAllocator Allocator;
+        };
+
+        /// A range of vertices allocated from a page.
+        struct Allocation
+        {
+            /// True if the allocation is in use; false if the allocation ID is free.
+            bool InUse = false;
+            /// The index of the page holding the allocation.
+            std::size_t PageIndex = 0;
+            /// The index of the first vertex of the allocation in the page.
+            uint64_t FirstVertex = 0;
+            /// The number of vertices in the allocation.
+            unsigned int VertexCount = 0;
+        };
+
+        // HELPER METHODS.
+        bool AllocateFromPages(const unsigned int vertex_count, std::size_t& page_index, uint64_t& first_vertex);
+        void FreeEmptyPages();
+
+        // MEMBER VARIABLES.
+        /// The graphics device on which pages are allocated.
+        std::shared_ptr<OPEN_GL::GraphicsDevice> GraphicsDevice;
+        /// All pages in the arena.  Pages freed when empty are left null so that
+        /// page indices of other allocations remain stable.
+        std::vector< std::unique_ptr<Page> > Pages;
+        /// All allocations, indexed by allocation ID.
+        std::vector<Allocation> Allocations;
+        /// The IDs of free allocations that can be reused.
+        std::vector<uint32_t> FreeAllocationIds;
+        /// The allocation ID at which the next defragmentation pass will resume.
+        uint32_t NextDefragmentationAllocationId;
+    };
+}
+}
@@ -0,0 +1,187 @@
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include "Graphics/QuantizedMesh.h"
+
+namespace GRAPHICS
+{
+    /// Compresses vertices into quantized vertices.
+    /// @param[in]  vertices - The vertices to compress.
+    /// @param[in]  position_format - The format in which to encode vertex positions.
+    /// @return The quantized mesh for the vertices.
+    QuantizedMesh QuantizedMesh::Encode(const std::vector<Vertex>& vertices, const QuantizedPositionFormat position_format)
+    {
+        QuantizedMesh quantized_mesh;
+        quantized_mesh.PositionFormat = position_format;
+
+        // CHECK IF THERE ARE ANY VERTICES TO ENCODE.
+        bool vertices_exist = !vertices.empty();
+        if (!vertices_exist)
+        {
+            return quantized_mesh;
+        }
+
+        // FIND THE BOUNDS OF THE VERTEX POSITIONS.
+        MATH::Vector3f min_position = vertices.front().ObjectSpacePosition;
+        MATH::Vector3f max_position = vertices.front().ObjectSpacePosition;
+        for (const auto& vertex : vertices)
+        {
+            min_position.X = std::min(min_position.X, vertex.ObjectSpacePosition.X);
+            min_position.Y = std::min(min_position.Y, vertex.ObjectSpacePosition.Y);
+            min_position.Z = std::min(min_position.Z, vertex.ObjectSpacePosition.Z);
+            max_position.X = std::max(max_position.X, vertex.ObjectSpacePosition.X);
+            max_position.Y = std::max(max_position.Y, vertex.ObjectSpacePosition.Y);
+            max_position.Z = std::max(max_position.Z, vertex.ObjectSpacePosition.Z);
+        }
+
+        // DETERMINE HOW POSITIONS MAP TO THE ENCODED RANGE.
+        // Unorm positions span the bounds (from 0 at the minimum to 1 at the maximum),
+        // whereas half-float positions are relative to the center of the bounds (from -1 at
+        // the minimum to 1 at the maximum).  Scaling half-float positions keeps meshes of any
+        // size within half-float range while spending its precision on the mesh's own extent.
+        // Flat axes are given a non-zero size to avoid dividing by zero.
+        auto axis_size = [](const float min, const float max) { return (max > min) ? (max - min) : 1.0f; };
+        MATH::Vector3f bounds_size(
+            axis_size(min_position.X, max_position.X),
+            axis_size(min_position.Y, max_position.Y),
+            axis_size(min_position.Z, max_position.Z));
+        MATH::Vector3f position_offset;
+        MATH::Vector3f position_scale;
+        if (QuantizedPositionFormat::UNORM16 == position_format)
+        {
+            position_offset = min_position;
+            position_scale = bounds_size;
+        }
+        else
+        {
+            position_offset = MATH::Vector3f(
+                (min_position.X + max_position.X) / 2.0f,
+                (min_position.Y + max_position.Y) / 2.0f,
+                (min_position.Z + max_position.Z) / 2.0f);
+            position_scale = MATH::Vector3f(
+                bounds_size.X / 2.0f,
+                bounds_size.Y / 2.0f,
+                bounds_size.Z / 2.0f);
+        }
+        quantized_mesh.DequantizationTransform = (
+            MATH::Matrix4x4f::Translation(position_offset) *
+            MATH::Matrix4x4f::Scale(position_scale));
+
+        // ENCODE EACH VERTEX.
+        quantized_mesh.Vertices.reserve(vertices.size());
+        for (const auto& vertex : vertices)
+        {
+            // ENCODE THE POSITION.
+            QuantizedVertex quantized_vertex;
+            float position[] =
+            {
+                (vertex.ObjectSpacePosition.X - position_offset.X) / position_scale.X,
+                (vertex.ObjectSpacePosition.Y - position_offset.Y) / position_scale.Y,
+                (vertex.ObjectSpacePosition.Z - position_offset.Z) / position_scale.Z
+            };
+            const unsigned int POSITION_COMPONENT_COUNT = 3;
+            for (unsigned int component_index = 0; component_index < POSITION_COMPONENT_COUNT; ++component_index)
+            {
+                quantized_vertex.Position[component_index] = (QuantizedPositionFormat::UNORM16 == position_format) ?
+                    EncodeUnorm16(position[component_index]) :
+                    EncodeHalfFloat(position[component_index]);
+            }
+            const unsigned int UNUSED_POSITION_COMPONENT_INDEX = 3;
+            quantized_vertex.Position[UNUSED_POSITION_COMPONENT_INDEX] = 0;
+
+            // ENCODE THE COLOR.
+            quantized_vertex.Color[0] = EncodeUnorm8(vertex.Color.Red);
+            quantized_vertex.Color[1] = EncodeUnorm8(vertex.Color.Green);
+            quantized_vertex.Color[2] = EncodeUnorm8(vertex.Color.Blue);
+            quantized_vertex.Color[3] = EncodeUnorm8(vertex.Color.Alpha);
+
+            quantized_mesh.Vertices.push_back(quantized_vertex);
+        }
+
+        return quantized_mesh;
+    }
+
+    /// Encodes a value as a 16-bit unsigned normalized integer.
+    /// @param[in]  value - The value to encode.  Clamped to the range [0, 1].
+    /// @return The encoded value, rounded to the nearest representable value.
+    uint16_t QuantizedMesh::EncodeUnorm16(const float value)
+    {
+        const float MAX_UNORM16 = static_cast<float>(UINT16_MAX);
+        float clamped_value = std::min(std::max(value, 0.0f), 1.0f);
+        uint16_t encoded_value = static_cast<uint16_t>(std::lround(clamped_value * MAX_UNORM16));
+        return encoded_value;
+    }
+
+    /// Encodes a value as an 8-bit unsigned normalized integer.
+    /// @param[in]  value - The value to encode.  Clamped to the range [0, 1].
+    /// @return The encoded value, rounded to the nearest representable value.
+    uint8_t QuantizedMesh::EncodeUnorm8(const float value)
+    {
+        const float MAX_UNORM8 = static_cast<float>(UINT8_MAX);
+        float clamped_value = std::min(std::max(value, 0.0f), 1.0f);
+        uint8_t encoded_value = static_cast<uint8_t>(std::lround(clamped_value * MAX_UNORM8));
+        return encoded_value;
+    }
+
+    /// Encodes a value as a 16-bit half-precision floating-point number
+    /// (1 sign bit, 5 exponent bits, and 10 mantissa bits).
+    /// @param[in]  value - The value to encode.
+    /// @return The encoded value.  Values too large for half precision become infinity,
+    ///     and values too small become zero.
+    uint16_t QuantizedMesh::EncodeHalfFloat(const float value)
+    {
+        // SPLIT THE SINGLE-PRECISION VALUE INTO ITS PARTS.
+        uint32_t float_bits = 0;
+        std::memcpy(&float_bits, &value, sizeof(float_bits));
+        uint16_t half_sign = static_cast<uint16_t>((float_bits >> 16) & 0x8000);
+        uint32_t float_exponent = (float_bits >> 23) & 0xFF;
+        uint32_t float_mantissa = float_bits & 0x7FFFFF;
+
+        // PRESERVE INFINITY AND NOT-A-NUMBER VALUES.
+        const uint16_t HALF_INFINITY = 0x7C00;
+        const uint32_t FLOAT_MAX_EXPONENT = 0xFF;
+        bool value_finite = (FLOAT_MAX_EXPONENT != float_exponent);
+        if (!value_finite)
+        {
+            const uint16_t HALF_QUIET_NAN_BIT = 0x0200;
+            uint16_t half_nan_bit = (0 != float_mantissa) ? HALF_QUIET_NAN_BIT : 0;
+            return static_cast<uint16_t>(half_sign | HALF_INFINITY | half_nan_bit);
+        }
+
+        // CLAMP VALUES TOO LARGE FOR HALF PRECISION TO INFINITY.
+        // The exponent is re-biased from single precision (127) to half precision (15).
+        int32_t half_exponent = static_cast<int32_t>(float_exponent) - 127 + 15;
+        const int32_t HALF_MAX_EXPONENT = 31;
+        bool value_too_large = (half_exponent >= HALF_MAX_EXPONENT);
+        if (value_too_large)
+        {
+            return static_cast<uint16_t>(half_sign | HALF_INFINITY);
+        }
+
+        // ENCODE VALUES TOO SMALL FOR NORMAL HALF PRECISION AS SUBNORMAL VALUES.
+        bool value_subnormal = (half_exponent <= 0);
+        if (value_subnormal)
+        {
+            // FLUSH VALUES TOO SMALL FOR EVEN SUBNORMAL HALF PRECISION TO ZERO.
+            const int32_t MIN_SUBNORMAL_EXPONENT = -10;
+            bool value_too_small = (half_exponent < MIN_SUBNORMAL_EXPONENT);
+            if (value_too_small)
+            {
+                return half_sign;
+            }
+
+            // SHIFT THE FULL MANTISSA (WITH ITS IMPLICIT LEADING 1) INTO THE SUBNORMAL RANGE.
+            uint32_t full_mantissa = float_mantissa | 0x800000;
+            uint32_t shift = static_cast<uint32_t>(14 - half_exponent);
+            uint32_t half_mantissa = full_mantissa >> shift;
+            uint32_t round_bit = (full_mantissa >> (shift - 1)) & 1;
+            return static_cast<uint16_t>(half_sign | (half_mantissa + round_bit));
+        }
+
+        // ENCODE NORMAL VALUES, ROUNDING THE MANTISSA TO THE NEAREST 10 BITS.
+        // Any carry from rounding correctly moves into the exponent.
+        uint32_t half_bits = (static_cast<uint32_t>(half_exponent) << 10) | (float_mantissa >> 13);
+        uint32_t round_bit = (float_mantissa >> 12) & 1;
+        return static_cast<uint16_t>(half_sign | (half_bits + round_bit));
+    }
+}
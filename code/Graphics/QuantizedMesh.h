@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+#include "Graphics/Vertex.h"
+#include "Math/Matrix4x4.h"
+
+namespace GRAPHICS
+{
+    /// The ways that vertex positions can be encoded in quantized vertices.
+    enum class QuantizedPositionFormat
+    {
+        /// 16-bit unsigned normalized coordinates spanning the bounds of the mesh.
+        /// Precision is evenly spread across the mesh, making this the best choice for most meshes.
+        UNORM16 = 0,
+        /// 16-bit half-precision floating-point coordinates relative to the center of the mesh,
+        /// scaled so that the bounds of the mesh span -1 to 1 on each axis.
+        /// Precision is highest near the center, which can suit meshes with fine detail there.
+        HALF_FLOAT
+    };
+
+    /// A vertex compressed to 12 bytes (rather than the 28 bytes of a regular vertex)
+    /// to reduce the memory and bandwidth used when drawing large meshes.
+    struct QuantizedVertex
+    {
+        /// The encoded x, y, and z coordinates of the vertex's position (see QuantizedPositionFormat),
+        /// followed by an unused component that keeps the color 4-byte aligned.
+        uint16_t Position[4];
+        /// The red, green, blue, and alpha components of the vertex's color as 8-bit normalized values.
+        uint8_t Color[4];
+    };
+
+    // VERIFY THE QUANTIZED VERTEX LAYOUT MATCHES THE LAYOUT EXPECTED BY SHADERS.
+    static_assert(std::is_trivially_copyable<QuantizedVertex>::value, "Quantized vertices must be trivially copyable to be copied directly into vertex buffers.");
+    static_assert(0 == offsetof(QuantizedVertex, Position), "Quantized vertex positions must be at the start of quantized vertices.");
+    static_assert(4 * sizeof(uint16_t) == offsetof(QuantizedVertex, Color), "Quantized vertex colors must directly follow the 4 position components.");
+    static_assert(12 == sizeof(QuantizedVertex), "Quantized vertices must be 12 tightly packed bytes.");
+
+    /// The vertices of a mesh compressed into quantized vertices, along with the
+    /// transform needed to turn decoded positions back into object-space positions.
+    class QuantizedMesh
+    {
+    public:
+        // ENCODING.
+        static QuantizedMesh Encode(const std::vector<Vertex>& vertices, const QuantizedPositionFormat position_format);
+        static uint16_t EncodeUnorm16(const float value);
+        static uint8_t EncodeUnorm8(const float value);
+        static uint16_t EncodeHalfFloat(const float value);
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The format of the positions in the quantized vertices.
+        QuantizedPositionFormat PositionFormat = QuantizedPositionFormat::UNORM16;
+        /// The quantized vertices.
+        std::vector<QuantizedVertex> Vertices = {};
+        /// The transform from decoded positions (as read by shaders) to object-space positions.
+        MATH::Matrix4x4f DequantizationTransform = MATH::Matrix4x4f::Identity();
+    };
+}
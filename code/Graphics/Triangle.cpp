@@ -34,14 +34,14 @@ namespace GRAPHICS
         float right_x = half_width;
         float z = 0.0f;
         
-        // SET THE VERTICES IN A TRIANGLE.
-        Object3D triangle;
-        triangle.Vertices =
+        // CREATE A TRIANGLE MESH FROM THE VERTICES.
+        std::vector<Vertex> vertices =
         {
             Vertex(MATH::Vector3f(top_x, top_y, z), top_center_color),
             Vertex(MATH::Vector3f(right_x, bottom_y, z), bottom_right_color),
             Vertex(MATH::Vector3f(left_x, bottom_y, z), bottom_left_color)
         };
+        Object3D triangle(Mesh::Create(std::move(vertices)));
         return triangle;
     }
 }
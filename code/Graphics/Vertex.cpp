@@ -11,4 +11,26 @@ namespace GRAPHICS
     ObjectSpacePosition(object_space_position),
     Color(color)
     {}
+
+    /// Equality operator.
+    /// @param[in]  rhs - The vertex to compare with.
+    /// @return True if this vertex and the provided vertex are equal; false otherwise.
+    bool Vertex::operator==(const Vertex& rhs) const
+    {
+        // Make sure all fields are equal.
+        if (ObjectSpacePosition != rhs.ObjectSpacePosition) return false;
+        if (Color != rhs.Color) return false;
+
+        // All fields were equal.
+        return true;
+    }
+
+    /// Inequality operator.
+    /// @param[in]  rhs - The vertex to compare with.
+    /// @return True if this vertex and the provided vertex aren't equal; false otherwise.
+    bool Vertex::operator!=(const Vertex& rhs) const
+    {
+        bool vertices_equal = ((*this) == rhs);
+        return !vertices_equal;
+    }
 }
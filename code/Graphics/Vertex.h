@@ -1,6 +1,7 @@
 #pragma once
 
-#include <memory>
+#include <cstddef>
+#include <type_traits>
 #include "Graphics/Color.h"
 #include "Math/Vector2.h"
 #include "Math/Vector3.h"
@@ -30,6 +31,10 @@ namespace GRAPHICS
     /// A vertex for a point.  At a minimum, a vertex is required
     /// to have a 3D position and color.  Other attributes are
     /// optional.
+    ///
+    /// Vertices are tightly packed floats (3 for position followed by 4 for color)
+    /// so that they can be copied directly into vertex buffers on graphics devices
+    /// without any conversion.  This layout is verified at compile time below.
     class Vertex
     {
     public:
@@ -38,6 +43,10 @@ namespace GRAPHICS
             const MATH::Vector3f& object_space_position, 
             const GRAPHICS::Color& color);
 
+        // OPERATORS.
+        bool operator==(const Vertex& rhs) const;
+        bool operator!=(const Vertex& rhs) const;
+
         // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
         /// The 3D position of the vertex in object space.
         /// Only 3D positions are supported since they're the most common
@@ -46,8 +55,16 @@ namespace GRAPHICS
         MATH::Vector3f ObjectSpacePosition = MATH::Vector3f();
         /// The color of the vertex.
         GRAPHICS::Color Color = GRAPHICS::Color();
-        /// Optional texture coordinates of the vertex.
-        /// Null if no texture coordinates are associated with the vertex.
-        //std::unique_ptr<MATH::Vector2f> TextureCoordinates = nullptr;
+        // Additional attributes (for example, MATH::Vector2f texture coordinates or
+        // MATH::Vector3f normals) should be added as plain members in vertex types
+        // that need them, with matching entries in a SHADERS::VertexLayout, so that
+        // vertices remain directly copyable into vertex buffers.
     };
+
+    // VERIFY THE VERTEX LAYOUT MATCHES THE LAYOUT EXPECTED BY VERTEX BUFFERS AND SHADERS.
+    static_assert(std::is_trivially_copyable<Vertex>::value, "Vertices must be trivially copyable to be copied directly into vertex buffers.");
+    static_assert(std::is_standard_layout<Vertex>::value, "Vertices must have a standard layout for their member offsets to be well-defined.");
+    static_assert(0 == offsetof(Vertex, ObjectSpacePosition), "Vertex positions must be at the start of vertices.");
+    static_assert(3 * sizeof(float) == offsetof(Vertex, Color), "Vertex colors must directly follow the 3 position floats.");
+    static_assert(7 * sizeof(float) == sizeof(Vertex), "Vertices must be 7 tightly packed floats.");
 }
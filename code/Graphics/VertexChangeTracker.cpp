@@ -0,0 +1,153 @@
+#include <algorithm>
+#include <atomic>
+#include "Graphics/VertexChangeTracker.h"
+
+namespace GRAPHICS
+{
+    /// Merges overlapping ranges and ranges separated by small gaps.  Updating a few extra
+    /// vertices in a gap is typically cheaper than making separate updates for each range.
+    /// @param[in]  max_gap_vertex_count - The maximum number of vertices between two ranges
+    ///     for them to be merged.  0 only merges overlapping or adjacent ranges.
+    /// @param[in,out]  ranges - The ranges to coalesce.  Sorted by first vertex upon return.
+    void VertexRange::Coalesce(const std::size_t max_gap_vertex_count, std::vector<VertexRange>& ranges)
+    {
+        // SORT THE RANGES SO THAT MERGEABLE RANGES ARE NEXT TO EACH OTHER.
+        std::sort(
+            ranges.begin(),
+            ranges.end(),
+            [](const VertexRange& lhs, const VertexRange& rhs) { return lhs.FirstVertex < rhs.FirstVertex; });
+
+        // MERGE EACH RANGE INTO THE PREVIOUS ONE IF CLOSE ENOUGH.
+        std::vector<VertexRange> coalesced_ranges;
+        for (const VertexRange& range : ranges)
+        {
+            bool range_empty = (0 == range.VertexCount);
+            if (range_empty)
+            {
+                continue;
+            }
+
+            bool previous_range_exists = !coalesced_ranges.empty();
+            if (previous_range_exists)
+            {
+                VertexRange& previous_range = coalesced_ranges.back();
+                std::size_t previous_range_end = previous_range.FirstVertex + previous_range.VertexCount;
+                bool range_close_to_previous = (range.FirstVertex <= previous_range_end + max_gap_vertex_count);
+                if (range_close_to_previous)
+                {
+                    std::size_t range_end = range.FirstVertex + range.VertexCount;
+                    std::size_t merged_range_end = std::max(previous_range_end, range_end);
+                    previous_range.VertexCount = merged_range_end - previous_range.FirstVertex;
+                    continue;
+                }
+            }
+
+            coalesced_ranges.push_back(range);
+        }
+
+        ranges = coalesced_ranges;
+    }
+
+    /// Constructor.  The tracker starts with a new version and no recorded changes.
+    VertexChangeTracker::VertexChangeTracker() :
+        Version(NewVersion()),
+        BaseVersion(Version),
+        Changes()
+    {}
+
+    /// Copy constructor.  The copy gets a new version with no recorded changes,
+    /// since changes recorded for the original don't apply to anyone consuming the copy.
+    /// @param[in]  other - The tracker to copy.  Unused besides documenting the intent.
+    VertexChangeTracker::VertexChangeTracker(const VertexChangeTracker& other) :
+        VertexChangeTracker()
+    {
+        // REFERENCE UNUSED PARAMETERS TO PREVENT COMPILER WARNINGS.
+        (void)other;
+    }
+
+    /// Copy assignment operator.  This tracker gets a new version with no recorded
+    /// changes since the vertices being tracked have been entirely replaced.
+    /// @param[in]  other - The tracker to copy.  Unused besides documenting the intent.
+    /// @return This tracker.
+    VertexChangeTracker& VertexChangeTracker::operator=(const VertexChangeTracker& other)
+    {
+        // REFERENCE UNUSED PARAMETERS TO PREVENT COMPILER WARNINGS.
+        (void)other;
+
+        MarkAllChanged();
+        return *this;
+    }
+
+    /// Records that a range of vertices changed.
+    /// @param[in]  first_vertex - The index of the first vertex that changed.
+    /// @param[in]  vertex_count - The number of vertices that changed.
+    void VertexChangeTracker::MarkChanged(const std::size_t first_vertex, const std::size_t vertex_count)
+    {
+        // FORGET ALL RECORDED CHANGES IF TOO MANY HAVE BEEN RECORDED.
+        // Consumers that haven't seen the forgotten changes will need to compare all vertices.
+        bool too_many_changes_recorded = (Changes.size() >= MAX_RECORDED_CHANGE_COUNT);
+        if (too_many_changes_recorded)
+        {
+            Changes.clear();
+            BaseVersion = Version;
+        }
+
+        // RECORD THE CHANGE.
+        Version = NewVersion();
+        Change change;
+        change.Range.FirstVertex = first_vertex;
+        change.Range.VertexCount = vertex_count;
+        change.Version = Version;
+        Changes.push_back(change);
+    }
+
+    /// Records that all vertices changed (or were replaced entirely, possibly with a
+    /// different number of vertices).  Consumers will need to compare all vertices.
+    void VertexChangeTracker::MarkAllChanged()
+    {
+        Version = NewVersion();
+        BaseVersion = Version;
+        Changes.clear();
+    }
+
+    /// Gets the ranges of vertices that changed since a version.  If the history since the
+    /// version was truncated (or the version is from another tracker), no ranges are provided,
+    /// and the caller must fall back to treating the full range of vertices as changed.
+    /// @param[in]  version - The version a consumer last saw.
+    /// @param[out] changed_ranges - The ranges changed since the version (not coalesced), which
+    ///     are empty if nothing changed.  Left unmodified if false is returned.
+    /// @return True if every change since the version was recorded; false if the full range
+    ///     of vertices must be considered changed.
+    bool VertexChangeTracker::ChangedRangesSince(const uint64_t version, std::vector<VertexRange>& changed_ranges) const
+    {
+        // MAKE SURE ALL CHANGES SINCE THE VERSION WERE RECORDED.
+        // Since versions are unique and increasing across all trackers, any version from
+        // before this tracker's base version (including versions of other trackers) is unknown.
+        bool changes_recorded = (version >= BaseVersion) && (version <= Version);
+        if (!changes_recorded)
+        {
+            return false;
+        }
+
+        // GET THE RANGES FOR ALL CHANGES AFTER THE VERSION.
+        changed_ranges.clear();
+        for (const Change& change : Changes)
+        {
+            bool change_after_version = (change.Version > version);
+            if (change_after_version)
+            {
+                changed_ranges.push_back(change.Range);
+            }
+        }
+        return true;
+    }
+
+    /// Gets a new version that is unique across all trackers.
+    /// @return A new version, greater than all previous versions.
+    uint64_t VertexChangeTracker::NewVersion()
+    {
+        static std::atomic<uint64_t> next_version(1);
+        uint64_t new_version = next_version++;
+        return new_version;
+    }
+}
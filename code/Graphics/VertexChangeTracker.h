@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace GRAPHICS
+{
+    /// A contiguous range of vertices.
+    struct VertexRange
+    {
+        // COALESCING.
+        static void Coalesce(const std::size_t max_gap_vertex_count, std::vector<VertexRange>& ranges);
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The index of the first vertex in the range.
+        std::size_t FirstVertex = 0;
+        /// The number of vertices in the range.
+        std::size_t VertexCount = 0;
+    };
+
+    /// Tracks changes to a collection of vertices so that consumers (like renderers holding
+    /// copies of the vertices on a graphics device) only need to update what changed.
+    ///
+    /// Each change is stamped with a version that is unique across all trackers.  Consumers
+    /// remember the version they last saw and can then ask for the ranges changed since then.
+    /// Copying a tracker (or the object holding it) produces a new version with no recorded
+    /// changes, so consumers never mistake one collection's changes for another's.
+    class VertexChangeTracker
+    {
+    public:
+        // CONSTANTS.
+        /// The maximum number of changes recorded.  Once exceeded, older changes are
+        /// forgotten, and consumers that haven't seen them must compare all vertices.
+        static const std::size_t MAX_RECORDED_CHANGE_COUNT = 32;
+
+        // CONSTRUCTION/ASSIGNMENT.
+        explicit VertexChangeTracker();
+        VertexChangeTracker(const VertexChangeTracker& other);
+        VertexChangeTracker& operator=(const VertexChangeTracker& other);
+
+        // CHANGE TRACKING.
+        void MarkChanged(const std::size_t first_vertex, const std::size_t vertex_count);
+        void MarkAllChanged();
+        bool ChangedRangesSince(const uint64_t version, std::vector<VertexRange>& changed_ranges) const;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The current version of the vertices.  Changes every time vertices are marked as changed.
+        uint64_t Version;
+
+    private:
+        // PRIVATE TYPES.
+        /// A single recorded change.
+        struct Change
+        {
+            /// The range of vertices that changed.
+            VertexRange Range;
+            /// The version of the vertices after the change.
+            uint64_t Version;
+        };
+
+        // HELPER METHODS.
+        static uint64_t NewVersion();
+
+        // MEMBER VARIABLES.
+        /// The version before any recorded changes.  Changes made after this version are
+        /// all recorded, so ranges can only be provided for versions at or after this one.
+        uint64_t BaseVersion;
+        /// The recorded changes, from oldest to newest.
+        std::vector<Change> Changes;
+    };
+}
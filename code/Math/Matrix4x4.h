@@ -38,6 +38,9 @@ namespace MATH
         // OPERATORS.
         Matrix4x4 operator* (const Matrix4x4& rhs) const;
 
+        // TRANSFORMATION.
+        Vector3<ElementType> TransformPoint(const Vector3<ElementType>& point) const;
+
         // ELEMENT RETRIEVAL.
         const ElementType* ElementsInRowMajorOrder() const;
 
@@ -250,6 +253,35 @@ namespace MATH
         return matrix_product;
     }
 
+    /// Transforms the provided point by this matrix.  The point is treated as having
+    /// a w coordinate of 1, and the resulting w coordinate is discarded, so this is
+    /// only intended for affine transformations (like world transforms).
+    /// @param[in]  point - The point to transform.
+    /// @return The transformed point.
+    template <typename ElementType>
+    Vector3<ElementType> Matrix4x4<ElementType>::TransformPoint(const Vector3<ElementType>& point) const
+    {
+        // COMPUTE EACH TRANSFORMED COMPONENT.
+        // The matrix elements are arranged by x, y (column, row).
+        Vector3<ElementType> transformed_point;
+        transformed_point.X =
+            (Elements(0, 0) * point.X) +
+            (Elements(1, 0) * point.Y) +
+            (Elements(2, 0) * point.Z) +
+            Elements(3, 0);
+        transformed_point.Y =
+            (Elements(0, 1) * point.X) +
+            (Elements(1, 1) * point.Y) +
+            (Elements(2, 1) * point.Z) +
+            Elements(3, 1);
+        transformed_point.Z =
+            (Elements(0, 2) * point.X) +
+            (Elements(1, 2) * point.Y) +
+            (Elements(2, 2) * point.Z) +
+            Elements(3, 2);
+        return transformed_point;
+    }
+
     /// Gets the element values in row-major order
     /// (each row's values before the next row).
     /// @return The element values in row-major order.
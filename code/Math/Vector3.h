@@ -130,7 +130,7 @@ namespace MATH
     {
         bool x_component_matches = (this->X == rhs.X);
         bool y_component_matches = (this->Y == rhs.Y);
-        bool z_component_matches = (this->z == rhs.Z);
+        bool z_component_matches = (this->Z == rhs.Z);
 
         bool all_components_match = (x_component_matches && y_component_matches && z_component_matches);
         return all_components_match;
@@ -0,0 +1,77 @@
+#include <cstdlib>
+#include <new>
+#include "Testing/AllocationCounter.h"
+
+namespace TESTING
+{
+    std::atomic<uint64_t> AllocationCounter::TotalAllocationCount(0);
+    std::atomic<uint64_t> AllocationCounter::TotalAllocatedByteCount(0);
+
+    /// Records an allocation.  Called for every allocation via the global operator new.
+    /// @param[in]  size_in_bytes - The number of bytes allocated.
+    void AllocationCounter::RecordAllocation(const std::size_t size_in_bytes)
+    {
+        TotalAllocationCount.fetch_add(1, std::memory_order_relaxed);
+        TotalAllocatedByteCount.fetch_add(size_in_bytes, std::memory_order_relaxed);
+    }
+
+    /// Constructor.  Only allocations made after construction are counted.
+    AllocationCounter::AllocationCounter() :
+        StartAllocationCount(TotalAllocationCount.load(std::memory_order_relaxed)),
+        StartAllocatedByteCount(TotalAllocatedByteCount.load(std::memory_order_relaxed))
+    {}
+
+    /// Gets the number of allocations made since the counter was created.
+    /// @return The number of allocations.
+    uint64_t AllocationCounter::AllocationCount() const
+    {
+        uint64_t allocation_count = TotalAllocationCount.load(std::memory_order_relaxed) - StartAllocationCount;
+        return allocation_count;
+    }
+
+    /// Gets the number of bytes allocated since the counter was created.
+    /// @return The number of bytes allocated.
+    uint64_t AllocationCounter::AllocatedByteCount() const
+    {
+        uint64_t allocated_byte_count = TotalAllocatedByteCount.load(std::memory_order_relaxed) - StartAllocatedByteCount;
+        return allocated_byte_count;
+    }
+}
+
+/// Replaces the global operator new to count allocations.  Other forms of operator new
+/// (arrays, non-throwing) are implemented in terms of this one by the standard library.
+/// @param[in]  size_in_bytes - The number of bytes to allocate.
+/// @return The allocated memory.
+/// @throws std::bad_alloc - Thrown if the memory couldn't be allocated.
+void* operator new(std::size_t size_in_bytes)
+{
+    TESTING::AllocationCounter::RecordAllocation(size_in_bytes);
+
+    // Zero-byte allocations must still return unique pointers.
+    std::size_t size_in_bytes_to_allocate = (size_in_bytes > 0) ? size_in_bytes : 1;
+    void* memory = std::malloc(size_in_bytes_to_allocate);
+    bool memory_allocated = (nullptr != memory);
+    if (!memory_allocated)
+    {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+/// Replaces the global operator delete to match the replaced operator new.
+/// @param[in]  memory - The memory to free.  May be null.
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+/// Replaces the global sized operator delete to match the replaced operator new.
+/// @param[in]  memory - The memory to free.  May be null.
+/// @param[in]  size_in_bytes - The number of bytes originally allocated.  Unused.
+void operator delete(void* memory, std::size_t size_in_bytes) noexcept
+{
+    // REFERENCE UNUSED PARAMETERS TO PREVENT COMPILER WARNINGS.
+    (void)size_in_bytes;
+
+    std::free(memory);
+}
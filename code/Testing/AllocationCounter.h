@@ -0,0 +1,39 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/// Holds code for checking the behavior of the rest of the application.
+namespace TESTING
+{
+    /// Counts memory allocated via the global operator new since the counter was created,
+    /// so that checks can verify how much memory an operation allocates.  All threads'
+    /// allocations are counted, so measured operations shouldn't run alongside other threads.
+    class AllocationCounter
+    {
+    public:
+        // GLOBAL ALLOCATION TRACKING.
+        static void RecordAllocation(const std::size_t size_in_bytes);
+
+        // CONSTRUCTION.
+        explicit AllocationCounter();
+
+        // COUNTS.
+        uint64_t AllocationCount() const;
+        uint64_t AllocatedByteCount() const;
+
+    private:
+        // STATIC MEMBER VARIABLES.
+        /// The number of allocations made since the application started.
+        static std::atomic<uint64_t> TotalAllocationCount;
+        /// The number of bytes allocated since the application started.
+        static std::atomic<uint64_t> TotalAllocatedByteCount;
+
+        // MEMBER VARIABLES.
+        /// The total number of allocations when the counter was created.
+        uint64_t StartAllocationCount;
+        /// The total number of bytes allocated when the counter was created.
+        uint64_t StartAllocatedByteCount;
+    };
+}
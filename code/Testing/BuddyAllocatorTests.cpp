@@ -0,0 +1,85 @@
+#include <cstdint>
+#include "Graphics/OpenGL/BuddyAllocator.h"
+#include "Testing/BuddyAllocatorTests.h"
+
+namespace TESTING
+{
+    /// Checks that the buddy allocator rounds allocations up to power-of-two blocks, splits
+    /// larger blocks to place them at the lowest free offsets, and merges freed buddies back
+    /// together so that the entire size can be allocated again.
+    /// @param[in,out]  report - The report to add the results of the checks to.
+    void TestBuddyAllocator(TestReport& report)
+    {
+        const uint64_t TOTAL_SIZE = 1024;
+        const uint64_t MIN_BLOCK_SIZE = 64;
+        GRAPHICS::OPEN_GL::BuddyAllocator allocator(TOTAL_SIZE, MIN_BLOCK_SIZE);
+
+        // CHECK THAT ALLOCATIONS ARE ROUNDED UP AND PACKED FROM THE START.
+        // The 100 unit allocation needs a 128 unit block, splitting the total size down to it
+        // and leaving its buddy free for the next 128 unit block.
+        uint64_t first_offset = UINT64_MAX;
+        bool first_allocated = allocator.Allocate(100, first_offset);
+        report.Check(
+            first_allocated && (0 == first_offset) && (128 == allocator.BlockSize(first_offset)),
+            "The buddy allocator didn't round an allocation up to the smallest block at the start.");
+
+        uint64_t second_offset = UINT64_MAX;
+        bool second_allocated = allocator.Allocate(128, second_offset);
+        report.Check(
+            second_allocated && (128 == second_offset),
+            "The buddy allocator didn't place an allocation in the buddy of the previous block.");
+
+        uint64_t min_block_offset = UINT64_MAX;
+        bool min_block_allocated = allocator.Allocate(1, min_block_offset);
+        report.Check(
+            min_block_allocated && (256 == min_block_offset) && (MIN_BLOCK_SIZE == allocator.BlockSize(min_block_offset)),
+            "The buddy allocator didn't round a tiny allocation up to the minimum block size.");
+        report.Check(
+            (128 + 128 + MIN_BLOCK_SIZE) == allocator.AllocatedSize(),
+            "The buddy allocator didn't count the full size of allocated blocks.");
+
+        // CHECK THAT ALLOCATIONS FAIL WHEN NO LARGE ENOUGH BLOCK IS FREE.
+        // Only 512 units remain in a single block, so a larger allocation can't fit.
+        uint64_t too_large_offset = UINT64_MAX;
+        bool too_large_allocated = allocator.Allocate(600, too_large_offset);
+        report.Check(
+            !too_large_allocated && (UINT64_MAX == too_large_offset),
+            "The buddy allocator allocated more than its largest free block.");
+        uint64_t empty_offset = UINT64_MAX;
+        report.Check(
+            !allocator.Allocate(0, empty_offset),
+            "The buddy allocator allocated an empty block.");
+
+        // CHECK THAT FREEING ONE BUDDY DOESN'T MERGE WHILE THE OTHER IS ALLOCATED.
+        // If the first block were merged with its allocated buddy, a 256 unit block would be free at the start.
+        allocator.Free(first_offset);
+        report.Check(
+            0 == allocator.BlockSize(first_offset),
+            "The buddy allocator still reported the size of a freed block.");
+        uint64_t merged_offset = UINT64_MAX;
+        bool merged_allocated = allocator.Allocate(256, merged_offset);
+        report.Check(
+            merged_allocated && (512 == merged_offset),
+            "The buddy allocator merged a freed block with a buddy that was still allocated.");
+        allocator.Free(merged_offset);
+
+        // CHECK THAT FREEING BOTH BUDDIES MERGES THEM BACK INTO LARGER BLOCKS.
+        // Once everything is freed, all blocks merge back into one covering the total size.
+        allocator.Free(second_offset);
+        allocator.Free(min_block_offset);
+        report.Check(
+            allocator.Empty() && (0 == allocator.AllocatedSize()),
+            "The buddy allocator wasn't empty after freeing all blocks.");
+        uint64_t total_offset = UINT64_MAX;
+        bool total_allocated = allocator.Allocate(TOTAL_SIZE, total_offset);
+        report.Check(
+            total_allocated && (0 == total_offset),
+            "The buddy allocator didn't merge freed buddies back into a block of the total size.");
+
+        // CHECK THAT FREEING AN UNALLOCATED OFFSET IS IGNORED.
+        allocator.Free(MIN_BLOCK_SIZE);
+        report.Check(
+            TOTAL_SIZE == allocator.AllocatedSize(),
+            "Freeing an unallocated offset changed the buddy allocator.");
+    }
+}
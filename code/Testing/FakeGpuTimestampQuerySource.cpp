@@ -0,0 +1,85 @@
+#include "Testing/FakeGpuTimestampQuerySource.h"
+
+namespace TESTING
+{
+    /// Advances the clock from which timestamps are recorded, simulating the GPU doing work.
+    /// @param[in]  elapsed_time_in_nanoseconds - The time to advance the clock by.
+    void FakeGpuTimestampQuerySource::AdvanceClock(const uint64_t elapsed_time_in_nanoseconds)
+    {
+        CurrentTimestampInNanoseconds += elapsed_time_in_nanoseconds;
+    }
+
+    /// Makes results for all queries issued so far available, simulating the GPU catching up.
+    void FakeGpuTimestampQuerySource::FinishIssuedQueries()
+    {
+        FinishedQueryCount = IssuedQueryCount;
+    }
+
+    /// Creates query objects.
+    /// @param[in]  query_count - The number of query objects to create.
+    /// @param[out] query_ids - The IDs of the created query objects.
+    void FakeGpuTimestampQuerySource::CreateQueries(const GLsizei query_count, GLuint* const query_ids)
+    {
+        for (GLsizei query_index = 0; query_index < query_count; ++query_index)
+        {
+            query_ids[query_index] = NextQueryId;
+            Queries[NextQueryId] = Query();
+            ++NextQueryId;
+        }
+        ExistingQueryCount += static_cast<uint64_t>(query_count);
+    }
+
+    /// Deletes query objects.
+    /// @param[in]  query_count - The number of query objects to delete.
+    /// @param[in]  query_ids - The IDs of the query objects to delete.
+    void FakeGpuTimestampQuerySource::DeleteQueries(const GLsizei query_count, const GLuint* const query_ids)
+    {
+        for (GLsizei query_index = 0; query_index < query_count; ++query_index)
+        {
+            std::size_t deleted_query_count = Queries.erase(query_ids[query_index]);
+            ExistingQueryCount -= deleted_query_count;
+        }
+    }
+
+    /// Issues a query for the current timestamp.  Its result is only available once finished.
+    /// @param[in]  query_id - The ID of the query.
+    void FakeGpuTimestampQuerySource::IssueTimestampQuery(const GLuint query_id)
+    {
+        Query& query = Queries[query_id];
+        query.Issued = true;
+        query.IssueIndex = IssuedQueryCount;
+        query.TimestampInNanoseconds = CurrentTimestampInNanoseconds;
+        ++IssuedQueryCount;
+    }
+
+    /// Determines if a query's result is available.
+    /// @param[in]  query_id - The ID of the query.
+    /// @return True if the query has been issued and finished; false otherwise.
+    bool FakeGpuTimestampQuerySource::ResultAvailable(const GLuint query_id)
+    {
+        auto query = Queries.find(query_id);
+        bool query_exists = (Queries.end() != query);
+        if (!query_exists)
+        {
+            return false;
+        }
+
+        bool result_available = (query->second.Issued && (query->second.IssueIndex < FinishedQueryCount));
+        return result_available;
+    }
+
+    /// Reads the timestamp recorded by a query, counting the read if the result wasn't available.
+    /// @param[in]  query_id - The ID of the query.
+    /// @return The timestamp, in nanoseconds.
+    uint64_t FakeGpuTimestampQuerySource::ReadTimestampInNanoseconds(const GLuint query_id)
+    {
+        bool result_available = ResultAvailable(query_id);
+        if (!result_available)
+        {
+            ++UnavailableResultReadCount;
+        }
+
+        uint64_t timestamp_in_nanoseconds = Queries[query_id].TimestampInNanoseconds;
+        return timestamp_in_nanoseconds;
+    }
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include "Graphics/OpenGL/GpuTimestampQuerySource.h"
+
+namespace TESTING
+{
+    /// A source of timestamp queries with synthetic results, simulating a GPU that
+    /// records timestamps from a manually advanced clock and only finishes queries
+    /// when told to.  Reads of results that aren't available yet (which would stall
+    /// the CPU on a real GPU) are counted rather than waited on.
+    class FakeGpuTimestampQuerySource : public GRAPHICS::OPEN_GL::GpuTimestampQuerySource
+    {
+    public:
+        // SIMULATION.
+        void AdvanceClock(const uint64_t elapsed_time_in_nanoseconds);
+        void FinishIssuedQueries();
+
+        // QUERY OBJECTS.
+        void CreateQueries(const GLsizei query_count, GLuint* const query_ids) override;
+        void DeleteQueries(const GLsizei query_count, const GLuint* const query_ids) override;
+
+        // TIMESTAMPS.
+        void IssueTimestampQuery(const GLuint query_id) override;
+        bool ResultAvailable(const GLuint query_id) override;
+        uint64_t ReadTimestampInNanoseconds(const GLuint query_id) override;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The timestamp recorded by queries issued now.
+        uint64_t CurrentTimestampInNanoseconds = 0;
+        /// The number of query objects created and not yet deleted.
+        uint64_t ExistingQueryCount = 0;
+        /// The number of times a result was read before it was available.
+        uint64_t UnavailableResultReadCount = 0;
+
+    private:
+        // PRIVATE TYPES.
+        /// A query object.
+        struct Query
+        {
+            /// True if the query has been issued at least once.
+            bool Issued = false;
+            /// The number of queries issued before the latest time this query was issued.
+            uint64_t IssueIndex = 0;
+            /// The timestamp recorded when the query was last issued.
+            uint64_t TimestampInNanoseconds = 0;
+        };
+
+        // MEMBER VARIABLES.
+        /// The ID for the next query object to be created.  0 is never used, as in OpenGL.
+        GLuint NextQueryId = 1;
+        /// Query objects by ID.
+        std::unordered_map<GLuint, Query> Queries = {};
+        /// The total number of queries issued.
+        uint64_t IssuedQueryCount = 0;
+        /// The number of queries the simulated GPU has finished, in the order they were issued.
+        uint64_t FinishedQueryCount = 0;
+    };
+}
@@ -0,0 +1,117 @@
+#include <vector>
+#include "Graphics/Color.h"
+#include "Graphics/OpenGL/GpuResourceManager.h"
+#include "Graphics/Vertex.h"
+#include "Math/Vector3.h"
+#include "Testing/GpuResourceManagerTests.h"
+#include "Testing/GraphicsDeviceWithoutContext.h"
+
+namespace TESTING
+{
+    /// Checks that handles to destroyed resources become invalid and stay invalid after
+    /// their slots are reused, rather than referring to whatever resource now fills the slot.
+    /// @param[in,out]  report - The report to add the results of the checks to.
+    void TestGpuResourceHandles(TestReport& report)
+    {
+        // CREATE A RESOURCE MANAGER.
+        // Resources are never used, so nothing is ever allocated on the graphics device.
+        GRAPHICS::OPEN_GL::GpuResourceManager resource_manager(CreateGraphicsDeviceWithoutContext());
+        const std::vector<GRAPHICS::Vertex> VERTICES(
+            3,
+            GRAPHICS::Vertex(MATH::Vector3f(0.0f, 0.0f, 0.0f), GRAPHICS::Color(1.0f, 1.0f, 1.0f)));
+
+        // CHECK THAT A DEFAULT HANDLE DOESN'T REFER TO ANY RESOURCE.
+        GRAPHICS::OPEN_GL::GpuResourceHandle default_handle;
+        report.Check(
+            !resource_manager.IsValid(default_handle),
+            "A default GPU resource handle was valid.");
+
+        // CHECK THAT NEW HANDLES ARE VALID.
+        GRAPHICS::OPEN_GL::GpuResourceHandle destroyed_handle = resource_manager.CreateVertexBuffer(VERTICES);
+        GRAPHICS::OPEN_GL::GpuResourceHandle kept_handle = resource_manager.CreateVertexBuffer(VERTICES);
+        report.Check(
+            resource_manager.IsValid(destroyed_handle) && resource_manager.IsValid(kept_handle),
+            "A newly created GPU resource's handle wasn't valid.");
+
+        // CHECK THAT DESTROYING A RESOURCE ONLY INVALIDATES ITS OWN HANDLE.
+        GRAPHICS::OPEN_GL::GpuResourceHandle copied_destroyed_handle = destroyed_handle;
+        resource_manager.Destroy(destroyed_handle);
+        report.Check(
+            !resource_manager.IsValid(destroyed_handle) && !resource_manager.IsValid(copied_destroyed_handle),
+            "A handle to a destroyed GPU resource was still valid.");
+        report.Check(
+            resource_manager.IsValid(kept_handle),
+            "Destroying a GPU resource invalidated the handle of a different resource.");
+        report.Check(
+            UINT64_MAX == resource_manager.FramesSinceLastUse(destroyed_handle),
+            "A destroyed GPU resource still reported when it was last used.");
+
+        // CHECK THAT A STALE HANDLE DOESN'T REFER TO A NEW RESOURCE IN THE SAME SLOT.
+        GRAPHICS::OPEN_GL::GpuResourceHandle reused_slot_handle = resource_manager.CreateStreamingVertexBuffer(
+            static_cast<unsigned int>(VERTICES.size()));
+        bool slot_reused = (
+            (reused_slot_handle.Index == destroyed_handle.Index) &&
+            (reused_slot_handle.Generation != destroyed_handle.Generation));
+        report.Check(
+            slot_reused,
+            "A destroyed GPU resource's slot wasn't reused with a new generation.");
+        report.Check(
+            resource_manager.IsValid(reused_slot_handle) && !resource_manager.IsValid(destroyed_handle),
+            "A stale GPU resource handle referred to the new resource in its reused slot.");
+
+        // CHECK THAT DESTROYING THROUGH A STALE HANDLE LEAVES THE NEW RESOURCE ALONE.
+        resource_manager.Destroy(destroyed_handle);
+        report.Check(
+            resource_manager.IsValid(reused_slot_handle),
+            "Destroying through a stale GPU resource handle destroyed the new resource in its slot.");
+    }
+
+    /// Checks that comparing old and new vertices finds each run of changed vertices,
+    /// and that changing the number of vertices is treated as changing all of them.
+    /// @param[in,out]  report - The report to add the results of the checks to.
+    void TestFindChangedVertexRanges(TestReport& report)
+    {
+        const GRAPHICS::Vertex ORIGINAL_VERTEX(MATH::Vector3f(0.0f, 0.0f, 0.0f), GRAPHICS::Color(1.0f, 1.0f, 1.0f));
+        const GRAPHICS::Vertex CHANGED_VERTEX(MATH::Vector3f(1.0f, 0.0f, 0.0f), GRAPHICS::Color(1.0f, 0.0f, 0.0f));
+        const std::size_t VERTEX_COUNT = 10;
+        const std::vector<GRAPHICS::Vertex> OLD_VERTICES(VERTEX_COUNT, ORIGINAL_VERTEX);
+
+        // CHECK THAT IDENTICAL VERTICES HAVE NO CHANGED RANGES.
+        std::vector<GRAPHICS::VertexRange> changed_ranges = GRAPHICS::OPEN_GL::GpuResourceManager::FindChangedRanges(
+            OLD_VERTICES,
+            OLD_VERTICES);
+        report.Check(
+            changed_ranges.empty(),
+            "Changed vertex ranges were found between identical vertices.");
+
+        // CHECK THAT EACH RUN OF CHANGED VERTICES IS ITS OWN RANGE.
+        // Changes touching the first and last vertices make sure the ends of the vertices are handled.
+        std::vector<GRAPHICS::Vertex> new_vertices = OLD_VERTICES;
+        new_vertices[0] = CHANGED_VERTEX;
+        new_vertices[3] = CHANGED_VERTEX;
+        new_vertices[4] = CHANGED_VERTEX;
+        new_vertices[5] = CHANGED_VERTEX;
+        new_vertices[9] = CHANGED_VERTEX;
+        changed_ranges = GRAPHICS::OPEN_GL::GpuResourceManager::FindChangedRanges(OLD_VERTICES, new_vertices);
+        bool changed_runs_found = (
+            (3 == changed_ranges.size()) &&
+            (0 == changed_ranges[0].FirstVertex) && (1 == changed_ranges[0].VertexCount) &&
+            (3 == changed_ranges[1].FirstVertex) && (3 == changed_ranges[1].VertexCount) &&
+            (9 == changed_ranges[2].FirstVertex) && (1 == changed_ranges[2].VertexCount));
+        report.Check(
+            changed_runs_found,
+            "Changed vertex ranges didn't match the runs of changed vertices.");
+
+        // CHECK THAT CHANGING THE VERTEX COUNT CHANGES ALL VERTICES.
+        std::vector<GRAPHICS::Vertex> more_vertices = OLD_VERTICES;
+        more_vertices.push_back(ORIGINAL_VERTEX);
+        changed_ranges = GRAPHICS::OPEN_GL::GpuResourceManager::FindChangedRanges(OLD_VERTICES, more_vertices);
+        bool all_vertices_changed = (
+            (1 == changed_ranges.size()) &&
+            (0 == changed_ranges[0].FirstVertex) &&
+            (more_vertices.size() == changed_ranges[0].VertexCount));
+        report.Check(
+            all_vertices_changed,
+            "Changing the number of vertices didn't produce a single range covering all new vertices.");
+    }
+}
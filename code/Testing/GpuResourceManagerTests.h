@@ -0,0 +1,9 @@
+#pragma once
+
+#include "Testing/TestReport.h"
+
+namespace TESTING
+{
+    void TestGpuResourceHandles(TestReport& report);
+    void TestFindChangedVertexRanges(TestReport& report);
+}
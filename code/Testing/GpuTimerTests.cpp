@@ -0,0 +1,150 @@
+#include <cmath>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Graphics/OpenGL/GpuTimer.h"
+#include "Testing/FakeGpuTimestampQuerySource.h"
+#include "Testing/GpuTimerTests.h"
+
+namespace TESTING
+{
+    /// Times a frame with an outer pass containing an inner pass, advancing the fake GPU clock
+    /// so that the passes take the specified times.
+    /// @param[in]  inner_pass_time_in_milliseconds - The time for the inner pass.
+    /// @param[in]  outer_pass_time_in_milliseconds - The time for the outer pass, including the inner pass.
+    /// @param[in,out]  query_source - The query source used by the timer.
+    /// @param[in,out]  gpu_timer - The timer to time the frame with.
+    static void TimeNestedPasses(
+        const uint64_t inner_pass_time_in_milliseconds,
+        const uint64_t outer_pass_time_in_milliseconds,
+        FakeGpuTimestampQuerySource& query_source,
+        GRAPHICS::OPEN_GL::GpuTimer& gpu_timer)
+    {
+        const uint64_t NANOSECONDS_PER_MILLISECOND = 1000000;
+        uint64_t time_outside_inner_pass_in_milliseconds = outer_pass_time_in_milliseconds - inner_pass_time_in_milliseconds;
+
+        gpu_timer.BeginPass("Outer");
+        query_source.AdvanceClock(time_outside_inner_pass_in_milliseconds * NANOSECONDS_PER_MILLISECOND);
+        gpu_timer.BeginPass("Inner");
+        query_source.AdvanceClock(inner_pass_time_in_milliseconds * NANOSECONDS_PER_MILLISECOND);
+        gpu_timer.EndPass();
+        gpu_timer.EndPass();
+        gpu_timer.EndFrame();
+    }
+
+    /// Determines if a pass has the expected GPU time.
+    /// @param[in]  pass_timing - The timing of the pass.
+    /// @param[in]  expected_name - The expected name of the pass.
+    /// @param[in]  expected_gpu_time_in_milliseconds - The expected GPU time of the pass.
+    /// @return True if the pass has the expected name and GPU time; false otherwise.
+    static bool PassTimed(
+        const GRAPHICS::OPEN_GL::GpuTimer::PassTiming& pass_timing,
+        const std::string& expected_name,
+        const double expected_gpu_time_in_milliseconds)
+    {
+        const double TOLERANCE_IN_MILLISECONDS = 0.000001;
+        bool pass_timed = (
+            (expected_name == pass_timing.Name) &&
+            (std::abs(pass_timing.GpuTimeInMilliseconds - expected_gpu_time_in_milliseconds) < TOLERANCE_IN_MILLISECONDS));
+        return pass_timed;
+    }
+
+    /// Checks that the GPU timer reads synthetic timestamps only once they're available,
+    /// reports how many frames old its results are, recycles its queries, and correctly
+    /// averages the time spent on each pass.
+    /// @param[in,out]  report - The report to add the results of the checks to.
+    void TestGpuTimer(TestReport& report)
+    {
+        // CREATE A TIMER USING SYNTHETIC QUERY RESULTS.
+        std::unique_ptr<FakeGpuTimestampQuerySource> fake_query_source = std::make_unique<FakeGpuTimestampQuerySource>();
+        FakeGpuTimestampQuerySource& query_source = *fake_query_source;
+        GRAPHICS::OPEN_GL::GpuTimer gpu_timer(std::move(fake_query_source));
+
+        // CHECK THAT NO RESULTS ARE REPORTED BEFORE THE GPU FINISHES THE QUERIES.
+        TimeNestedPasses(1, 4, query_source, gpu_timer);
+        TimeNestedPasses(3, 6, query_source, gpu_timer);
+        report.Check(
+            gpu_timer.LatestFrameTimings.empty(),
+            "The GPU timer reported timings before query results were available.");
+        report.Check(
+            0 == query_source.UnavailableResultReadCount,
+            "The GPU timer stalled reading query results before they were available.");
+
+        // CHECK THAT RESULTS ARE READ FOR ALL FRAMES ONCE THE GPU CATCHES UP.
+        query_source.FinishIssuedQueries();
+        gpu_timer.EndFrame();
+        const std::size_t PASSES_PER_FRAME = 2;
+        bool latest_frame_timed = (
+            (PASSES_PER_FRAME == gpu_timer.LatestFrameTimings.size()) &&
+            PassTimed(gpu_timer.LatestFrameTimings[0], "Outer", 6.0) &&
+            PassTimed(gpu_timer.LatestFrameTimings[1], "Inner", 3.0) &&
+            (0 == gpu_timer.LatestFrameTimings[0].Depth) &&
+            (1 == gpu_timer.LatestFrameTimings[1].Depth));
+        report.Check(
+            latest_frame_timed,
+            "The GPU timer didn't report the timings of the newest frame with available results.");
+        const uint64_t EXPECTED_FRAME_LATENCY = 2;
+        report.Check(
+            EXPECTED_FRAME_LATENCY == gpu_timer.LatestFrameLatencyInFrames,
+            "The GPU timer reported the wrong frame latency for its results.");
+
+        // CHECK THAT EACH PASS IS AVERAGED OVER THE FRAMES WITH RESULTS.
+        std::vector<GRAPHICS::OPEN_GL::GpuTimer::PassTiming> average_pass_timings = gpu_timer.AveragePassTimings();
+        bool passes_averaged = (
+            (2 == gpu_timer.AveragedFrameCount) &&
+            (PASSES_PER_FRAME == average_pass_timings.size()) &&
+            PassTimed(average_pass_timings[0], "Outer", 5.0) &&
+            PassTimed(average_pass_timings[1], "Inner", 2.0));
+        report.Check(
+            passes_averaged,
+            "The GPU timer didn't average the time for each pass over frames.");
+
+        // CHECK THAT A PARTIALLY FINISHED FRAME ISN'T READ.
+        gpu_timer.BeginPass("Outer");
+        query_source.FinishIssuedQueries();
+        gpu_timer.EndPass();
+        gpu_timer.EndFrame();
+        report.Check(
+            PassTimed(gpu_timer.LatestFrameTimings[0], "Outer", 6.0),
+            "The GPU timer reported timings for a frame whose last query wasn't finished.");
+        report.Check(
+            0 == query_source.UnavailableResultReadCount,
+            "The GPU timer stalled reading a partially finished frame.");
+
+        // CHECK THAT RESETTING AVERAGES ONLY AVERAGES LATER FRAMES.
+        gpu_timer.ResetAverages();
+        TimeNestedPasses(2, 8, query_source, gpu_timer);
+        query_source.FinishIssuedQueries();
+        gpu_timer.EndFrame();
+        average_pass_timings = gpu_timer.AveragePassTimings();
+        bool averages_reset = (
+            (2 == gpu_timer.AveragedFrameCount) &&
+            (PASSES_PER_FRAME == average_pass_timings.size()) &&
+            PassTimed(average_pass_timings[0], "Outer", 4.0) &&
+            PassTimed(average_pass_timings[1], "Inner", 2.0));
+        report.Check(
+            averages_reset,
+            "The GPU timer averaged frames from before its averages were reset.");
+
+        // CHECK THAT QUERIES ARE RECYCLED RATHER THAN CREATED EVERY FRAME.
+        const unsigned int MANY_FRAME_COUNT = 100;
+        for (unsigned int frame_index = 0; frame_index < MANY_FRAME_COUNT; ++frame_index)
+        {
+            TimeNestedPasses(1, 2, query_source, gpu_timer);
+            query_source.FinishIssuedQueries();
+        }
+        report.Check(
+            GRAPHICS::OPEN_GL::GpuTimer::QUERY_ALLOCATION_COUNT == query_source.ExistingQueryCount,
+            "The GPU timer created new queries instead of recycling finished ones.");
+
+        // CHECK THAT FRAMES ARE DISCARDED IF RESULTS NEVER ARRIVE.
+        for (unsigned int frame_index = 0; frame_index <= GRAPHICS::OPEN_GL::GpuTimer::MAX_PENDING_FRAME_COUNT; ++frame_index)
+        {
+            TimeNestedPasses(1, 2, query_source, gpu_timer);
+        }
+        report.Check(
+            1 == gpu_timer.DiscardedFrameCount,
+            "The GPU timer didn't discard the oldest frame when too many frames were waiting for results.");
+    }
+}
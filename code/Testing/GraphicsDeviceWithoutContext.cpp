@@ -0,0 +1,19 @@
+#include <Windows.h>
+#include "Testing/GraphicsDeviceWithoutContext.h"
+
+namespace TESTING
+{
+    /// Creates a graphics device without a rendering context.  This is only suitable for
+    /// checking bookkeeping that never calls OpenGL, like creating and destroying resources
+    /// that have never been used (and therefore never allocated on the device).
+    /// @return The graphics device.
+    std::shared_ptr<GRAPHICS::OPEN_GL::GraphicsDevice> CreateGraphicsDeviceWithoutContext()
+    {
+        const HDC NO_DEVICE_CONTEXT = NULL;
+        const HGLRC NO_RENDER_CONTEXT = NULL;
+        std::shared_ptr<GRAPHICS::OPEN_GL::GraphicsDevice> graphics_device = std::make_shared<GRAPHICS::OPEN_GL::GraphicsDevice>(
+            NO_DEVICE_CONTEXT,
+            NO_RENDER_CONTEXT);
+        return graphics_device;
+    }
+}
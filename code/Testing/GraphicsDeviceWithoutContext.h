@@ -0,0 +1,9 @@
+#pragma once
+
+#include <memory>
+#include "Graphics/OpenGL/GraphicsDevice.h"
+
+namespace TESTING
+{
+    std::shared_ptr<GRAPHICS::OPEN_GL::GraphicsDevice> CreateGraphicsDeviceWithoutContext();
+}
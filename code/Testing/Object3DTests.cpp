@@ -0,0 +1,106 @@
+#include <memory>
+#include <utility>
+#include <vector>
+#include "Graphics/Color.h"
+#include "Graphics/Mesh.h"
+#include "Graphics/Object3D.h"
+#include "Graphics/Vertex.h"
+#include "Math/Vector3.h"
+#include "Testing/AllocationCounter.h"
+#include "Testing/Object3DTests.h"
+
+namespace TESTING
+{
+    /// Checks that objects share and move their meshes without copying vertices,
+    /// only copying a mesh when an object changes one that other objects share.
+    ///
+    /// Allocated bytes are compared against the size of the vertices rather than checking
+    /// for exact allocation counts since small bookkeeping allocations (like those made for
+    /// version tracking or by debug builds of standard containers) vary between builds.
+    /// @param[in,out]  report - The report to add the results of the checks to.
+    void TestObject3DAllocations(TestReport& report)
+    {
+        // CREATE VERTICES LARGE ENOUGH FOR ANY COPIES OF THEM TO STAND OUT.
+        const std::size_t VERTEX_COUNT = 1024;
+        const uint64_t VERTICES_SIZE_IN_BYTES = VERTEX_COUNT * sizeof(GRAPHICS::Vertex);
+        const GRAPHICS::Vertex ORIGINAL_VERTEX(MATH::Vector3f(0.0f, 0.0f, 0.0f), GRAPHICS::Color(1.0f, 1.0f, 1.0f));
+        const GRAPHICS::Vertex CHANGED_VERTEX(MATH::Vector3f(1.0f, 0.0f, 0.0f), GRAPHICS::Color(1.0f, 0.0f, 0.0f));
+        std::vector<GRAPHICS::Vertex> vertices(VERTEX_COUNT, ORIGINAL_VERTEX);
+
+        // CHECK THAT CREATING A MESH FROM MOVED VERTICES DOESN'T COPY THEM.
+        std::shared_ptr<const GRAPHICS::Mesh> mesh = nullptr;
+        {
+            AllocationCounter allocation_counter;
+            mesh = GRAPHICS::Mesh::Create(std::move(vertices));
+            report.Check(
+                allocation_counter.AllocatedByteCount() < VERTICES_SIZE_IN_BYTES,
+                "Creating a mesh from moved vertices copied the vertices.");
+        }
+
+        // CHECK THAT COPYING AN OBJECT SHARES ITS MESH.
+        GRAPHICS::Object3D original_object(mesh);
+        mesh = nullptr;
+        {
+            AllocationCounter allocation_counter;
+            GRAPHICS::Object3D copied_object = original_object;
+            report.Check(
+                allocation_counter.AllocatedByteCount() < VERTICES_SIZE_IN_BYTES,
+                "Copying an object copied its vertices.");
+            report.Check(
+                copied_object.GetMesh() == original_object.GetMesh(),
+                "Copying an object didn't share its mesh.");
+        }
+
+        // CHECK THAT MOVING AN OBJECT MOVES ITS MESH.
+        GRAPHICS::Object3D shared_object = original_object;
+        {
+            GRAPHICS::Object3D object_to_move = original_object;
+            AllocationCounter allocation_counter;
+            GRAPHICS::Object3D moved_object = std::move(object_to_move);
+            report.Check(
+                allocation_counter.AllocatedByteCount() < VERTICES_SIZE_IN_BYTES,
+                "Moving an object copied its vertices.");
+            report.Check(
+                moved_object.GetMesh() == original_object.GetMesh(),
+                "Moving an object didn't move its mesh.");
+        }
+
+        // CHECK THAT CHANGING A SHARED MESH COPIES IT EXACTLY ONCE.
+        {
+            AllocationCounter allocation_counter;
+            shared_object.SetVertex(0, CHANGED_VERTEX);
+            uint64_t allocated_byte_count = allocation_counter.AllocatedByteCount();
+            report.Check(
+                (allocated_byte_count >= VERTICES_SIZE_IN_BYTES) && (allocated_byte_count < 2 * VERTICES_SIZE_IN_BYTES),
+                "Changing a vertex of a shared mesh didn't copy the vertices exactly once.");
+            report.Check(
+                (shared_object.GetVertices()[0] == CHANGED_VERTEX) && (original_object.GetVertices()[0] == ORIGINAL_VERTEX),
+                "Changing a vertex of a shared mesh affected other objects sharing the mesh.");
+        }
+
+        // CHECK THAT CHANGING AN UNSHARED MESH CHANGES IT IN PLACE.
+        // The mesh's version must still change so that consumers holding onto the mesh notice the change.
+        {
+            const GRAPHICS::Mesh* unshared_mesh = shared_object.GetMesh().get();
+            uint64_t original_mesh_version = unshared_mesh->Version;
+            AllocationCounter allocation_counter;
+            shared_object.SetVertex(1, CHANGED_VERTEX);
+            report.Check(
+                allocation_counter.AllocatedByteCount() < VERTICES_SIZE_IN_BYTES,
+                "Changing a vertex of an unshared mesh copied the vertices.");
+            report.Check(
+                (shared_object.GetMesh().get() == unshared_mesh) && (unshared_mesh->Version != original_mesh_version),
+                "Changing a vertex of an unshared mesh didn't change the mesh in place with a new version.");
+        }
+
+        // CHECK THAT REPLACING THE VERTICES OF AN UNSHARED MESH MOVES THEM.
+        {
+            std::vector<GRAPHICS::Vertex> replacement_vertices(VERTEX_COUNT, CHANGED_VERTEX);
+            AllocationCounter allocation_counter;
+            shared_object.SetVertices(std::move(replacement_vertices));
+            report.Check(
+                allocation_counter.AllocatedByteCount() < VERTICES_SIZE_IN_BYTES,
+                "Replacing the vertices of an unshared mesh copied the vertices.");
+        }
+    }
+}
@@ -0,0 +1,8 @@
+#pragma once
+
+#include "Testing/TestReport.h"
+
+namespace TESTING
+{
+    void TestObject3DAllocations(TestReport& report);
+}
@@ -0,0 +1,70 @@
+#include <memory>
+#include "Graphics/OpenGL/GraphicsDevice.h"
+#include "Graphics/OpenGL/PipelineState.h"
+#include "Testing/GraphicsDeviceWithoutContext.h"
+#include "Testing/PipelineStateTests.h"
+
+namespace TESTING
+{
+    /// Checks that identical pipeline state descriptions hash equally and share a single
+    /// pipeline state, while descriptions differing in any state get their own.
+    /// @param[in,out]  report - The report to add the results of the checks to.
+    void TestPipelineStateDeduplication(TestReport& report)
+    {
+        // CREATE A GRAPHICS DEVICE.
+        // Pipeline states are only applied when drawing, so creating them doesn't need a rendering context.
+        std::shared_ptr<GRAPHICS::OPEN_GL::GraphicsDevice> graphics_device = CreateGraphicsDeviceWithoutContext();
+
+        // CHECK THAT IDENTICAL DESCRIPTIONS SHARE A PIPELINE STATE.
+        GRAPHICS::OPEN_GL::PipelineStateDescription description;
+        description.Blend = GRAPHICS::OPEN_GL::BlendMode::ALPHA;
+        description.DepthTestEnabled = true;
+        GRAPHICS::OPEN_GL::PipelineStateDescription identical_description = description;
+        report.Check(
+            (identical_description == description) && (identical_description.Hash() == description.Hash()),
+            "Identical pipeline state descriptions weren't equal with equal hashes.");
+
+        std::shared_ptr<const GRAPHICS::OPEN_GL::PipelineState> pipeline_state = graphics_device->CreatePipelineState(description);
+        std::shared_ptr<const GRAPHICS::OPEN_GL::PipelineState> identical_pipeline_state = graphics_device->CreatePipelineState(identical_description);
+        report.Check(
+            (pipeline_state == identical_pipeline_state) && (1 == graphics_device->PipelineStateCount()),
+            "Identical pipeline state descriptions didn't share a single pipeline state.");
+
+        // CHECK THAT CHANGING ANY STATE CREATES A DIFFERENT PIPELINE STATE.
+        // Each description changes a single piece of state from the original.
+        // Shader programs can't be created without a rendering context, so only fixed-function state is changed.
+        const unsigned int CHANGED_DESCRIPTION_COUNT = 6;
+        GRAPHICS::OPEN_GL::PipelineStateDescription changed_descriptions[CHANGED_DESCRIPTION_COUNT] =
+        {
+            description, description, description, description, description, description
+        };
+        changed_descriptions[0].Blend = GRAPHICS::OPEN_GL::BlendMode::ADDITIVE;
+        changed_descriptions[1].ColorWriteEnabled = false;
+        changed_descriptions[2].DepthTestEnabled = false;
+        changed_descriptions[3].DepthWriteEnabled = false;
+        changed_descriptions[4].DepthComparison = GL_LEQUAL;
+        changed_descriptions[5].Cull = GRAPHICS::OPEN_GL::CullMode::BACK_FACES;
+        for (const GRAPHICS::OPEN_GL::PipelineStateDescription& changed_description : changed_descriptions)
+        {
+            bool description_distinct = (
+                (changed_description != description) &&
+                (changed_description.Hash() != description.Hash()));
+            std::shared_ptr<const GRAPHICS::OPEN_GL::PipelineState> changed_pipeline_state = graphics_device->CreatePipelineState(changed_description);
+            bool pipeline_state_distinct = (changed_pipeline_state != pipeline_state);
+            report.Check(
+                description_distinct && pipeline_state_distinct,
+                "Changing a piece of state shared the pipeline state of the unchanged description.");
+        }
+        report.Check(
+            (1 + CHANGED_DESCRIPTION_COUNT) == graphics_device->PipelineStateCount(),
+            "The number of unique pipeline states didn't match the number of unique descriptions.");
+
+        // CHECK THAT RECREATING A CHANGED DESCRIPTION REUSES ITS PIPELINE STATE.
+        std::shared_ptr<const GRAPHICS::OPEN_GL::PipelineState> first_changed_pipeline_state = graphics_device->CreatePipelineState(changed_descriptions[0]);
+        std::shared_ptr<const GRAPHICS::OPEN_GL::PipelineState> recreated_pipeline_state = graphics_device->CreatePipelineState(changed_descriptions[0]);
+        report.Check(
+            (first_changed_pipeline_state == recreated_pipeline_state) &&
+            ((1 + CHANGED_DESCRIPTION_COUNT) == graphics_device->PipelineStateCount()),
+            "Recreating a pipeline state from an existing description created a new pipeline state.");
+    }
+}
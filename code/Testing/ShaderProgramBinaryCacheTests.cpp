@@ -0,0 +1,117 @@
+#include <string>
+#include "Graphics/OpenGL/Shaders/PredefinedShaders.h"
+#include "Graphics/OpenGL/Shaders/ShaderProgramBinaryCache.h"
+#include "Graphics/OpenGL/Shaders/ShaderProgramDescription.h"
+#include "Testing/ShaderProgramBinaryCacheTests.h"
+
+namespace TESTING
+{
+    /// Determines if two shader program binary cache keys are entirely equal.
+    /// @param[in]  first_key - The first key to compare.
+    /// @param[in]  second_key - The second key to compare.
+    /// @return True if every part of the keys is equal; false otherwise.
+    static bool KeysEqual(
+        const GRAPHICS::OPEN_GL::SHADERS::ShaderProgramBinaryCache::ProgramKey& first_key,
+        const GRAPHICS::OPEN_GL::SHADERS::ShaderProgramBinaryCache::ProgramKey& second_key)
+    {
+        bool keys_equal = (
+            (first_key.Hash == second_key.Hash) &&
+            (first_key.CheckHash == second_key.CheckHash) &&
+            (first_key.VertexShaderSourceLength == second_key.VertexShaderSourceLength) &&
+            (first_key.FragmentShaderSourceLength == second_key.FragmentShaderSourceLength));
+        return keys_equal;
+    }
+
+    /// Determines if both hashes of two shader program binary cache keys differ,
+    /// so that a change can't be missed by either hash alone.
+    /// @param[in]  first_key - The first key to compare.
+    /// @param[in]  second_key - The second key to compare.
+    /// @return True if both hashes differ; false otherwise.
+    static bool HashesDiffer(
+        const GRAPHICS::OPEN_GL::SHADERS::ShaderProgramBinaryCache::ProgramKey& first_key,
+        const GRAPHICS::OPEN_GL::SHADERS::ShaderProgramBinaryCache::ProgramKey& second_key)
+    {
+        bool hashes_differ = (
+            (first_key.Hash != second_key.Hash) &&
+            (first_key.CheckHash != second_key.CheckHash));
+        return hashes_differ;
+    }
+
+    /// Checks that shader program binary cache keys are stable for identical programs and drivers
+    /// but change with any shader source code, input or output binding, or graphics driver, so that
+    /// a stale binary is never loaded for a changed program.
+    /// @param[in,out]  report - The report to add the results of the checks to.
+    void TestShaderProgramBinaryCacheKeys(TestReport& report)
+    {
+        // CREATE CACHES FOR DIFFERENT DRIVERS.
+        // Keys are computed without touching the cache directory, so it doesn't need to exist.
+        const std::string UNUSED_DIRECTORY_PATH = "";
+        const std::string DRIVER_IDENTIFIER = "Vendor\nRenderer\n4.6.0 Driver 1.0\n";
+        const std::string UPDATED_DRIVER_IDENTIFIER = "Vendor\nRenderer\n4.6.0 Driver 1.1\n";
+        GRAPHICS::OPEN_GL::SHADERS::ShaderProgramBinaryCache cache(UNUSED_DIRECTORY_PATH, DRIVER_IDENTIFIER);
+        GRAPHICS::OPEN_GL::SHADERS::ShaderProgramBinaryCache updated_driver_cache(UNUSED_DIRECTORY_PATH, UPDATED_DRIVER_IDENTIFIER);
+
+        const GRAPHICS::OPEN_GL::SHADERS::ShaderProgramDescription& DESCRIPTION = GRAPHICS::OPEN_GL::SHADERS::POSITION_COLOR_SHADER_DESCRIPTION;
+        GRAPHICS::OPEN_GL::SHADERS::ShaderProgramBinaryCache::ProgramKey key = cache.Key(DESCRIPTION);
+
+        // CHECK THAT IDENTICAL PROGRAMS AND DRIVERS HAVE IDENTICAL KEYS.
+        GRAPHICS::OPEN_GL::SHADERS::ShaderProgramDescription identical_description = DESCRIPTION;
+        GRAPHICS::OPEN_GL::SHADERS::ShaderProgramBinaryCache identical_driver_cache(UNUSED_DIRECTORY_PATH, DRIVER_IDENTIFIER);
+        report.Check(
+            KeysEqual(key, cache.Key(identical_description)) && KeysEqual(key, identical_driver_cache.Key(DESCRIPTION)),
+            "Identical shader programs and drivers had different binary cache keys.");
+        report.Check(
+            (DESCRIPTION.VertexShader.UncompiledCode.size() == key.VertexShaderSourceLength) &&
+            (DESCRIPTION.FragmentShader.UncompiledCode.size() == key.FragmentShaderSourceLength),
+            "A binary cache key didn't record the lengths of the shader source code.");
+
+        // CHECK THAT A DIFFERENT DRIVER CHANGES THE KEY.
+        report.Check(
+            HashesDiffer(key, updated_driver_cache.Key(DESCRIPTION)),
+            "A different graphics driver didn't change the binary cache key.");
+
+        // CHECK THAT CHANGING THE SOURCE CODE CHANGES THE KEY.
+        // Changing a single character keeps the source lengths the same, so only the hashes can catch it.
+        GRAPHICS::OPEN_GL::SHADERS::ShaderProgramDescription changed_vertex_shader_description = DESCRIPTION;
+        changed_vertex_shader_description.VertexShader.UncompiledCode.back() = '\t';
+        report.Check(
+            HashesDiffer(key, cache.Key(changed_vertex_shader_description)),
+            "Changing the vertex shader's source code didn't change the binary cache key.");
+
+        GRAPHICS::OPEN_GL::SHADERS::ShaderProgramDescription changed_fragment_shader_description = DESCRIPTION;
+        changed_fragment_shader_description.FragmentShader.UncompiledCode.back() = '\t';
+        report.Check(
+            HashesDiffer(key, cache.Key(changed_fragment_shader_description)),
+            "Changing the fragment shader's source code didn't change the binary cache key.");
+
+        // CHECK THAT MOVING CODE BETWEEN SHADERS CHANGES THE KEY.
+        // The combined source code is the same, so this only differs if each shader is hashed separately.
+        GRAPHICS::OPEN_GL::SHADERS::ShaderProgramDescription moved_code_description = DESCRIPTION;
+        std::string& moved_vertex_shader_code = moved_code_description.VertexShader.UncompiledCode;
+        moved_code_description.FragmentShader.UncompiledCode.insert(0, 1, moved_vertex_shader_code.back());
+        moved_vertex_shader_code.pop_back();
+        GRAPHICS::OPEN_GL::SHADERS::ShaderProgramBinaryCache::ProgramKey moved_code_key = cache.Key(moved_code_description);
+        report.Check(
+            HashesDiffer(key, moved_code_key) && !KeysEqual(key, moved_code_key),
+            "Moving source code between shaders didn't change the binary cache key.");
+
+        // CHECK THAT CHANGING INPUT OR OUTPUT BINDINGS CHANGES THE KEY.
+        GRAPHICS::OPEN_GL::SHADERS::ShaderProgramDescription renamed_input_description = DESCRIPTION;
+        report.Check(
+            !renamed_input_description.VertexShader.InputVariables.empty(),
+            "The shader program used for checking binary cache keys had no vertex inputs.");
+        if (!renamed_input_description.VertexShader.InputVariables.empty())
+        {
+            renamed_input_description.VertexShader.InputVariables.front().Name += "_renamed";
+            report.Check(
+                HashesDiffer(key, cache.Key(renamed_input_description)),
+                "Renaming a vertex shader input didn't change the binary cache key.");
+        }
+
+        GRAPHICS::OPEN_GL::SHADERS::ShaderProgramDescription renamed_output_description = DESCRIPTION;
+        renamed_output_description.FragmentShader.OutputColorVariableName += "_renamed";
+        report.Check(
+            HashesDiffer(key, cache.Key(renamed_output_description)),
+            "Renaming the fragment shader's output color didn't change the binary cache key.");
+    }
+}
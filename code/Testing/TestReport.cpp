@@ -0,0 +1,40 @@
+#include "Testing/TestReport.h"
+
+namespace TESTING
+{
+    /// Records the result of a single check.
+    /// @param[in]  passed - True if the check passed; false if it failed.
+    /// @param[in]  description - A description of what was checked.
+    void TestReport::Check(const bool passed, const std::string& description)
+    {
+        if (passed)
+        {
+            ++PassedCheckCount;
+        }
+        else
+        {
+            FailedCheckDescriptions.push_back(description);
+        }
+    }
+
+    /// Determines if all checks passed.
+    /// @return True if no checks failed; false otherwise.
+    bool TestReport::AllPassed() const
+    {
+        bool all_passed = FailedCheckDescriptions.empty();
+        return all_passed;
+    }
+
+    /// Summarizes the results of the checks, listing each failed check on its own line.
+    /// @return The summary, ending with a newline.
+    std::string TestReport::Summary() const
+    {
+        std::string summary = std::to_string(PassedCheckCount) + " checks passed, ";
+        summary += std::to_string(FailedCheckDescriptions.size()) + " failed\n";
+        for (const std::string& failed_check_description : FailedCheckDescriptions)
+        {
+            summary += "FAILED: " + failed_check_description + "\n";
+        }
+        return summary;
+    }
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace TESTING
+{
+    /// The results of a set of checks, recording descriptions of any that failed.
+    class TestReport
+    {
+    public:
+        // CHECKING.
+        void Check(const bool passed, const std::string& description);
+
+        // RESULTS.
+        bool AllPassed() const;
+        std::string Summary() const;
+
+        // PUBLIC MEMBER VARIABLES FOR EASY ACCESS.
+        /// The number of checks that passed.
+        unsigned int PassedCheckCount = 0;
+        /// The descriptions of checks that failed, in the order they were made.
+        std::vector<std::string> FailedCheckDescriptions = {};
+    };
+}
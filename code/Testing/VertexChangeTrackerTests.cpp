@@ -0,0 +1,89 @@
+#include <cstddef>
+#include <vector>
+#include "Graphics/VertexChangeTracker.h"
+#include "Testing/VertexChangeTrackerTests.h"
+
+namespace TESTING
+{
+    /// Creates a range of vertices.
+    /// @param[in]  first_vertex - The index of the first vertex in the range.
+    /// @param[in]  vertex_count - The number of vertices in the range.
+    /// @return The range.
+    static GRAPHICS::VertexRange CreateRange(const std::size_t first_vertex, const std::size_t vertex_count)
+    {
+        GRAPHICS::VertexRange range;
+        range.FirstVertex = first_vertex;
+        range.VertexCount = vertex_count;
+        return range;
+    }
+
+    /// Determines if a range covers specific vertices.
+    /// @param[in]  range - The range to check.
+    /// @param[in]  expected_first_vertex - The expected index of the first vertex in the range.
+    /// @param[in]  expected_vertex_count - The expected number of vertices in the range.
+    /// @return True if the range covers exactly the expected vertices; false otherwise.
+    static bool RangeCovers(
+        const GRAPHICS::VertexRange& range,
+        const std::size_t expected_first_vertex,
+        const std::size_t expected_vertex_count)
+    {
+        bool range_covers_vertices = (
+            (expected_first_vertex == range.FirstVertex) &&
+            (expected_vertex_count == range.VertexCount));
+        return range_covers_vertices;
+    }
+
+    /// Checks that coalescing sorts ranges, merges ranges that overlap or are separated by
+    /// small enough gaps, keeps ranges separated by larger gaps apart, and drops empty ranges.
+    /// @param[in,out]  report - The report to add the results of the checks to.
+    void TestVertexRangeCoalescing(TestReport& report)
+    {
+        const std::size_t MAX_GAP_VERTEX_COUNT = 4;
+
+        // CHECK THAT NEARBY AND OVERLAPPING RANGES ARE MERGED REGARDLESS OF ORDER.
+        // The ranges are out of order, with [10, 15) overlapping [12, 14) and 4 unchanged vertices before [19, 21).
+        std::vector<GRAPHICS::VertexRange> ranges =
+        {
+            CreateRange(19, 2),
+            CreateRange(12, 2),
+            CreateRange(10, 5)
+        };
+        GRAPHICS::VertexRange::Coalesce(MAX_GAP_VERTEX_COUNT, ranges);
+        report.Check(
+            (1 == ranges.size()) && RangeCovers(ranges[0], 10, 11),
+            "Vertex ranges separated by a small enough gap or overlapping weren't coalesced into one range.");
+
+        // CHECK THAT RANGES SEPARATED BY LARGER GAPS STAY SEPARATE.
+        ranges =
+        {
+            CreateRange(0, 2),
+            CreateRange(7, 1)
+        };
+        GRAPHICS::VertexRange::Coalesce(MAX_GAP_VERTEX_COUNT, ranges);
+        report.Check(
+            (2 == ranges.size()) && RangeCovers(ranges[0], 0, 2) && RangeCovers(ranges[1], 7, 1),
+            "Vertex ranges separated by a gap larger than the maximum were coalesced.");
+
+        // CHECK THAT A RANGE INSIDE ANOTHER DOESN'T SHRINK IT.
+        ranges =
+        {
+            CreateRange(0, 10),
+            CreateRange(2, 3)
+        };
+        GRAPHICS::VertexRange::Coalesce(MAX_GAP_VERTEX_COUNT, ranges);
+        report.Check(
+            (1 == ranges.size()) && RangeCovers(ranges[0], 0, 10),
+            "Coalescing a vertex range contained in another changed the containing range.");
+
+        // CHECK THAT EMPTY RANGES ARE DROPPED.
+        ranges =
+        {
+            CreateRange(3, 0),
+            CreateRange(50, 0)
+        };
+        GRAPHICS::VertexRange::Coalesce(MAX_GAP_VERTEX_COUNT, ranges);
+        report.Check(
+            ranges.empty(),
+            "Empty vertex ranges were kept after coalescing.");
+    }
+}
@@ -1,14 +1,30 @@
 #include <chrono>
 #include <cstdlib>
+#include <cstring>
 #include <memory>
 #include <string>
+#include <vector>
 #include <Windows.h>
 #include "Graphics/Color.h"
+#include "Graphics/Mesh.h"
+#include "Graphics/Object3D.h"
+#include "Graphics/OpenGL/GpuTimer.h"
 #include "Graphics/OpenGL/GraphicsDevice.h"
 #include "Graphics/OpenGL/OpenGL.h"
 #include "Graphics/OpenGL/Renderer.h"
+#include "Graphics/OpenGL/ShaderProgramVariants.h"
 #include "Graphics/OpenGL/Shaders/ShaderProgram.h"
 #include "Graphics/Triangle.h"
+#ifdef SELF_TESTS_ENABLED
+#include "Testing/BuddyAllocatorTests.h"
+#include "Testing/GpuResourceManagerTests.h"
+#include "Testing/GpuTimerTests.h"
+#include "Testing/Object3DTests.h"
+#include "Testing/PipelineStateTests.h"
+#include "Testing/ShaderProgramBinaryCacheTests.h"
+#include "Testing/TestReport.h"
+#include "Testing/VertexChangeTrackerTests.h"
+#endif
 #include "Windowing/Win32Window.h"
 
 using namespace GRAPHICS;
@@ -23,6 +39,223 @@ static std::unique_ptr<WINDOWING::Win32Window> g_window = nullptr;
 /// @todo   Document.
 static std::unique_ptr<Renderer> g_renderer = nullptr;
 
+/// Creates a dense indoor-like scene for measuring occlusion culling.  The visible area is divided
+/// into a grid of rooms, each closed off by a wall facing the camera except for a few with open
+/// doorways, and each room is filled with small pieces of furniture behind its wall.  Most furniture
+/// is therefore hidden, much like the contents of neighboring rooms in a real building.
+/// @return The objects in the scene.  They should not be added to or removed from after creation
+///     since the renderer may hold their addresses until the end of a frame.
+static std::vector<Object3D> CreateIndoorBenchmarkScene()
+{
+    // DEFINE THE LAYOUT OF THE SCENE.
+    // Positions are chosen to lie within the camera's default view volume.
+    const unsigned int ROOM_COUNT_PER_SIDE = 8;
+    const float SCENE_MIN_COORDINATE = -1.0f;
+    const float SCENE_SIZE = 2.0f;
+    const float ROOM_SIZE = SCENE_SIZE / static_cast<float>(ROOM_COUNT_PER_SIDE);
+    const float WALL_Z = 0.25f;
+    const float NEAREST_FURNITURE_Z = 0.0f;
+    const float FURTHEST_FURNITURE_Z = -1.25f;
+    const unsigned int FURNITURE_COUNT_PER_ROOM = 16;
+    const unsigned int ROOM_COUNT_PER_DOORWAY = 7;
+
+    // CREATE THE SHARED MESHES.
+    const float HALF_ROOM_SIZE = ROOM_SIZE / 2.0f;
+    const Color WALL_COLOR(0.5f, 0.5f, 0.5f);
+    std::shared_ptr<const Mesh> wall_mesh = Mesh::Create(std::vector<Vertex>
+    {
+        Vertex(MATH::Vector3f(-HALF_ROOM_SIZE, -HALF_ROOM_SIZE, 0.0f), WALL_COLOR),
+        Vertex(MATH::Vector3f(HALF_ROOM_SIZE, -HALF_ROOM_SIZE, 0.0f), WALL_COLOR),
+        Vertex(MATH::Vector3f(HALF_ROOM_SIZE, HALF_ROOM_SIZE, 0.0f), WALL_COLOR),
+        Vertex(MATH::Vector3f(-HALF_ROOM_SIZE, -HALF_ROOM_SIZE, 0.0f), WALL_COLOR),
+        Vertex(MATH::Vector3f(HALF_ROOM_SIZE, HALF_ROOM_SIZE, 0.0f), WALL_COLOR),
+        Vertex(MATH::Vector3f(-HALF_ROOM_SIZE, HALF_ROOM_SIZE, 0.0f), WALL_COLOR)
+    });
+    const float HALF_FURNITURE_SIZE = HALF_ROOM_SIZE / 4.0f;
+    std::shared_ptr<const Mesh> furniture_mesh = Mesh::Create(std::vector<Vertex>
+    {
+        Vertex(MATH::Vector3f(0.0f, HALF_FURNITURE_SIZE, 0.0f), Color(1.0f, 0.0f, 0.0f)),
+        Vertex(MATH::Vector3f(HALF_FURNITURE_SIZE, -HALF_FURNITURE_SIZE, 0.0f), Color(0.0f, 1.0f, 0.0f)),
+        Vertex(MATH::Vector3f(-HALF_FURNITURE_SIZE, -HALF_FURNITURE_SIZE, 0.0f), Color(0.0f, 0.0f, 1.0f))
+    });
+
+    // CREATE EACH ROOM.
+    std::vector<Object3D> scene_objects;
+    const unsigned int ROOM_COUNT = ROOM_COUNT_PER_SIDE * ROOM_COUNT_PER_SIDE;
+    scene_objects.reserve(ROOM_COUNT * (1 + FURNITURE_COUNT_PER_ROOM));
+    for (unsigned int room_index = 0; room_index < ROOM_COUNT; ++room_index)
+    {
+        unsigned int room_column_index = room_index % ROOM_COUNT_PER_SIDE;
+        unsigned int room_row_index = room_index / ROOM_COUNT_PER_SIDE;
+        float room_center_x = SCENE_MIN_COORDINATE + (static_cast<float>(room_column_index) * ROOM_SIZE) + HALF_ROOM_SIZE;
+        float room_center_y = SCENE_MIN_COORDINATE + (static_cast<float>(room_row_index) * ROOM_SIZE) + HALF_ROOM_SIZE;
+
+        // CLOSE OFF THE ROOM UNLESS IT HAS A DOORWAY.
+        bool room_has_doorway = (0 == (room_index % ROOM_COUNT_PER_DOORWAY));
+        if (!room_has_doorway)
+        {
+            Object3D wall(wall_mesh);
+            wall.WorldPosition = MATH::Vector3f(room_center_x, room_center_y, WALL_Z);
+            scene_objects.push_back(std::move(wall));
+        }
+
+        // SPREAD FURNITURE THROUGHOUT THE ROOM.
+        // Furniture is placed on a grid within the room at varying depths.
+        const unsigned int FURNITURE_COUNT_PER_ROOM_SIDE = 4;
+        const float FURNITURE_SPACING = ROOM_SIZE / static_cast<float>(FURNITURE_COUNT_PER_ROOM_SIDE);
+        const float FURNITURE_DEPTH_RANGE = NEAREST_FURNITURE_Z - FURTHEST_FURNITURE_Z;
+        for (unsigned int furniture_index = 0; furniture_index < FURNITURE_COUNT_PER_ROOM; ++furniture_index)
+        {
+            unsigned int furniture_column_index = furniture_index % FURNITURE_COUNT_PER_ROOM_SIDE;
+            unsigned int furniture_row_index = furniture_index / FURNITURE_COUNT_PER_ROOM_SIDE;
+            float furniture_depth_fraction = static_cast<float>(furniture_index) / static_cast<float>(FURNITURE_COUNT_PER_ROOM);
+
+            Object3D furniture(furniture_mesh);
+            furniture.WorldPosition = MATH::Vector3f(
+                room_center_x - HALF_ROOM_SIZE + ((static_cast<float>(furniture_column_index) + 0.5f) * FURNITURE_SPACING),
+                room_center_y - HALF_ROOM_SIZE + ((static_cast<float>(furniture_row_index) + 0.5f) * FURNITURE_SPACING),
+                NEAREST_FURNITURE_Z - (furniture_depth_fraction * FURNITURE_DEPTH_RANGE));
+            scene_objects.push_back(std::move(furniture));
+        }
+    }
+
+    return scene_objects;
+}
+
+/// Creates a scene with a very large number of small objects spread far beyond the camera's view,
+/// for measuring culling on the GPU.  Moving the camera with the arrow keys brings different
+/// objects into view.
+/// @return The objects in the scene.  They should not be added to or removed from after creation
+///     since the renderer holds their addresses.
+static std::vector<Object3D> CreateGpuCullingBenchmarkScene()
+{
+    // DEFINE THE LAYOUT OF THE SCENE.
+    // The camera's default view only covers a small fraction of the scene.
+    const unsigned int OBJECT_COUNT_PER_SIDE = 256;
+    const float SCENE_MIN_COORDINATE = -16.0f;
+    const float SCENE_SIZE = 32.0f;
+    const float OBJECT_SPACING = SCENE_SIZE / static_cast<float>(OBJECT_COUNT_PER_SIDE);
+    const float HALF_OBJECT_SIZE = OBJECT_SPACING / 4.0f;
+
+    // CREATE THE SHARED MESH.
+    std::shared_ptr<const Mesh> object_mesh = Mesh::Create(std::vector<Vertex>
+    {
+        Vertex(MATH::Vector3f(0.0f, HALF_OBJECT_SIZE, 0.0f), Color(1.0f, 0.0f, 0.0f)),
+        Vertex(MATH::Vector3f(HALF_OBJECT_SIZE, -HALF_OBJECT_SIZE, 0.0f), Color(0.0f, 1.0f, 0.0f)),
+        Vertex(MATH::Vector3f(-HALF_OBJECT_SIZE, -HALF_OBJECT_SIZE, 0.0f), Color(0.0f, 0.0f, 1.0f))
+    });
+
+    // CREATE THE OBJECTS IN A GRID.
+    std::vector<Object3D> scene_objects;
+    scene_objects.reserve(OBJECT_COUNT_PER_SIDE * OBJECT_COUNT_PER_SIDE);
+    for (unsigned int row_index = 0; row_index < OBJECT_COUNT_PER_SIDE; ++row_index)
+    {
+        for (unsigned int column_index = 0; column_index < OBJECT_COUNT_PER_SIDE; ++column_index)
+        {
+            Object3D scene_object(object_mesh);
+            scene_object.WorldPosition = MATH::Vector3f(
+                SCENE_MIN_COORDINATE + ((static_cast<float>(column_index) + 0.5f) * OBJECT_SPACING),
+                SCENE_MIN_COORDINATE + ((static_cast<float>(row_index) + 0.5f) * OBJECT_SPACING),
+                0.0f);
+            scene_objects.push_back(std::move(scene_object));
+        }
+    }
+
+    return scene_objects;
+}
+
+/// Creates a scene of large overlapping layers covering the camera's view, ordered from back to front,
+/// for measuring overdraw with and without a depth pre-pass.  Without a pre-pass, each layer hides
+/// the layer before it only after that layer was already shaded, so every pixel is shaded once per layer.
+/// @return The objects in the scene, ordered from the farthest to the nearest.
+static std::vector<Object3D> CreateDepthPrePassBenchmarkScene()
+{
+    // DEFINE THE LAYOUT OF THE SCENE.
+    // Layers span the depth range between the camera's default near and far planes.
+    const unsigned int LAYER_COUNT = 16;
+    const float HALF_LAYER_SIZE = 1.0f;
+    const float FARTHEST_LAYER_Z = -1.25f;
+    const float LAYER_DEPTH_RANGE = 1.5f;
+
+    // CREATE THE LAYERS FROM BACK TO FRONT.
+    std::vector<Object3D> scene_objects;
+    scene_objects.reserve(LAYER_COUNT);
+    for (unsigned int layer_index = 0; layer_index < LAYER_COUNT; ++layer_index)
+    {
+        // Each layer gets a different color so that the nearest layer being visible can be verified.
+        float layer_fraction = static_cast<float>(layer_index) / static_cast<float>(LAYER_COUNT - 1);
+        Color layer_color(layer_fraction, 0.5f, 1.0f - layer_fraction);
+        std::shared_ptr<const Mesh> layer_mesh = Mesh::Create(std::vector<Vertex>
+        {
+            Vertex(MATH::Vector3f(-HALF_LAYER_SIZE, -HALF_LAYER_SIZE, 0.0f), layer_color),
+            Vertex(MATH::Vector3f(HALF_LAYER_SIZE, -HALF_LAYER_SIZE, 0.0f), layer_color),
+            Vertex(MATH::Vector3f(HALF_LAYER_SIZE, HALF_LAYER_SIZE, 0.0f), layer_color),
+            Vertex(MATH::Vector3f(-HALF_LAYER_SIZE, -HALF_LAYER_SIZE, 0.0f), layer_color),
+            Vertex(MATH::Vector3f(HALF_LAYER_SIZE, HALF_LAYER_SIZE, 0.0f), layer_color),
+            Vertex(MATH::Vector3f(-HALF_LAYER_SIZE, HALF_LAYER_SIZE, 0.0f), layer_color)
+        });
+
+        Object3D layer(layer_mesh);
+        layer.WorldPosition = MATH::Vector3f(0.0f, 0.0f, FARTHEST_LAYER_Z + (layer_fraction * LAYER_DEPTH_RANGE));
+        scene_objects.push_back(std::move(layer));
+    }
+
+    return scene_objects;
+}
+
+/// Measures how fast vertices are uploaded to a vertex buffer.  Vertices are uploaded directly
+/// from their in-memory layout, so the time spent converting them into a temporary float array
+/// (as uploads used to) is also measured for comparison.
+/// @param[in,out]  graphics_device - The graphics device to upload vertices to.
+/// @return A report of the upload throughput.
+static std::string RunVertexUploadBenchmark(GraphicsDevice& graphics_device)
+{
+    // CREATE THE VERTICES TO UPLOAD.
+    const std::size_t VERTEX_COUNT = 10 * 1000 * 1000;
+    const unsigned int UPLOAD_COUNT = 5;
+    std::vector<Vertex> vertices(VERTEX_COUNT, Vertex(MATH::Vector3f(0.0f, 0.0f, 0.0f), Color(1.0f, 1.0f, 1.0f)));
+    double vertices_size_in_megabytes = static_cast<double>(VERTEX_COUNT * sizeof(Vertex)) / (1024.0 * 1024.0);
+
+    // MEASURE UPLOADING THE VERTICES.
+    // Waiting for the graphics device to finish ensures that the driver has consumed each upload.
+    std::shared_ptr<VertexBuffer> vertex_buffer = graphics_device.CreateVertexBuffer();
+    auto upload_start_time = std::chrono::high_resolution_clock::now();
+    for (unsigned int upload_index = 0; upload_index < UPLOAD_COUNT; ++upload_index)
+    {
+        vertex_buffer->Fill(vertices);
+        glFinish();
+    }
+    auto upload_end_time = std::chrono::high_resolution_clock::now();
+    graphics_device.Destroy(vertex_buffer);
+    double upload_time_in_seconds = std::chrono::duration_cast<std::chrono::duration<double>>(upload_end_time - upload_start_time).count() / UPLOAD_COUNT;
+
+    // MEASURE CONVERTING THE VERTICES INTO A TEMPORARY FLOAT ARRAY FOR COMPARISON.
+    auto conversion_start_time = std::chrono::high_resolution_clock::now();
+    std::vector<float> vertex_data;
+    for (const Vertex& vertex : vertices)
+    {
+        vertex_data.push_back(vertex.ObjectSpacePosition.X);
+        vertex_data.push_back(vertex.ObjectSpacePosition.Y);
+        vertex_data.push_back(vertex.ObjectSpacePosition.Z);
+        vertex_data.push_back(vertex.Color.Red);
+        vertex_data.push_back(vertex.Color.Green);
+        vertex_data.push_back(vertex.Color.Blue);
+        vertex_data.push_back(vertex.Color.Alpha);
+    }
+    auto conversion_end_time = std::chrono::high_resolution_clock::now();
+    double conversion_time_in_seconds = std::chrono::duration_cast<std::chrono::duration<double>>(conversion_end_time - conversion_start_time).count();
+
+    // REPORT THE RESULTS.
+    const double MILLISECONDS_PER_SECOND = 1000.0;
+    std::string vertex_upload_report = "Vertex upload benchmark: " + std::to_string(VERTEX_COUNT) + " vertices (";
+    vertex_upload_report += std::to_string(vertices_size_in_megabytes) + " MB) uploaded in ";
+    vertex_upload_report += std::to_string(upload_time_in_seconds * MILLISECONDS_PER_SECOND) + " ms (";
+    vertex_upload_report += std::to_string(vertices_size_in_megabytes / upload_time_in_seconds) + " MB/s), ";
+    vertex_upload_report += std::to_string(conversion_time_in_seconds * MILLISECONDS_PER_SECOND) + " ms avoided by not converting to ";
+    vertex_upload_report += std::to_string(vertex_data.size()) + " floats\n";
+    return vertex_upload_report;
+}
+
 /// The main window callback procedure for processing messages sent to the main application window.
 /// @param[in]  window - Handle to the window.
 /// @param[in]  message - The message.
@@ -123,6 +356,19 @@ LRESULT CALLBACK MainWindowCallback(
 /// @param[in]  application_instance - A handle to the current instance of the application.
 /// @param[in]  previous_application_instance - Always NULL.
 /// @param[in]  command_line_string - The command line parameters for the application.
+///     Passing "occlusion-benchmark" draws a dense indoor scene with occlusion culling
+///     and periodically reports how many draws were culled.  Passing "gpu-culling-benchmark"
+///     draws a very large number of objects culled on the GPU.  Passing "depth-prepass-benchmark"
+///     draws heavily overlapping layers, alternating between drawing with and without a depth
+///     pre-pass each reporting period, and reports the overdraw of each.
+///     Passing "no-multi-draw-indirect" draws instances with one call per mesh even if multi-draw
+///     indirect rendering is supported.  Passing "vertex-upload-benchmark" measures the throughput
+///     of uploading 10 million vertices at startup.  Passing "debug-output" or "no-debug-output"
+///     enables or disables logging errors reported by the driver, overriding the default of
+///     logging them only in debug builds.  In self-test builds (see build.bat), passing
+///     "self-test" runs checks of code not requiring a graphics device (such as how much memory
+///     copying objects allocates or how GPU timings are read from synthetic query results)
+///     and reports the results.
 /// @param[in]  window_show_code - Controls how the window is to be shown.
 /// @return     An exit code.  0 for success.
 int CALLBACK WinMain(
@@ -133,9 +379,28 @@ int CALLBACK WinMain(
 {
     // REFERENCE UNUSED PARAMETERS TO PREVENT COMPILER WARNINGS.
     previous_application_instance;
-    command_line_string;
     window_show_code;
 
+#ifdef SELF_TESTS_ENABLED
+    // RUN SELF-TESTS IF REQUESTED.
+    bool self_tests_enabled = (nullptr != std::strstr(command_line_string, "self-test"));
+    if (self_tests_enabled)
+    {
+        TESTING::TestReport test_report;
+        TESTING::TestObject3DAllocations(test_report);
+        TESTING::TestGpuTimer(test_report);
+        TESTING::TestGpuResourceHandles(test_report);
+        TESTING::TestBuddyAllocator(test_report);
+        TESTING::TestFindChangedVertexRanges(test_report);
+        TESTING::TestVertexRangeCoalescing(test_report);
+        TESTING::TestPipelineStateDeduplication(test_report);
+        TESTING::TestShaderProgramBinaryCacheKeys(test_report);
+
+        std::string test_summary = "Self-tests: " + test_report.Summary();
+        OutputDebugString(test_summary.c_str());
+    }
+#endif
+
     // DEFINE PARAMETERS FOR THE WINDOW TO BE CREATED.
     // The structure is zeroed-out initially since it isn't necessary to set all fields.
     WNDCLASSEX window_class = {};
@@ -179,7 +444,25 @@ int CALLBACK WinMain(
     }
 
     // CREATE THE GRAPHICS DEVICE.
-    std::shared_ptr<GraphicsDevice> graphics_device = GraphicsDevice::Create(device_context);
+    // By default, debug builds log any errors reported by the driver, and release builds skip
+    // all error reporting to avoid its overhead.  Either default may be overridden so that
+    // the overhead can be timed within a single build.
+#ifdef _DEBUG
+    bool debug_output_enabled = true;
+#else
+    bool debug_output_enabled = false;
+#endif
+    bool debug_output_disabled_by_command_line = (nullptr != std::strstr(command_line_string, "no-debug-output"));
+    bool debug_output_enabled_by_command_line = (nullptr != std::strstr(command_line_string, "debug-output"));
+    if (debug_output_disabled_by_command_line)
+    {
+        debug_output_enabled = false;
+    }
+    else if (debug_output_enabled_by_command_line)
+    {
+        debug_output_enabled = true;
+    }
+    std::shared_ptr<GraphicsDevice> graphics_device = GraphicsDevice::Create(device_context, debug_output_enabled);
     bool graphics_device_created = (nullptr != graphics_device);
     if (!graphics_device_created)
     {
@@ -187,6 +470,10 @@ int CALLBACK WinMain(
         return EXIT_FAILURE;
     }
 
+    // CACHE LINKED SHADER PROGRAMS ON DISK TO SPEED UP LATER LAUNCHES.
+    // The cache is optional since shader programs can always be compiled from source.
+    graphics_device->ShaderProgramBinaryCache = ShaderProgramBinaryCache::Create("ShaderCache");
+
     // CREATE THE RENDERER.
     g_renderer = Renderer::Create(graphics_device);
     bool renderer_created = (nullptr != g_renderer);
@@ -196,6 +483,33 @@ int CALLBACK WinMain(
         return EXIT_FAILURE;
     }
 
+    // DISABLE MULTI-DRAW INDIRECT RENDERING IF REQUESTED.
+    // This allows comparing the fallback path against the multi-draw indirect path on the same driver.
+    bool multi_draw_indirect_disabled = (nullptr != std::strstr(command_line_string, "no-multi-draw-indirect"));
+    g_renderer->MultiDrawIndirectEnabled = !multi_draw_indirect_disabled;
+
+    // MEASURE VERTEX UPLOAD THROUGHPUT IF REQUESTED.
+    bool vertex_upload_benchmark_enabled = (nullptr != std::strstr(command_line_string, "vertex-upload-benchmark"));
+    if (vertex_upload_benchmark_enabled)
+    {
+        std::string vertex_upload_report = RunVertexUploadBenchmark(*graphics_device);
+        OutputDebugString(vertex_upload_report.c_str());
+    }
+
+    // REPORT HOW WELL THE SHADER PROGRAM BINARY CACHE WORKED.
+    bool shader_program_binary_cache_enabled = (nullptr != graphics_device->ShaderProgramBinaryCache);
+    if (shader_program_binary_cache_enabled)
+    {
+        const ShaderProgramBinaryCache& shader_program_binary_cache = *graphics_device->ShaderProgramBinaryCache;
+        const double MILLISECONDS_PER_SECOND = 1000.0;
+        std::string shader_program_binary_cache_report = "Shader program binary cache: ";
+        shader_program_binary_cache_report += std::to_string(shader_program_binary_cache.HitCount) + " hits, ";
+        shader_program_binary_cache_report += std::to_string(shader_program_binary_cache.MissCount) + " misses (";
+        shader_program_binary_cache_report += std::to_string(shader_program_binary_cache.RejectedCount) + " rejected), ";
+        shader_program_binary_cache_report += std::to_string(shader_program_binary_cache.TimeSavedInSeconds * MILLISECONDS_PER_SECOND) + " ms saved\n";
+        OutputDebugString(shader_program_binary_cache_report.c_str());
+    }
+
     g_renderer->Camera.WorldPosition = MATH::Vector3f(0.0f, 0.0f, 1.0f);
     g_renderer->Camera.LookAtWorldPosition = MATH::Vector3f(0.0f, 0.0f, 0.0f);
     g_renderer->Camera.UpDirection = MATH::Vector3f(0.0f, 1.0f, 0.0f);
@@ -207,9 +521,45 @@ int CALLBACK WinMain(
         Color(0.0f, 1.0f, 0.0f), 
         Color(0.0f, 0.0f, 1.0f));
 
+    // CREATE THE OCCLUSION CULLING BENCHMARK SCENE IF REQUESTED.
+    bool occlusion_benchmark_enabled = (nullptr != std::strstr(command_line_string, "occlusion-benchmark"));
+    std::vector<Object3D> indoor_benchmark_scene_objects;
+    if (occlusion_benchmark_enabled)
+    {
+        indoor_benchmark_scene_objects = CreateIndoorBenchmarkScene();
+    }
+
+    // CREATE THE GPU CULLING BENCHMARK SCENE IF REQUESTED.
+    // Its objects only need to be added once since they're culled and drawn on the GPU every frame.
+    bool gpu_culling_benchmark_enabled = (nullptr != std::strstr(command_line_string, "gpu-culling-benchmark"));
+    std::vector<Object3D> gpu_culling_benchmark_scene_objects;
+    if (gpu_culling_benchmark_enabled)
+    {
+        gpu_culling_benchmark_scene_objects = CreateGpuCullingBenchmarkScene();
+        for (const Object3D& scene_object : gpu_culling_benchmark_scene_objects)
+        {
+            g_renderer->AddGpuCulledObject(scene_object);
+        }
+
+        std::string gpu_culling_report = "GPU culling benchmark: " + std::to_string(gpu_culling_benchmark_scene_objects.size()) + " objects";
+        gpu_culling_report += (nullptr != g_renderer->GpuCuller) ? " culled on the GPU\n" : " drawn as instances (GPU culling unsupported)\n";
+        OutputDebugString(gpu_culling_report.c_str());
+    }
+
+    // CREATE THE DEPTH PRE-PASS BENCHMARK SCENE IF REQUESTED.
+    bool depth_pre_pass_benchmark_enabled = (nullptr != std::strstr(command_line_string, "depth-prepass-benchmark"));
+    std::vector<Object3D> depth_pre_pass_benchmark_scene_objects;
+    if (depth_pre_pass_benchmark_enabled)
+    {
+        depth_pre_pass_benchmark_scene_objects = CreateDepthPrePassBenchmarkScene();
+    }
+
     // RUN A MESSAGE LOOP.
     float angle_in_radians = 0.0f;
     auto start_time = std::chrono::high_resolution_clock::now();
+    auto frame_timing_period_start_time = start_time;
+    unsigned int frame_timing_period_frame_count = 0;
+    double frame_timing_period_start_fence_wait_time_in_seconds = 0.0;
     bool running = true;
     while (running)
     {
@@ -254,21 +604,143 @@ int CALLBACK WinMain(
         float total_elapsed_time = std::chrono::duration_cast<std::chrono::duration<float>>(current_time - start_time).count();
 #endif
 
-        g_renderer->ClearScreen(Color(0.0f, 0.0f, 0.0f, 1.0f));
+        {
+            GpuTimerScope gpu_timer_scope(graphics_device->GpuTimer.get(), "Clear");
+            g_renderer->ClearScreen(Color(0.0f, 0.0f, 0.0f, 1.0f));
+        }
 
         angle_in_radians = 0.5f * total_elapsed_time;
         triangle.RotationInRadians.X = MATH::Angle<float>::Radians(angle_in_radians);
         triangle.RotationInRadians.Y = MATH::Angle<float>::Radians(angle_in_radians);
         triangle.RotationInRadians.Z = MATH::Angle<float>::Radians(angle_in_radians);
-        g_renderer->Draw(triangle);
+        {
+            GpuTimerScope gpu_timer_scope(graphics_device->GpuTimer.get(), "Triangle");
+            g_renderer->Draw(triangle);
+        }
+
+        // DRAW THE OCCLUSION CULLING BENCHMARK SCENE.
+        // Objects are only submitted here and get drawn when the screen is displayed.
+        for (const Object3D& scene_object : indoor_benchmark_scene_objects)
+        {
+            g_renderer->DrawOccludable(scene_object);
+        }
 
-        GLenum error = glGetError();
-        if (error != GL_NO_ERROR)
+        // DRAW THE DEPTH PRE-PASS BENCHMARK SCENE.
+        // Objects are only submitted here and get drawn when the screen is displayed.
+        for (const Object3D& scene_object : depth_pre_pass_benchmark_scene_objects)
         {
-            error = error;
+            g_renderer->DrawOpaque(scene_object);
         }
 
+        // Errors are reported via the graphics device's debug message log rather than polling
+        // glGetError() here, which can force the CPU to wait for the GPU on some drivers.
         g_renderer->DisplayScreen();
+
+        // PERIODICALLY REPORT THE AVERAGE FRAME TIME.
+        // This allows comparing frame times between debug and release error reporting modes.
+        // The time spent waiting for frames in flight shows how much the CPU is limited by the GPU.
+        ++frame_timing_period_frame_count;
+        auto frame_end_time = std::chrono::high_resolution_clock::now();
+        float frame_timing_period_elapsed_time_in_seconds = std::chrono::duration_cast<std::chrono::duration<float>>(
+            frame_end_time - frame_timing_period_start_time).count();
+        const float FRAME_TIMING_PERIOD_IN_SECONDS = 5.0f;
+        bool frame_timing_period_over = (frame_timing_period_elapsed_time_in_seconds >= FRAME_TIMING_PERIOD_IN_SECONDS);
+        if (frame_timing_period_over)
+        {
+            const float MILLISECONDS_PER_SECOND = 1000.0f;
+            float average_frame_time_in_milliseconds = (MILLISECONDS_PER_SECOND * frame_timing_period_elapsed_time_in_seconds) / static_cast<float>(frame_timing_period_frame_count);
+            std::string frame_time_report = "Average frame time: " + std::to_string(average_frame_time_in_milliseconds) + " ms";
+            frame_time_report += debug_output_enabled ? " (debug output enabled)" : " (debug output disabled)";
+            double frame_timing_period_fence_wait_time_in_seconds = (
+                graphics_device->TotalFrameFenceWaitTimeInSeconds - frame_timing_period_start_fence_wait_time_in_seconds);
+            float average_fence_wait_time_in_milliseconds = (MILLISECONDS_PER_SECOND * static_cast<float>(frame_timing_period_fence_wait_time_in_seconds)) / static_cast<float>(frame_timing_period_frame_count);
+            frame_time_report += ", average wait for GPU: " + std::to_string(average_fence_wait_time_in_milliseconds) + " ms\n";
+            OutputDebugString(frame_time_report.c_str());
+
+            // REPORT AVERAGE CPU AND GPU TIMES FOR EACH PASS OVER THE TIMED FRAMES.
+            bool gpu_timer_exists = (nullptr != graphics_device->GpuTimer);
+            if (gpu_timer_exists)
+            {
+                std::vector<GpuTimer::PassTiming> average_pass_timings = graphics_device->GpuTimer->AveragePassTimings();
+                graphics_device->GpuTimer->ResetAverages();
+                for (const GpuTimer::PassTiming& pass_timing : average_pass_timings)
+                {
+                    const std::size_t INDENT_SPACE_COUNT_PER_DEPTH = 2;
+                    std::string pass_timing_report = std::string(pass_timing.Depth * INDENT_SPACE_COUNT_PER_DEPTH, ' ') + pass_timing.Name;
+                    pass_timing_report += ": CPU " + std::to_string(pass_timing.CpuTimeInMilliseconds) + " ms";
+                    pass_timing_report += ", GPU " + std::to_string(pass_timing.GpuTimeInMilliseconds) + " ms\n";
+                    OutputDebugString(pass_timing_report.c_str());
+                }
+            }
+
+            // REPORT HOW MANY DRAWS WERE CULLED IN THE LAST FRAME.
+            // Conditionally drawn objects may also be culled, but only the GPU knows which ones.
+            bool occlusion_culling_used = (occlusion_benchmark_enabled && (nullptr != g_renderer->OcclusionCuller));
+            if (occlusion_culling_used)
+            {
+                const OcclusionCuller::OcclusionStatistics& occlusion_statistics = g_renderer->OcclusionCuller->PreviousFrameStatistics;
+                std::string occlusion_report = "Occlusion culling: ";
+                occlusion_report += std::to_string(occlusion_statistics.SubmittedObjectCount) + " submitted, ";
+                occlusion_report += std::to_string(occlusion_statistics.DrawnObjectCount) + " drawn, ";
+                occlusion_report += std::to_string(occlusion_statistics.ConditionallyDrawnObjectCount) + " conditionally drawn, ";
+                occlusion_report += std::to_string(occlusion_statistics.CulledObjectCount) + " culled, ";
+                occlusion_report += std::to_string(occlusion_statistics.BoundingBoxQueryCount) + " bounding box queries, ";
+                occlusion_report += std::to_string(occlusion_statistics.ObjectQueryCount) + " object queries\n";
+                OutputDebugString(occlusion_report.c_str());
+            }
+
+            // REPORT THE OVERDRAW OF THE LATEST MEASURED FRAME.
+            bool overdraw_measured = (depth_pre_pass_benchmark_enabled && (nullptr != g_renderer->OverdrawMeter));
+            if (overdraw_measured)
+            {
+                const OverdrawMeter::FrameOverdraw& frame_overdraw = g_renderer->OverdrawMeter->LatestFrameOverdraw;
+                std::string overdraw_report = frame_overdraw.DepthPrePassUsed ? "Overdraw with depth pre-pass: " : "Overdraw without depth pre-pass: ";
+                overdraw_report += std::to_string(frame_overdraw.DepthPrePassSampleCount) + " depth pre-pass samples, ";
+                overdraw_report += std::to_string(frame_overdraw.ColorPassSampleCount) + " color pass samples, ";
+                overdraw_report += std::to_string(frame_overdraw.ShadedFragmentsPerPixel()) + " shaded fragments per pixel, ";
+                overdraw_report += std::to_string(g_renderer->OverdrawMeter->SkippedFrameCount) + " frames skipped\n";
+                OutputDebugString(overdraw_report.c_str());
+            }
+
+            // REPORT THE SHADER PROGRAM VARIANTS COMPILED SO FAR.
+            // Variants are only compiled once first needed, so this grows as new kinds of drawing are used.
+            ShaderProgramVariants::VariantStatistics variant_statistics = g_renderer->ShaderProgramVariants.Statistics();
+            std::string variant_report = "Shader program variants: ";
+            variant_report += std::to_string(variant_statistics.CompiledVariantCount) + " compiled, ";
+            variant_report += std::to_string(variant_statistics.ReadyVariantCount) + " ready, ";
+            variant_report += std::to_string(variant_statistics.FailedVariantCount) + " failed, ";
+            variant_report += std::to_string(variant_statistics.CompileTimeInSeconds * MILLISECONDS_PER_SECOND) + " ms compiling\n";
+            OutputDebugString(variant_report.c_str());
+
+            // REPORT HOW MUCH GRAPHICS MEMORY SHARING IDENTICAL VERTEX UPLOADS SAVES.
+            const GpuResourceManager& resource_manager = g_renderer->ResourceManager;
+            std::string deduplication_report = "Vertex buffer deduplication: ";
+            deduplication_report += std::to_string(resource_manager.ResidentVertexBufferCount) + " resident buffers, ";
+            deduplication_report += std::to_string(resource_manager.UniqueVertexUploadCount) + " unique uploads, ";
+            deduplication_report += std::to_string(resource_manager.DeduplicationRatio()) + " buffers per upload, ";
+            deduplication_report += std::to_string(resource_manager.DeduplicatedByteCount) + " bytes saved\n";
+            OutputDebugString(deduplication_report.c_str());
+
+            // REPORT PIPELINE STATE CHANGES IN THE LAST FRAME.
+            // Few switches relative to draws shows that drawing is well ordered by pipeline state.
+            const GraphicsDevice::PipelineStatistics& pipeline_statistics = graphics_device->PreviousFramePipelineStatistics;
+            std::string pipeline_report = "Pipeline state in last frame: ";
+            pipeline_report += std::to_string(pipeline_statistics.PipelineSwitchCount) + " switches, ";
+            pipeline_report += std::to_string(pipeline_statistics.StateChangeCount) + " state changes, ";
+            pipeline_report += std::to_string(pipeline_statistics.RedundantApplyCount) + " redundant applies\n";
+            OutputDebugString(pipeline_report.c_str());
+
+            // SWITCH THE DEPTH PRE-PASS FOR THE BENCHMARK SCENE.
+            // This lets the next period be compared against this one.
+            if (depth_pre_pass_benchmark_enabled)
+            {
+                g_renderer->DepthPrePassEnabled = !g_renderer->DepthPrePassEnabled;
+            }
+
+            frame_timing_period_start_time = frame_end_time;
+            frame_timing_period_start_fence_wait_time_in_seconds = graphics_device->TotalFrameFenceWaitTimeInSeconds;
+            frame_timing_period_frame_count = 0;
+        }
     }
 
     return EXIT_SUCCESS;